@@ -1,14 +1,28 @@
 #include <iostream>
+#include <cmath>
 #include <chrono>
 #include <thread>
 #include <csignal>
 #include <atomic>
+#include <sstream>
+#include "sample_recorder.hpp"
 #include "sensor_manager.hpp"
+#include "stats_aggregator.hpp"
 
 std::atomic<bool> running(true);
 std::shared_ptr<SensorManager> sensor_manager;
 
-int main() {
+// Prints one window summary as a single write, so lines from different shards do not interleave
+void print_summary(const char* sensor, const char* unit, const WindowSummary& summary) {
+    std::ostringstream line;
+    line << "[" << sensor << "] " << summary.count << " samples: min " << summary.min << unit
+         << ", max " << summary.max << unit << ", mean " << summary.mean << unit
+         << ", stddev " << std::sqrt(summary.variance) << unit << ", p50 " << summary.p50 << unit
+         << ", p99 " << summary.p99 << unit << '\n';
+    std::cout << line.str();
+}
+
+int main(int argc, char* argv[]) {
     // Set up signal handler
     std::signal(SIGINT, [](int signal) {
         if (signal == SIGINT) {
@@ -23,18 +37,34 @@ int main() {
     // Create SensorManager
     sensor_manager = std::make_shared<SensorManager>();
 
-    // Create sensors
-    auto temp_sensor = std::make_shared<TemperatureSensor>(sensor_manager->get_io_context());
-    auto humidity_sensor = std::make_shared<HumiditySensor>(sensor_manager->get_io_context());
+    // Create sensors sampling at 100 Hz, each on the shard its id hashes to
+    auto temp_sensor = std::make_shared<TemperatureSensor>(sensor_manager->get_io_context("temperature"),
+                                                           std::chrono::milliseconds(10));
+    auto humidity_sensor = std::make_shared<HumiditySensor>(sensor_manager->get_io_context("humidity"),
+                                                            std::chrono::milliseconds(10));
 
-    // Connect sensor signals to slots
-    temp_sensor->connect([](const double& temp) {
-        std::cout << "[TemperatureSensor] New Temperature: " << temp << " °C" << std::endl;
-    });
+    // Deliver samples in batches of up to 50 (at most 500 ms late) to the aggregators, which
+    // publish one summary per second: over the last 3 s for temperature, the last 1 s for humidity
+    auto temp_stats = std::make_shared<StatsAggregator<double>>(300, 100);
+    auto humidity_stats = std::make_shared<StatsAggregator<int>>(100);
 
-    humidity_sensor->connect([](const int& humidity) {
-        std::cout << "[HumiditySensor] New Humidity: " << humidity << " %" << std::endl;
-    });
+    temp_sensor->set_batching(50, std::chrono::milliseconds(500));
+    temp_sensor->subscribe_batch([temp_stats](std::span<const double> temps) { temp_stats->add(temps); });
+    temp_stats->subscribe([](const WindowSummary& summary) { print_summary("TemperatureSensor", " °C", summary); });
+
+    humidity_sensor->set_batching(50, std::chrono::milliseconds(500));
+    humidity_sensor->subscribe_batch([humidity_stats](std::span<const int> values) { humidity_stats->add(values); });
+    humidity_stats->subscribe([](const WindowSummary& summary) { print_summary("HumiditySensor", " %", summary); });
+
+    // With a directory argument, also record every sample to a segmented binary log there
+    std::unique_ptr<SampleRecorder> recorder;
+    if (argc > 1) {
+        SampleRecorder::Options options;
+        options.directory = argv[1];
+        recorder = std::make_unique<SampleRecorder>(options);
+        recorder->attach(*temp_sensor, 1);
+        recorder->attach(*humidity_sensor, 2);
+    }
 
     // Add sensors to manager
     sensor_manager->add_sensor(temp_sensor);
@@ -50,6 +80,12 @@ int main() {
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
 
+    if (recorder) {
+        recorder->stop();
+        std::cout << "Recorded " << recorder->committed() << " samples to " << argv[1]
+                  << " (" << recorder->dropped() << " dropped).\n";
+    }
+
     std::cout << "Sensor Monitoring System stopped." << std::endl;
 
     return 0;
@@ -0,0 +1,175 @@
+#ifndef SENSOR_MONITOR_RECORDING_READER_HPP
+#define SENSOR_MONITOR_RECORDING_READER_HPP
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "sample_recorder.hpp"
+
+
+/**
+ * @brief Replays a recording written by SampleRecorder, straight from memory-mapped segments.
+ *
+ * Records are never copied or parsed: a segment is mapped read-only and its committed records
+ * are handed out as a std::span<const SampleRecord> into the mapping. A segment that is still
+ * being written can be read too; it shows the records committed when records() is called.
+ */
+class RecordingReader {
+public:
+    /**
+     * @brief A read-only mapping of one segment file; move-only.
+     */
+    class Segment {
+    public:
+        Segment(Segment&& other) noexcept
+            : mapping_(std::exchange(other.mapping_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+        Segment& operator=(Segment&& other) noexcept {
+            if (this != &other) {
+                unmap();
+                mapping_ = std::exchange(other.mapping_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        ~Segment() {
+            unmap();
+        }
+
+        /**
+         * @brief Returns the committed records, pointing into the mapping.
+         *
+         * The span stays valid as long as the Segment.
+         */
+        std::span<const SampleRecord> records() const {
+            const auto* header = static_cast<const SegmentHeader*>(mapping_);
+            // atomic_ref needs a non-const object; the load does not write
+            const std::uint64_t committed = std::atomic_ref<std::uint64_t>(
+                const_cast<std::uint64_t&>(header->committed)).load(std::memory_order_acquire);
+            const std::size_t available = (size_ - sizeof(SegmentHeader)) / sizeof(SampleRecord);
+            const auto* first = reinterpret_cast<const SampleRecord*>(
+                static_cast<const char*>(mapping_) + sizeof(SegmentHeader));
+            return {first, std::min<std::size_t>(committed, available)};
+        }
+
+        /**
+         * @brief Retrieves the index of the segment in its recording.
+         */
+        std::uint64_t index() const {
+            return static_cast<const SegmentHeader*>(mapping_)->segment;
+        }
+
+    private:
+        friend class RecordingReader;
+
+        Segment(void* mapping, std::size_t size) : mapping_(mapping), size_(size) {}
+
+        void unmap() {
+            if (mapping_) {
+                munmap(mapping_, size_);
+                mapping_ = nullptr;
+            }
+        }
+
+        void* mapping_;     ///< The whole file, read-only
+        std::size_t size_;  ///< Size of the file when it was mapped
+    };
+
+    /**
+     * @brief Constructs a RecordingReader over the segments present in a directory.
+     *
+     * @param directory The directory the recorder wrote to.
+     * @param prefix The recorder's file name prefix.
+     */
+    explicit RecordingReader(const std::filesystem::path& directory, const std::string& prefix = "sensors")
+        : paths_(SampleRecorder::segment_paths(directory, prefix)) {}
+
+    /**
+     * @brief Retrieves the number of segments found.
+     */
+    std::size_t segment_count() const {
+        return paths_.size();
+    }
+
+    const std::filesystem::path& segment_path(std::size_t index) const {
+        return paths_.at(index);
+    }
+
+    /**
+     * @brief Maps a segment.
+     *
+     * @param index The position of the segment among those found, from 0.
+     * @throws std::system_error if the file cannot be mapped.
+     * @throws std::runtime_error if it is not a segment of this format.
+     */
+    Segment map(std::size_t index) const {
+        const std::filesystem::path& path = paths_.at(index);
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot open " + path.string());
+        }
+        struct stat info {};
+        if (fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "Cannot stat " + path.string());
+        }
+        const auto size = static_cast<std::size_t>(info.st_size);
+        if (size < sizeof(SegmentHeader)) {
+            ::close(fd);
+            throw std::runtime_error(path.string() + " is too short to be a segment.");
+        }
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        const int error = errno;
+        ::close(fd); // The mapping keeps the file
+        if (mapping == MAP_FAILED) {
+            throw std::system_error(error, std::generic_category(), "Cannot map " + path.string());
+        }
+        Segment segment(mapping, size);
+        const auto* header = static_cast<const SegmentHeader*>(mapping);
+        if (std::memcmp(header->magic, SegmentHeader::MAGIC, sizeof(header->magic)) != 0 ||
+            header->version != SegmentHeader::VERSION || header->record_size != sizeof(SampleRecord)) {
+            throw std::runtime_error(path.string() + " is not a sample segment of this version.");
+        }
+        madvise(mapping, size, MADV_SEQUENTIAL);
+        return segment;
+    }
+
+    /**
+     * @brief Calls a function with the committed records of every segment, in order.
+     *
+     * @param func Called as func(std::span<const SampleRecord>) once per segment.
+     * @return The number of records replayed.
+     */
+    template <typename Func>
+    std::uint64_t replay(Func&& func) const {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < paths_.size(); ++i) {
+            const Segment segment = map(i);
+            const std::span<const SampleRecord> records = segment.records();
+            func(records);
+            total += records.size();
+        }
+        return total;
+    }
+
+private:
+    std::vector<std::filesystem::path> paths_; ///< Segment files, in order
+};
+
+#endif // SENSOR_MONITOR_RECORDING_READER_HPP
@@ -0,0 +1,476 @@
+#ifndef SENSOR_MONITOR_SAMPLE_RECORDER_HPP
+#define SENSOR_MONITOR_SAMPLE_RECORDER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <container/spsc_circular_queue.hpp>
+#include "sensor.hpp"
+
+
+/**
+ * @brief One recorded sample, stored as is in the segment files.
+ */
+struct SampleRecord {
+    std::int64_t timestamp_ns; ///< Wall-clock time of the reading, in nanoseconds since the epoch
+    std::uint32_t sensor_id;   ///< Id the sensor was attached with
+    std::uint32_t reserved;    ///< Zero; keeps value 8-byte aligned
+    double value;              ///< The reading, converted to double
+};
+
+static_assert(sizeof(SampleRecord) == 24 && std::is_trivially_copyable_v<SampleRecord>,
+              "SampleRecord is the on-disk format");
+
+
+/**
+ * @brief The 64 bytes at the start of every segment file; the records follow it.
+ */
+struct SegmentHeader {
+    static constexpr char MAGIC[8] = {'S', 'M', 'O', 'N', 'R', 'E', 'C', '1'};
+    static constexpr std::uint32_t VERSION = 1;
+
+    char magic[8];              ///< MAGIC
+    std::uint32_t version;      ///< VERSION
+    std::uint32_t record_size;  ///< sizeof(SampleRecord)
+    std::uint64_t segment;      ///< Index of the segment in its recording
+    std::uint64_t capacity;     ///< Records the segment has room for
+    std::uint64_t committed;    ///< Records written and published to readers (atomic)
+    std::uint8_t padding[24];   ///< Zero
+};
+
+static_assert(sizeof(SegmentHeader) == 64, "SegmentHeader is the on-disk format");
+
+
+/**
+ * @brief Records sensor samples into an append-only binary log of memory-mapped segment files.
+ *
+ * record() never blocks and never allocates after a thread's first call: each producing thread
+ * (e.g. each SensorManager shard) gets its own wait-free SPSC channel, and a full channel drops
+ * the sample and counts it. One writer thread drains the channels into the current segment,
+ * <directory>/<prefix>-<index>.seg, by copying records into its mapping; when a segment is full
+ * the writer rotates to a new file.
+ *
+ * Commits are grouped: the writer publishes the record count in the segment header every
+ * commit_records records or commit_interval, whichever comes first, and only then do readers
+ * (RecordingReader) see the new records. Published records survive a crash of the process,
+ * since they are in the page cache; with sync_to_disk, each commit also msync()s them, which
+ * costs the writer thread, never the producers.
+ *
+ * Existing segments are never overwritten: a new recorder continues after the highest index.
+ */
+class SampleRecorder {
+public:
+    struct Options {
+        std::filesystem::path directory = ".";                  ///< Where the segments go; created if needed
+        std::string prefix = "sensors";                         ///< File name prefix of the segments
+        std::size_t segment_records = std::size_t(1) << 22;     ///< Records per segment (96 MiB)
+        std::size_t commit_records = std::size_t(1) << 16;      ///< Commit at least every this many records
+        std::chrono::milliseconds commit_interval{50};          ///< Commit at least this often while writing
+        bool sync_to_disk = false;                              ///< msync() every commit
+        std::size_t channel_capacity = std::size_t(1) << 16;    ///< Records buffered per producing thread
+    };
+
+    /**
+     * @brief Constructs a SampleRecorder and starts its writer thread.
+     *
+     * @param options Where and how to record.
+     * @throws std::system_error if the directory or the first segment cannot be created.
+     * @throws std::invalid_argument if a size in options is zero.
+     */
+    explicit SampleRecorder(Options options)
+        : options_(std::move(options)), recorder_id_(next_recorder_id()) {
+        if (options_.segment_records == 0 || options_.commit_records == 0 || options_.channel_capacity == 0) {
+            throw std::invalid_argument("SampleRecorder sizes must be greater than zero.");
+        }
+        std::filesystem::create_directories(options_.directory);
+        const auto existing = segment_paths(options_.directory, options_.prefix);
+        next_segment_ = existing.empty() ? 0 : segment_index(existing.back()) + 1;
+        open_segment();
+        writer_ = std::thread([this]() { run(); });
+    }
+
+    /**
+     * @brief Stops the recorder, writing what the channels still hold.
+     */
+    ~SampleRecorder() {
+        stop();
+    }
+
+    SampleRecorder(const SampleRecorder&) = delete;
+    SampleRecorder& operator=(const SampleRecorder&) = delete;
+
+    /**
+     * @brief Queues a sample for writing, stamped with the current wall-clock time.
+     *
+     * Thread-safe; lock-free and non-blocking once the calling thread has its channel, which its
+     * first call creates under a lock.
+     *
+     * @return true if the sample was queued, false if it was dropped (channel full or recorder stopped).
+     */
+    bool record(std::uint32_t sensor_id, double value) {
+        const auto now = std::chrono::system_clock::now().time_since_epoch();
+        return record(SampleRecord{std::chrono::duration_cast<std::chrono::nanoseconds>(now).count(), sensor_id, 0, value});
+    }
+
+    /**
+     * @brief Queues a ready-made record for writing. Thread-safe and non-blocking.
+     */
+    bool record(const SampleRecord& sample) {
+        if (Channel* channel = local_channel()) {
+            // Either this sees stopping_, or the writer sees busy and waits for the push to land
+            channel->busy.store(true, std::memory_order_seq_cst);
+            const bool queued = !stopping_.load(std::memory_order_seq_cst) && channel->queue.try_push_back(sample);
+            channel->busy.store(false, std::memory_order_release);
+            if (queued) {
+                return true;
+            }
+        }
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * @brief Records every reading of a sensor under the given id.
+     *
+     * The recorder must outlive the sensor's readings.
+     */
+    template <typename T>
+    void attach(Sensor<T>& sensor, std::uint32_t sensor_id) {
+        sensor.subscribe([this, sensor_id](const T& value) { record(sensor_id, static_cast<double>(value)); });
+    }
+
+    /**
+     * @brief Writes what the channels hold, commits, and stops the writer thread.
+     *
+     * Samples recorded afterwards are dropped. The last segment is truncated to its records.
+     */
+    void stop() {
+        stopping_.store(true, std::memory_order_seq_cst);
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+    }
+
+    /**
+     * @brief Retrieves the number of records committed so far.
+     */
+    std::uint64_t committed() const {
+        return committed_total_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Retrieves the number of samples dropped because a channel was full or the recorder stopped.
+     */
+    std::uint64_t dropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Retrieves the error that stopped the writer, or an empty string.
+     */
+    std::string error() const {
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        return error_;
+    }
+
+    /**
+     * @brief Lists the segment files of a recording in order.
+     */
+    static std::vector<std::filesystem::path> segment_paths(const std::filesystem::path& directory,
+                                                            const std::string& prefix) {
+        std::vector<std::filesystem::path> paths;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+            const std::string name = entry.path().filename().string();
+            if (name.size() != prefix.size() + 1 + INDEX_DIGITS + 4 || name.compare(0, prefix.size(), prefix) != 0 ||
+                name[prefix.size()] != '-' || entry.path().extension() != ".seg") {
+                continue;
+            }
+            const auto index_begin = name.begin() + static_cast<std::ptrdiff_t>(prefix.size()) + 1;
+            if (std::all_of(index_begin, index_begin + INDEX_DIGITS, [](char c) { return c >= '0' && c <= '9'; })) {
+                paths.push_back(entry.path());
+            }
+        }
+        std::sort(paths.begin(), paths.end()); // Fixed-width indices sort by name
+        return paths;
+    }
+
+private:
+    static constexpr int INDEX_DIGITS = 8;
+    static constexpr auto IDLE_SLEEP = std::chrono::microseconds(500);
+
+    /**
+     * @brief The queue between one producing thread and the writer.
+     */
+    struct Channel {
+        explicit Channel(std::size_t capacity) : queue(capacity) {}
+
+        cxx_lab::SpscCircularQueue<SampleRecord> queue; ///< Records from one thread
+        std::atomic<bool> busy{false};                  ///< Set while record() may push into queue
+    };
+
+    static std::uint64_t next_recorder_id() {
+        static std::atomic<std::uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static std::uint64_t segment_index(const std::filesystem::path& path) {
+        const std::string stem = path.stem().string();
+        return std::stoull(stem.substr(stem.size() - INDEX_DIGITS));
+    }
+
+    /**
+     * @brief Returns the calling thread's channel, creating it on the first call.
+     *
+     * A one-entry thread-local cache, keyed by recorder id rather than address, makes repeated
+     * calls from the same thread lock-free.
+     */
+    Channel* local_channel() {
+        struct Cache {
+            std::uint64_t recorder_id = 0;
+            Channel* channel = nullptr;
+        };
+        thread_local Cache cache;
+        if (cache.recorder_id == recorder_id_) {
+            return cache.channel;
+        }
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        if (stopping_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        auto& channel = thread_channels_[std::this_thread::get_id()];
+        if (!channel) {
+            channels_.push_back(std::make_unique<Channel>(options_.channel_capacity));
+            channel = channels_.back().get();
+        }
+        cache = Cache{recorder_id_, channel};
+        return channel;
+    }
+
+    void run() {
+        auto last_commit = std::chrono::steady_clock::now();
+        for (;;) {
+            const bool stopping = stopping_.load(std::memory_order_seq_cst);
+            if (stopping) {
+                quiesce(); // Later record() calls see stopping_, so the drains below get everything
+            }
+            const std::size_t moved = drain();
+            const auto now = std::chrono::steady_clock::now();
+            if (uncommitted_ >= options_.commit_records ||
+                (uncommitted_ > 0 && now - last_commit >= options_.commit_interval)) {
+                commit();
+                last_commit = now;
+            }
+            if (moved == 0) {
+                if (stopping) {
+                    break;
+                }
+                std::this_thread::sleep_for(IDLE_SLEEP);
+            }
+        }
+        commit();
+        close_segment(true);
+    }
+
+    /**
+     * @brief Waits for the record() calls that started before stopping_ was set to finish their push.
+     */
+    void quiesce() {
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        for (auto& channel : channels_) {
+            while (channel->busy.load(std::memory_order_seq_cst)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief Moves what the channels hold into the segment; returns the number of records moved.
+     *
+     * Takes at most channel_capacity records from each channel per pass, so that a busy channel
+     * cannot hold up the commits. Rotation happens outside channels_mutex_, so that creating a
+     * segment never stalls a new producer's registration.
+     */
+    std::size_t drain() {
+        std::size_t moved = 0;
+        std::optional<SampleRecord> overflow; // Popped when the segment was already full
+        for (;;) {
+            if (overflow) {
+                rotate();
+                append(*overflow);
+                overflow.reset();
+            }
+            std::lock_guard<std::mutex> lock(channels_mutex_);
+            SampleRecord sample;
+            for (auto& channel : channels_) {
+                for (std::size_t n = 0; n < options_.channel_capacity && channel->queue.try_pop_front(sample); ++n) {
+                    ++moved;
+                    if (!failed_ && count_ == options_.segment_records) {
+                        overflow = sample;
+                        break;
+                    }
+                    append(sample);
+                }
+                if (overflow) {
+                    break;
+                }
+            }
+            if (!overflow) {
+                return moved;
+            }
+        }
+    }
+
+    /**
+     * @brief Copies a record into the segment, which has room for it, or drops it after a failure.
+     */
+    void append(const SampleRecord& sample) {
+        if (failed_) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::memcpy(&records_[count_], &sample, sizeof(SampleRecord));
+        ++count_;
+        ++uncommitted_;
+    }
+
+    /**
+     * @brief Commits and closes the full segment and opens the next one; on failure, stops writing.
+     */
+    void rotate() {
+        try {
+            commit();
+            close_segment(false);
+            open_segment();
+        } catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(channels_mutex_);
+            error_ = e.what();
+            failed_ = true;
+        }
+    }
+
+    /**
+     * @brief Publishes the records written so far to readers, syncing them to disk if asked to.
+     */
+    void commit() {
+        if (!header_ || uncommitted_ == 0) {
+            return;
+        }
+        if (options_.sync_to_disk) {
+            // Records first, so the count never gets ahead of the data on disk
+            const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            const std::size_t from = (sizeof(SegmentHeader) + synced_ * sizeof(SampleRecord)) / page * page;
+            const std::size_t to = sizeof(SegmentHeader) + count_ * sizeof(SampleRecord);
+            msync(static_cast<char*>(mapping_) + from, to - from, MS_SYNC);
+        }
+        std::atomic_ref<std::uint64_t>(header_->committed).store(count_, std::memory_order_release);
+        if (options_.sync_to_disk) {
+            msync(mapping_, sizeof(SegmentHeader), MS_SYNC);
+        }
+        committed_total_.fetch_add(uncommitted_, std::memory_order_release);
+        synced_ = count_;
+        uncommitted_ = 0;
+    }
+
+    void open_segment() {
+        const std::uint64_t index = next_segment_++;
+        char name[32];
+        std::snprintf(name, sizeof(name), "-%0*llu.seg", INDEX_DIGITS, static_cast<unsigned long long>(index));
+        const std::filesystem::path path = options_.directory / (options_.prefix + name);
+
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot create " + path.string());
+        }
+        mapping_size_ = sizeof(SegmentHeader) + options_.segment_records * sizeof(SampleRecord);
+        // Reserve the blocks now, so a full disk fails here rather than as SIGBUS on a write
+        int result = posix_fallocate(fd, 0, static_cast<off_t>(mapping_size_));
+        if (result == EOPNOTSUPP || result == EINVAL) {
+            result = ::ftruncate(fd, static_cast<off_t>(mapping_size_)) == 0 ? 0 : errno;
+        }
+        void* mapping = result == 0 ? mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+        if (mapping == MAP_FAILED) {
+            const int error = result != 0 ? result : errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "Cannot map " + path.string());
+        }
+        madvise(mapping, mapping_size_, MADV_SEQUENTIAL);
+
+        fd_ = fd;
+        mapping_ = mapping;
+        header_ = static_cast<SegmentHeader*>(mapping);
+        records_ = reinterpret_cast<SampleRecord*>(static_cast<char*>(mapping) + sizeof(SegmentHeader));
+        std::memcpy(header_->magic, SegmentHeader::MAGIC, sizeof(header_->magic));
+        header_->version = SegmentHeader::VERSION;
+        header_->record_size = sizeof(SampleRecord);
+        header_->segment = index;
+        header_->capacity = options_.segment_records;
+        count_ = 0;
+        synced_ = 0;
+    }
+
+    /**
+     * @brief Unmaps the current segment; the last one is truncated to its records.
+     */
+    void close_segment(bool last) {
+        if (!header_) {
+            return;
+        }
+        munmap(mapping_, mapping_size_);
+        if (last) {
+            [[maybe_unused]] const int result =
+                ::ftruncate(fd_, static_cast<off_t>(sizeof(SegmentHeader) + count_ * sizeof(SampleRecord)));
+        }
+        ::close(fd_);
+        header_ = nullptr;
+        records_ = nullptr;
+    }
+
+    const Options options_;                                     ///< Where and how to record
+    const std::uint64_t recorder_id_;                           ///< Process-unique id for the thread-local cache
+    std::atomic<bool> stopping_{false};                         ///< Set by stop()
+    std::atomic<std::uint64_t> committed_total_{0};             ///< Records committed over all segments
+    std::atomic<std::uint64_t> dropped_{0};                     ///< Samples that were not recorded
+
+    mutable std::mutex channels_mutex_;                         ///< Guards the channel lists and error_
+    std::vector<std::unique_ptr<Channel>> channels_;            ///< One channel per producing thread
+    std::unordered_map<std::thread::id, Channel*> thread_channels_; ///< Channel of each producing thread
+    std::string error_;                                         ///< Why the writer failed, if it did
+
+    // Writer thread state
+    std::uint64_t next_segment_ = 0;                            ///< Index of the next segment file
+    int fd_ = -1;                                               ///< Current segment file
+    void* mapping_ = nullptr;                                   ///< Mapping of the whole segment
+    std::size_t mapping_size_ = 0;                              ///< Size of the mapping
+    SegmentHeader* header_ = nullptr;                           ///< Header of the current segment
+    SampleRecord* records_ = nullptr;                           ///< Records of the current segment
+    std::size_t count_ = 0;                                     ///< Records written to the current segment
+    std::size_t synced_ = 0;                                    ///< Records of the current segment already committed
+    std::size_t uncommitted_ = 0;                               ///< Records written since the last commit
+    bool failed_ = false;                                       ///< Whether a rotation failed; later records are dropped
+    std::thread writer_;                                        ///< Drains the channels into the segments
+};
+
+#endif // SENSOR_MONITOR_SAMPLE_RECORDER_HPP
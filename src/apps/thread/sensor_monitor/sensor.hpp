@@ -3,9 +3,16 @@
 
 #include <boost/signals2.hpp>
 #include <boost/asio.hpp>
+#include <algorithm>
 #include <memory>
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <random>
+#include <span>
+#include <vector>
+#include "slot_list.hpp"
+#include "timer_wheel.hpp"
 
 
 /**
@@ -26,26 +33,51 @@ public:
      * @brief Stops the sensor.
      */
     virtual void stop() = 0;
+
+    /**
+     * @brief Provides the io_context the sensor's readings run on.
+     */
+    virtual boost::asio::io_context& get_io_context() = 0;
 };
 
 
 /**
  * @brief Abstract base class representing a generic sensor.
  *
+ * A sensor reads once per sampling period. By default it re-arms one steady_timer of its own,
+ * so each reading costs a timer heap entry but no allocation; sensors built on a TimerWheel
+ * share the wheel's single timer instead, which suits thousands of sensors at high rates.
+ *
+ * Readings are delivered per sample, to connect() and subscribe() slots, and, once
+ * set_batching() is called, in batches as a std::span to connect_batch() and subscribe_batch()
+ * slots. A boost::signals2 signal is only emitted if something was connected to it; the
+ * subscribe*() slots never disconnect and are called without any locking.
+ *
  * @tparam T The type of data the sensor produces.
  */
 template <typename T>
 class Sensor : public SensorBase {
 public:
     using SignalType = boost::signals2::signal<void(const T&)>;
+    using BatchSignalType = boost::signals2::signal<void(std::span<const T>)>;
 
     /**
      * @brief Constructs a Sensor with a reference to io_context.
      *
      * @param io_ctx The io_context for asynchronous operations.
+     * @param period The sampling period.
+     */
+    Sensor(boost::asio::io_context& io_ctx, std::chrono::nanoseconds period = std::chrono::seconds(1))
+        : io_context_(io_ctx), timer_(io_ctx), period_(period), running_(false) {}
+
+    /**
+     * @brief Constructs a Sensor that ticks from a shared TimerWheel.
+     *
+     * @param wheel The wheel to schedule the readings on; it must outlive the sensor.
+     * @param period The sampling period, rounded up to the wheel's tick.
      */
-    Sensor(boost::asio::io_context& io_ctx)
-        : io_context_(io_ctx), running_(false) {}
+    Sensor(TimerWheel& wheel, std::chrono::nanoseconds period = std::chrono::seconds(1))
+        : io_context_(wheel.get_io_context()), timer_(io_context_), wheel_(&wheel), period_(period), running_(false) {}
 
     virtual ~Sensor() {
         stop();
@@ -56,18 +88,48 @@ public:
      */
     virtual void start() override {
         running_.store(true);
+        if (wheel_) {
+            wheel_task_ = wheel_->schedule_every(period_, [this]() { read(); });
+            return;
+        }
+        timer_.expires_after(period_);
         schedule_read();
     }
 
     /**
-     * @brief Stops the sensor data acquisition.
+     * @brief Stops the sensor data acquisition and delivers the partial batch, if any.
+     *
+     * Call it on the thread running the sensor's io_context (SensorManager::stop_all() does), so
+     * it does not race a reading.
      */
     virtual void stop() override {
         running_.store(false);
-        if (timer_) {
+        if (wheel_) {
+            wheel_->cancel(wheel_task_);
+        } else {
             boost::system::error_code ec;
-            timer_->cancel(ec);
+            timer_.cancel(ec);
         }
+        flush_batch();
+    }
+
+    /**
+     * @brief Provides the io_context the sensor's readings run on.
+     */
+    virtual boost::asio::io_context& get_io_context() override {
+        return io_context_;
+    }
+
+    /**
+     * @brief Retrieves the sampling period, rounded up to the wheel's tick on a TimerWheel.
+     */
+    std::chrono::nanoseconds period() const {
+        if (!wheel_) return period_;
+
+        // The same rounding as TimerWheel::schedule_every()
+        const std::chrono::nanoseconds tick = wheel_->tick();
+        const auto ticks = std::max<std::chrono::nanoseconds::rep>(1, (period_.count() + tick.count() - 1) / tick.count());
+        return ticks * tick;
     }
 
     /**
@@ -76,9 +138,62 @@ public:
      * @param slot The slot to connect.
      */
     boost::signals2::connection connect(const typename SignalType::slot_type& slot) {
+        has_connections_.store(true);
         return signal_.connect(slot);
     }
 
+    /**
+     * @brief Adds a per-sample subscriber that is never disconnected, called without locking.
+     *
+     * @param slot The slot to add; it lives as long as the sensor.
+     */
+    void subscribe(std::function<void(const T&)> slot) {
+        slots_.connect(std::move(slot));
+    }
+
+    /**
+     * @brief Enables batched delivery.
+     *
+     * Samples are collected into a contiguous buffer that is delivered when it holds batch_size
+     * samples, or fewer if the first one would otherwise wait longer than max_latency. Since a
+     * sample arrives every period(), the latency bound becomes a sample count here and no clock
+     * is read per sample. A partial batch is delivered by stop(). Call before start().
+     *
+     * @param batch_size The largest number of samples per batch; 0 disables batching.
+     * @param max_latency The longest the first sample of a batch waits for its delivery.
+     */
+    void set_batching(std::size_t batch_size, std::chrono::nanoseconds max_latency = std::chrono::milliseconds(10)) {
+        batch_size_ = batch_size;
+        const std::chrono::nanoseconds sample_period = period();
+        if (batch_size_ > 0 && sample_period.count() > 0) {
+            const auto within_latency = static_cast<std::size_t>(max_latency / sample_period) + 1;
+            batch_size_ = std::min(batch_size_, within_latency);
+        }
+        batch_.clear();
+        batch_.reserve(batch_size_);
+    }
+
+    /**
+     * @brief Connects a slot to the sensor's batch signal.
+     *
+     * The span is only valid during the call.
+     *
+     * @param slot The slot to connect.
+     */
+    boost::signals2::connection connect_batch(const typename BatchSignalType::slot_type& slot) {
+        has_batch_connections_.store(true);
+        return batch_signal_.connect(slot);
+    }
+
+    /**
+     * @brief Adds a batch subscriber that is never disconnected, called without locking.
+     *
+     * @param slot The slot to add; the span it gets is only valid during the call.
+     */
+    void subscribe_batch(std::function<void(std::span<const T>)> slot) {
+        batch_slots_.connect(std::move(slot));
+    }
+
 protected:
     /**
      * @brief Generates sensor data.
@@ -90,27 +205,79 @@ protected:
     virtual T generate_data() = 0;
 
     /**
-     * @brief Schedules the next data read operation.
+     * @brief Schedules the next data read operation on the sensor's own timer.
      *
-     * Derived classes can override this to customize data acquisition intervals.
+     * Waits for the timer's current expiry, reads, then re-arms the same timer one period later
+     * (from the previous expiry, so the rate does not drift). Derived classes can override this
+     * to customize data acquisition intervals.
      */
     virtual void schedule_read() {
         if (!running_.load()) return;
 
-        // Example: Generate data every second
-        timer_ = std::make_unique<boost::asio::steady_timer>(io_context_, std::chrono::seconds(1));
-        timer_->async_wait([this](const boost::system::error_code& ec) {
-            if (!ec && running_.load()) {
-                T data = generate_data();
-                signal_(data);
+        timer_.async_wait([this](const boost::system::error_code& ec) {
+            // An aborted wait may complete after the sensor is destroyed: do not touch it then
+            if (ec) return;
+            if (running_.load()) {
+                read();
+                timer_.expires_at(timer_.expiry() + period_);
                 schedule_read();
             }
         });
     }
 
+    /**
+     * @brief Generates one reading and emits it.
+     */
+    void read() {
+        if (!running_.load()) return;
+
+        T data = generate_data();
+        emit(data);
+    }
+
+    /**
+     * @brief Delivers a sample to the per-sample subscribers and adds it to the batch, if batching.
+     */
+    void emit(const T& data) {
+        slots_(data);
+        if (has_connections_.load(std::memory_order_relaxed)) {
+            signal_(data);
+        }
+        if (batch_size_ == 0) return;
+
+        batch_.push_back(data);
+        if (batch_.size() >= batch_size_) {
+            flush_batch();
+        }
+    }
+
+    /**
+     * @brief Delivers the buffered samples, if any, to the batch subscribers.
+     */
+    void flush_batch() {
+        if (batch_.empty()) return;
+
+        const std::span<const T> samples(batch_);
+        batch_slots_(samples);
+        if (has_batch_connections_.load(std::memory_order_relaxed)) {
+            batch_signal_(samples);
+        }
+        batch_.clear();
+    }
+
     boost::asio::io_context& io_context_; ///< Reference to io_context for asynchronous operations
     SignalType signal_;                    ///< Signal to emit sensor data
-    std::unique_ptr<boost::asio::steady_timer> timer_; ///< Timer for scheduling data reads
+    BatchSignalType batch_signal_;         ///< Signal to emit batches of sensor data
+    SlotList<const T&> slots_;             ///< Per-sample subscribers that never disconnect
+    SlotList<std::span<const T>> batch_slots_; ///< Batch subscribers that never disconnect
+    std::atomic<bool> has_connections_{false};       ///< Whether signal_ ever had a slot
+    std::atomic<bool> has_batch_connections_{false}; ///< Whether batch_signal_ ever had a slot
+    std::size_t batch_size_ = 0;           ///< Samples per batch within the latency bound; 0 when not batching
+    std::vector<T> batch_;                 ///< Samples of the batch being collected
+    boost::asio::steady_timer timer_;      ///< Timer for scheduling data reads, re-armed every period
+    TimerWheel* wheel_ = nullptr;          ///< Shared wheel driving the reads instead of timer_, if any
+    TimerWheel::TaskId wheel_task_ = 0;    ///< The sensor's task on the wheel
+    std::chrono::nanoseconds period_;      ///< Sampling period
     std::atomic<bool> running_;            ///< Flag indicating if the sensor is running
 };
 
@@ -124,9 +291,19 @@ public:
      * @brief Constructs a TemperatureSensor.
      *
      * @param io_ctx The io_context for asynchronous operations.
+     * @param period The sampling period.
      */
-    TemperatureSensor(boost::asio::io_context& io_ctx)
-        : Sensor(io_ctx), generator_(rd_()), distribution_(20.0, 5.0) {}
+    TemperatureSensor(boost::asio::io_context& io_ctx, std::chrono::nanoseconds period = std::chrono::seconds(1))
+        : Sensor(io_ctx, period), generator_(rd_()), distribution_(20.0, 5.0) {}
+
+    /**
+     * @brief Constructs a TemperatureSensor that ticks from a shared TimerWheel.
+     *
+     * @param wheel The wheel to schedule the readings on.
+     * @param period The sampling period.
+     */
+    TemperatureSensor(TimerWheel& wheel, std::chrono::nanoseconds period = std::chrono::seconds(1))
+        : Sensor(wheel, period), generator_(rd_()), distribution_(20.0, 5.0) {}
 
     /**
      * @brief Generates temperature data.
@@ -152,9 +329,19 @@ public:
      * @brief Constructs a HumiditySensor.
      *
      * @param io_ctx The io_context for asynchronous operations.
+     * @param period The sampling period.
+     */
+    HumiditySensor(boost::asio::io_context& io_ctx, std::chrono::nanoseconds period = std::chrono::seconds(1))
+        : Sensor(io_ctx, period), generator_(rd_()), distribution_(30, 70) {}
+
+    /**
+     * @brief Constructs a HumiditySensor that ticks from a shared TimerWheel.
+     *
+     * @param wheel The wheel to schedule the readings on.
+     * @param period The sampling period.
      */
-    HumiditySensor(boost::asio::io_context& io_ctx)
-        : Sensor(io_ctx), generator_(rd_()), distribution_(30, 70) {}
+    HumiditySensor(TimerWheel& wheel, std::chrono::nanoseconds period = std::chrono::seconds(1))
+        : Sensor(wheel, period), generator_(rd_()), distribution_(30, 70) {}
 
     /**
      * @brief Generates humidity data.
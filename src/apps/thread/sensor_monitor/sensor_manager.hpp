@@ -3,22 +3,46 @@
 
 #include <boost/thread/thread.hpp>
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <functional>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <iostream>
 #include "sensor.hpp"
+#include "timer_wheel.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 
 /**
  * @brief Manages multiple sensors, handling their initialization and threading.
+ *
+ * Sensors run on shards: one io_context per core, each run by a single thread pinned to that
+ * core. A sensor is placed on a shard by hashing its id (get_io_context(id) or
+ * get_timer_wheel(id)), so all of its readings and emissions run on one thread, one after the
+ * other. Slots connected to a single sensor therefore never run concurrently and need no
+ * locking, and a sensor's state stays in one core's cache.
  */
 class SensorManager {
 public:
     /**
      * @brief Constructs a SensorManager.
+     *
+     * @param shard_count The number of shards; 0 means one per CPU the process may run on.
      */
-    SensorManager()
-        : io_context_(), work_guard_(boost::asio::make_work_guard(io_context_)), thread_group_() {}
+    explicit SensorManager(std::size_t shard_count = 0) {
+        const std::vector<int> cpus = usable_cpus();
+        if (shard_count == 0) {
+            shard_count = cpus.size();
+        }
+        for (std::size_t i = 0; i < shard_count; ++i) {
+            shards_.push_back(std::make_unique<Shard>(cpus[i % cpus.size()]));
+        }
+    }
 
     /**
      * @brief Destructor that stops all sensors and joins threads.
@@ -30,55 +54,133 @@ public:
     /**
      * @brief Adds a sensor to the manager.
      *
-     * @param sensor The sensor to add.
+     * @param sensor The sensor to add, built on one of the manager's io_contexts or timer wheels.
      */
     void add_sensor(std::shared_ptr<SensorBase> sensor) {
         sensors_.push_back(sensor);
     }
 
     /**
-     * @brief Starts all sensors and the io_context.
+     * @brief Starts the shard threads and all sensors.
+     *
+     * The threads start right away; each sensor is started on its own shard.
      */
     void start_all() {
-        // Start all sensors
-        for (auto& sensor : sensors_) {
-            sensor->start();
+        for (auto& shard : shards_) {
+            thread_group_.create_thread([shard = shard.get()]() {
+                pin_current_thread(shard->cpu);
+                shard->io_context.run();
+            });
         }
 
-        // Start the io_context in separate threads
-        int num_threads = boost::thread::hardware_concurrency();
-        for (int i = 0; i < num_threads; ++i) {
-            thread_group_.create_thread([this]() {
-                io_context_.run();
-            });
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        for (auto& sensor : sensors_) {
+            boost::asio::post(sensor->get_io_context(), [sensor]() { sensor->start(); });
         }
     }
 
     /**
-     * @brief Stops all sensors and the io_context.
+     * @brief Stops all sensors and the io_contexts.
+     *
+     * Each shard stops its sensors itself, so that a sensor never stops halfway through a reading,
+     * then stops its io_context once the cancelled waits have run.
      */
     void stop_all() {
-        // Stop all sensors
-        for (auto& sensor : sensors_) {
-            sensor->stop();
+        for (auto& shard : shards_) {
+            boost::asio::post(shard->io_context, [this, shard = shard.get()]() {
+                for (auto& sensor : sensors_) {
+                    if (&sensor->get_io_context() == &shard->io_context) {
+                        sensor->stop();
+                    }
+                }
+                // Queued behind the handlers of the waits cancelled above
+                boost::asio::post(shard->io_context, [shard]() { shard->io_context.stop(); });
+            });
+            shard->work_guard.reset();
         }
 
-        // Stop the io_context
-        work_guard_.reset();
-        io_context_.stop();
-
         // Join all threads
         thread_group_.join_all();
     }
 
-    boost::asio::io_context& get_io_context() {
-        return io_context_;
+    /**
+     * @brief Returns the shard a sensor id is assigned to.
+     */
+    std::size_t shard_of(std::string_view sensor_id) const {
+        return std::hash<std::string_view>{}(sensor_id) % shards_.size();
+    }
+
+    std::size_t shard_count() const {
+        return shards_.size();
+    }
+
+    /**
+     * @brief Provides the io_context of the shard a sensor id is assigned to.
+     */
+    boost::asio::io_context& get_io_context(std::string_view sensor_id) {
+        return shards_[shard_of(sensor_id)]->io_context;
+    }
+
+    /**
+     * @brief Provides the timer wheel (1 ms resolution) of the shard a sensor id is assigned to.
+     */
+    TimerWheel& get_timer_wheel(std::string_view sensor_id) {
+        return shards_[shard_of(sensor_id)]->timer_wheel;
     }
 
 private:
-    boost::asio::io_context io_context_;                           ///< io_context for asynchronous operations
-    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_; ///< Work guard to keep io_context running
+    /**
+     * @brief One core's io_context, run by a single thread pinned to that core.
+     */
+    struct Shard {
+        explicit Shard(int cpu_id)
+            : cpu(cpu_id), io_context(1), work_guard(boost::asio::make_work_guard(io_context)), timer_wheel(io_context) {}
+
+        int cpu;                                                  ///< CPU the shard's thread is pinned to
+        boost::asio::io_context io_context;                       ///< io_context for the shard's sensors
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard; ///< Keeps io_context running
+        TimerWheel timer_wheel;                                   ///< One timer ticking the shard's wheel-driven sensors
+    };
+
+    /**
+     * @brief Lists the CPUs the process may run on.
+     */
+    static std::vector<int> usable_cpus() {
+        std::vector<int> cpus;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &set)) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+#endif
+        if (cpus.empty()) {
+            const int count = std::max(1u, boost::thread::hardware_concurrency());
+            for (int cpu = 0; cpu < count; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+
+    /**
+     * @brief Restricts the calling thread to one CPU; a no-op where unsupported.
+     */
+    static void pin_current_thread(int cpu) {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)cpu;
+#endif
+    }
+
+    std::vector<std::unique_ptr<Shard>> shards_;                   ///< One io_context and thread per core
     boost::thread_group thread_group_;                             ///< Group managing all threads
     std::vector<std::shared_ptr<SensorBase>> sensors_;            ///< Collection of sensors
 };
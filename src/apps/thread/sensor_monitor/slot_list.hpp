@@ -0,0 +1,82 @@
+#ifndef SENSOR_MONITOR_SLOT_LIST_HPP
+#define SENSOR_MONITOR_SLOT_LIST_HPP
+
+#include <atomic>
+#include <functional>
+
+
+/**
+ * @brief A lock-free, append-only list of slots for subscribers that never disconnect.
+ *
+ * Emitting walks a linked list with acquire loads: no mutex, no snapshot of the connection list
+ * and no reference counting, unlike boost::signals2. The price is that slots cannot be removed;
+ * they live as long as the list. Slots may be connected while other threads emit, and are
+ * called in the order they were connected.
+ *
+ * @tparam Args The argument types passed to every slot.
+ */
+template <typename... Args>
+class SlotList {
+public:
+    using SlotType = std::function<void(Args...)>;
+
+    SlotList() = default;
+
+    ~SlotList() {
+        Node* node = head_.load(std::memory_order_acquire);
+        while (node) {
+            Node* next = node->next.load(std::memory_order_acquire);
+            delete node;
+            node = next;
+        }
+    }
+
+    SlotList(const SlotList&) = delete;
+    SlotList& operator=(const SlotList&) = delete;
+
+    /**
+     * @brief Appends a slot to the list.
+     *
+     * @param slot The slot to connect.
+     */
+    void connect(SlotType slot) {
+        Node* node = new Node{std::move(slot), {nullptr}};
+        std::atomic<Node*>* link = &head_;
+        for (;;) {
+            Node* next = nullptr;
+            if (link->compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_acquire)) {
+                return;
+            }
+            if (next) {
+                link = &next->next; // Someone appended here first: move on to the new tail
+            }
+        }
+    }
+
+    /**
+     * @brief Calls every slot with the given arguments.
+     */
+    void operator()(Args... args) const {
+        for (const Node* node = head_.load(std::memory_order_acquire); node;
+             node = node->next.load(std::memory_order_acquire)) {
+            node->slot(args...);
+        }
+    }
+
+    /**
+     * @brief Checks whether no slot is connected.
+     */
+    bool empty() const noexcept {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        SlotType slot;             ///< The connected callable
+        std::atomic<Node*> next;   ///< The slot connected after this one
+    };
+
+    std::atomic<Node*> head_{nullptr}; ///< The first slot connected
+};
+
+#endif // SENSOR_MONITOR_SLOT_LIST_HPP
@@ -0,0 +1,227 @@
+#ifndef SENSOR_MONITOR_STATS_AGGREGATOR_HPP
+#define SENSOR_MONITOR_STATS_AGGREGATOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "slot_list.hpp"
+
+
+/**
+ * @brief Statistics of one window of samples.
+ */
+struct WindowSummary {
+    std::uint64_t first_sample; ///< Index of the window's first sample since the aggregator started
+    std::size_t count;          ///< Number of samples in the window
+    double min;                 ///< Smallest sample
+    double max;                 ///< Largest sample
+    double mean;                ///< Arithmetic mean
+    double variance;            ///< Population variance
+    double p50;                 ///< Median (nearest rank)
+    double p90;                 ///< 90th percentile (nearest rank)
+    double p99;                 ///< 99th percentile (nearest rank)
+};
+
+
+/**
+ * @brief Aggregates a sensor's samples into window summaries and publishes only those.
+ *
+ * Windows are counted in samples, which for a sensor with a fixed period is a fixed duration.
+ * With hop == window the windows tumble (each sample is in one summary); with a smaller hop they
+ * slide, publishing a summary of the last window samples every hop samples.
+ *
+ * Samples are stored as one contiguous column of doubles, overwritten in place, so a summary
+ * reduces a flat array: min, max and sum run in independent lanes that the compiler turns into
+ * SIMD instructions, then the variance is taken in a second pass around the mean for accuracy.
+ * Percentiles come from nth_element on a reused scratch copy.
+ *
+ * Feed it from one sensor, e.g. with subscribe_batch(); like the sensor's slots, it is not
+ * locked, and relies on the sensor's readings running on one thread.
+ *
+ * @tparam T The type of data the sensor produces; converted to double.
+ */
+template <typename T>
+class StatsAggregator {
+public:
+    using SummarySlot = std::function<void(const WindowSummary&)>;
+
+    /**
+     * @brief Constructs a StatsAggregator.
+     *
+     * @param window The number of samples per window.
+     * @param hop The number of samples between summaries; 0 or window for tumbling windows.
+     * @throws std::invalid_argument if window is zero or hop is larger than window.
+     */
+    explicit StatsAggregator(std::size_t window, std::size_t hop = 0)
+        : window_(window), hop_(hop == 0 ? window : hop), values_(window), scratch_(window), next_summary_(window) {
+        if (window_ == 0 || hop_ > window_) {
+            throw std::invalid_argument("StatsAggregator needs a window of at least one sample and a hop no larger than it.");
+        }
+    }
+
+    /**
+     * @brief Adds a subscriber for the window summaries; it is never disconnected.
+     *
+     * @param slot The slot to add.
+     */
+    void subscribe(SummarySlot slot) {
+        slots_.connect(std::move(slot));
+    }
+
+    /**
+     * @brief Adds one sample, publishing a summary if it completes a window.
+     */
+    void add(const T& value) {
+        values_[head_] = static_cast<double>(value);
+        head_ = head_ + 1 == window_ ? 0 : head_ + 1;
+        if (++total_ == next_summary_) {
+            publish();
+        }
+    }
+
+    /**
+     * @brief Adds a batch of samples, publishing a summary for every window they complete.
+     */
+    void add(std::span<const T> samples) {
+        while (!samples.empty()) {
+            const std::size_t count = std::min({samples.size(), window_ - head_,
+                                                static_cast<std::size_t>(next_summary_ - total_)});
+            double* column = values_.data() + head_;
+            for (std::size_t i = 0; i < count; ++i) {
+                column[i] = static_cast<double>(samples[i]);
+            }
+            head_ = head_ + count == window_ ? 0 : head_ + count;
+            total_ += count;
+            samples = samples.subspan(count);
+            if (total_ == next_summary_) {
+                publish();
+            }
+        }
+    }
+
+    /**
+     * @brief Retrieves the number of samples added so far.
+     */
+    std::uint64_t total() const {
+        return total_;
+    }
+
+    std::size_t window() const {
+        return window_;
+    }
+
+    std::size_t hop() const {
+        return hop_;
+    }
+
+private:
+    static constexpr std::size_t LANES = 8; ///< Independent accumulators per reduction
+
+    /**
+     * @brief Summarizes the full column (the order of the samples does not matter) and publishes it.
+     */
+    void publish() {
+        next_summary_ += hop_;
+
+        WindowSummary summary{};
+        summary.first_sample = total_ - window_;
+        summary.count = window_;
+        reduce(values_.data(), window_, summary);
+
+        std::copy(values_.begin(), values_.end(), scratch_.begin());
+        summary.p50 = percentile(0.50, 0);
+        summary.p90 = percentile(0.90, rank(0.50) + 1);
+        summary.p99 = percentile(0.99, rank(0.90) + 1);
+
+        slots_(summary);
+    }
+
+    /**
+     * @brief Computes min, max, mean and variance of values[0, n).
+     */
+    static void reduce(const double* values, std::size_t n, WindowSummary& summary) {
+        double lo[LANES];
+        double hi[LANES];
+        double sum[LANES];
+        for (std::size_t lane = 0; lane < LANES; ++lane) {
+            lo[lane] = std::numeric_limits<double>::infinity();
+            hi[lane] = -std::numeric_limits<double>::infinity();
+            sum[lane] = 0.0;
+        }
+        std::size_t i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            for (std::size_t lane = 0; lane < LANES; ++lane) {
+                const double x = values[i + lane];
+                lo[lane] = x < lo[lane] ? x : lo[lane];
+                hi[lane] = x > hi[lane] ? x : hi[lane];
+                sum[lane] += x;
+            }
+        }
+        for (std::size_t lane = 0; i < n; ++i, ++lane) {
+            lo[lane] = std::min(lo[lane], values[i]);
+            hi[lane] = std::max(hi[lane], values[i]);
+            sum[lane] += values[i];
+        }
+        summary.min = *std::min_element(lo, lo + LANES);
+        summary.max = *std::max_element(hi, hi + LANES);
+        summary.mean = combine(sum) / static_cast<double>(n);
+
+        double squares[LANES] = {};
+        i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            for (std::size_t lane = 0; lane < LANES; ++lane) {
+                const double deviation = values[i + lane] - summary.mean;
+                squares[lane] += deviation * deviation;
+            }
+        }
+        for (std::size_t lane = 0; i < n; ++i, ++lane) {
+            const double deviation = values[i] - summary.mean;
+            squares[lane] += deviation * deviation;
+        }
+        summary.variance = combine(squares) / static_cast<double>(n);
+    }
+
+    static double combine(const double (&lanes)[LANES]) {
+        double total = 0.0;
+        for (double lane : lanes) {
+            total += lane;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Index of the nearest-rank p-th percentile among window_ sorted samples.
+     */
+    std::size_t rank(double p) const {
+        const auto position = static_cast<std::size_t>(std::ceil(p * static_cast<double>(window_)));
+        return position == 0 ? 0 : position - 1;
+    }
+
+    /**
+     * @brief Selects the p-th percentile in scratch_, whose elements before from are all smaller.
+     */
+    double percentile(double p, std::size_t from) {
+        const std::size_t index = rank(p);
+        from = std::min(from, index);
+        std::nth_element(scratch_.begin() + static_cast<std::ptrdiff_t>(from),
+                         scratch_.begin() + static_cast<std::ptrdiff_t>(index), scratch_.end());
+        return scratch_[index];
+    }
+
+    const std::size_t window_;                  ///< Samples per window
+    const std::size_t hop_;                     ///< Samples between summaries
+    std::vector<double> values_;                ///< The last window_ samples, as one column
+    std::vector<double> scratch_;               ///< Copy of values_ reordered for percentiles
+    std::size_t head_ = 0;                      ///< Slot of the next sample in values_
+    std::uint64_t total_ = 0;                   ///< Samples added so far
+    std::uint64_t next_summary_;                ///< Value of total_ at which the next summary is due
+    SlotList<const WindowSummary&> slots_;      ///< Subscribers to the summaries
+};
+
+#endif // SENSOR_MONITOR_STATS_AGGREGATOR_HPP
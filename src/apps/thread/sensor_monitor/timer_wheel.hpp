@@ -0,0 +1,200 @@
+#ifndef SENSOR_MONITOR_TIMER_WHEEL_HPP
+#define SENSOR_MONITOR_TIMER_WHEEL_HPP
+
+#include <boost/asio.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+
+/**
+ * @brief A hashed timing wheel that runs many periodic tasks off one steady_timer.
+ *
+ * The wheel has a fixed number of slots and one timer that ticks at a fixed resolution. Each tick
+ * runs the tasks of the current slot that are due and files each of them into the slot of its next
+ * run. Ten thousand sensors then cost one pending timer in the io_context instead of ten thousand
+ * heap entries, and rescheduling a task is a push_back into a slot whose storage is reused.
+ *
+ * Periods are rounded up to whole ticks. The timer is armed while there are tasks; a tick that
+ * fires late runs the ticks it missed. Tasks run one after the other on the thread that runs the
+ * tick, under the wheel's lock, so cancel() from another thread waits for a running tick to finish.
+ */
+class TimerWheel {
+public:
+    using TaskId = std::uint64_t;
+    using Clock = boost::asio::steady_timer::clock_type;
+
+    /**
+     * @brief Constructs a TimerWheel.
+     *
+     * @param io_ctx The io_context that runs the ticks.
+     * @param tick The resolution of the wheel.
+     * @param slot_count The number of slots; periods up to slot_count ticks take one lap.
+     */
+    TimerWheel(boost::asio::io_context& io_ctx,
+               std::chrono::nanoseconds tick = std::chrono::milliseconds(1),
+               std::size_t slot_count = 1024)
+        : io_context_(io_ctx), timer_(io_ctx), tick_(tick), slots_(slot_count) {
+        if (tick_.count() <= 0 || slot_count == 0) {
+            throw std::invalid_argument("TimerWheel needs a positive tick and at least one slot.");
+        }
+    }
+
+    ~TimerWheel() {
+        boost::system::error_code ec;
+        timer_.cancel(ec);
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Runs a callback every period, starting one period from now.
+     *
+     * @param period The interval between runs, rounded up to whole ticks.
+     * @param callback The task to run.
+     * @return The id to pass to cancel().
+     */
+    TaskId schedule_every(std::chrono::nanoseconds period, std::function<void()> callback) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        const std::uint64_t ticks =
+            std::max<std::int64_t>(1, (period.count() + tick_.count() - 1) / tick_.count());
+        const TaskId id = next_id_++;
+        tasks_.emplace(id, Task{ticks, std::move(callback)});
+        file(id, ticks);
+        if (!armed_) {
+            armed_ = true;
+            next_tick_ = Clock::now() + tick_;
+            arm();
+        }
+        return id;
+    }
+
+    /**
+     * @brief Stops a task; once this returns, the task is not running and will not run again.
+     *
+     * May be called from the task itself.
+     *
+     * @return true if the task was scheduled, false if the id is unknown or already cancelled.
+     */
+    bool cancel(TaskId id) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (id == running_id_) {
+            running_cancelled_ = true; // Erased when its callback returns
+            return true;
+        }
+        return tasks_.erase(id) > 0; // Its slot entry is dropped when the slot comes up
+    }
+
+    /**
+     * @brief Retrieves the number of scheduled tasks.
+     */
+    std::size_t size() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return tasks_.size();
+    }
+
+    std::chrono::nanoseconds tick() const {
+        return tick_;
+    }
+
+    boost::asio::io_context& get_io_context() {
+        return io_context_;
+    }
+
+private:
+    struct Task {
+        std::uint64_t period_ticks;     ///< Interval in ticks
+        std::function<void()> callback; ///< The task itself
+    };
+
+    struct Entry {
+        TaskId id;             ///< Task to run
+        std::uint64_t due;     ///< Tick to run it at; later laps wait in the same slot
+    };
+
+    /**
+     * @brief Files a task into the slot delay ticks ahead. Caller holds the lock.
+     */
+    void file(TaskId id, std::uint64_t delay) {
+        const std::uint64_t due = current_tick_ + delay;
+        slots_[due % slots_.size()].push_back(Entry{id, due});
+    }
+
+    void arm() {
+        timer_.expires_at(next_tick_);
+        timer_.async_wait([this](const boost::system::error_code& ec) {
+            if (!ec) {
+                on_timer();
+            }
+        });
+    }
+
+    void on_timer() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        const auto now = Clock::now();
+        while (next_tick_ <= now) {
+            advance();
+            next_tick_ += tick_;
+        }
+        if (tasks_.empty()) {
+            armed_ = false;
+            return;
+        }
+        arm();
+    }
+
+    /**
+     * @brief Moves to the next tick and runs the tasks due in it. Caller holds the lock.
+     */
+    void advance() {
+        ++current_tick_;
+        auto& slot = slots_[current_tick_ % slots_.size()];
+        // Tasks may file into this very slot while it is being walked; they go to the swapped-in storage
+        firing_.swap(slot);
+        for (const Entry& entry : firing_) {
+            if (entry.due > current_tick_) {
+                slot.push_back(entry); // A later lap
+                continue;
+            }
+            auto task = tasks_.find(entry.id);
+            if (task == tasks_.end()) {
+                continue; // Cancelled
+            }
+            const std::uint64_t period = task->second.period_ticks;
+            running_id_ = entry.id;
+            running_cancelled_ = false;
+            task->second.callback();
+            running_id_ = NO_TASK;
+            if (running_cancelled_) {
+                tasks_.erase(entry.id);
+            } else {
+                file(entry.id, period);
+            }
+        }
+        firing_.clear();
+    }
+
+    static constexpr TaskId NO_TASK = 0;
+
+    boost::asio::io_context& io_context_;            ///< io_context running the ticks
+    boost::asio::steady_timer timer_;                ///< The one timer behind every task
+    const std::chrono::nanoseconds tick_;            ///< Resolution of the wheel
+    mutable std::recursive_mutex mutex_;             ///< Guards the tasks; recursive for calls from tasks
+    std::unordered_map<TaskId, Task> tasks_;         ///< Scheduled tasks by id
+    std::vector<std::vector<Entry>> slots_;          ///< Entries filed by due tick modulo slot count
+    std::vector<Entry> firing_;                      ///< Storage of the slot being walked
+    std::uint64_t current_tick_ = 0;                 ///< Ticks advanced so far
+    Clock::time_point next_tick_;                    ///< When the next tick is due
+    TaskId next_id_ = 1;                             ///< Id of the next task; 0 is NO_TASK
+    TaskId running_id_ = NO_TASK;                    ///< Task whose callback is running
+    bool running_cancelled_ = false;                 ///< Whether that task cancelled itself
+    bool armed_ = false;                             ///< Whether the timer is pending
+};
+
+#endif // SENSOR_MONITOR_TIMER_WHEEL_HPP
@@ -0,0 +1,96 @@
+// bench_bulk_operations.cpp
+//
+// Producer/consumer throughput of element-at-a-time push_back()/pop_front() versus
+// push_back_bulk()/pop_front_bulk() on SafeBoundedQueue and SafeDeque.
+// The argument is the batch size used by both sides.
+//
+// ./bench_bulk_operations --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <container/safe_bounded_queue.hpp>
+#include <container/safe_deque.hpp>
+
+namespace {
+
+constexpr int ITEMS_PER_ITERATION = 100000;
+
+template <typename Queue>
+Queue make_queue() {
+    if constexpr (std::is_constructible_v<Queue, size_t>) {
+        return Queue(4096);
+    } else {
+        return Queue();
+    }
+}
+
+template <typename Queue>
+void BM_SingleElement(benchmark::State& state) {
+    auto queue = make_queue<Queue>();
+    const int batch = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        std::thread producer([&]() {
+            for (int i = 0; i < ITEMS_PER_ITERATION; i += batch) {
+                for (int j = 0; j < batch; ++j) {
+                    queue.push_back(i + j);
+                }
+            }
+        });
+
+        int value = 0;
+        for (int i = 0; i < ITEMS_PER_ITERATION; ++i) {
+            queue.pop_front(value);
+            benchmark::DoNotOptimize(value);
+        }
+        producer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ITEMS_PER_ITERATION);
+}
+
+template <typename Queue>
+void BM_Bulk(benchmark::State& state) {
+    auto queue = make_queue<Queue>();
+    const int batch = static_cast<int>(state.range(0));
+    std::vector<int> input(batch);
+    std::vector<int> output;
+    output.reserve(batch);
+
+    for (auto _ : state) {
+        std::thread producer([&]() {
+            for (int i = 0; i < ITEMS_PER_ITERATION; i += batch) {
+                queue.push_back_bulk(input.begin(), input.end());
+            }
+        });
+
+        int received = 0;
+        while (received < ITEMS_PER_ITERATION) {
+            output.clear();
+            received += static_cast<int>(
+                queue.pop_front_bulk(std::back_inserter(output), batch, std::chrono::milliseconds(1000)));
+            benchmark::DoNotOptimize(output.data());
+        }
+        producer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ITEMS_PER_ITERATION);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_SingleElement, cxx_lab::SafeBoundedQueue<int>)
+    ->Arg(10)->Arg(100)->Arg(1000)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Bulk, cxx_lab::SafeBoundedQueue<int>)
+    ->Arg(10)->Arg(100)->Arg(1000)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SingleElement, cxx_lab::SafeDeque<int>)
+    ->Arg(10)->Arg(100)->Arg(1000)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Bulk, cxx_lab::SafeDeque<int>)
+    ->Arg(10)->Arg(100)->Arg(1000)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
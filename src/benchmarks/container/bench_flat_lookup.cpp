@@ -0,0 +1,111 @@
+// bench_flat_lookup.cpp
+//
+// Lookups in mostly-read sets and maps of a few thousand integer keys, node-based backend
+// (std::set / std::map) against the flat sorted-vector backend (FlatSet / FlatMap). The
+// BM_LowerBound pair isolates the search itself: std::lower_bound against the vectorized
+// search FlatSet uses for integral keys, both on the same sorted vector.
+//
+// ./bench_flat_lookup --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <container/flat_map.hpp>
+#include <container/flat_set.hpp>
+#include <container/safe_map.hpp>
+#include <container/safe_set.hpp>
+
+namespace {
+
+constexpr std::size_t NUM_PROBES = 4096;
+
+/**
+ * @brief size distinct keys spread over four times their count, and probes half of which hit.
+ */
+struct Keys {
+    std::vector<std::int64_t> keys;
+    std::vector<std::int64_t> probes;
+
+    explicit Keys(std::size_t size) {
+        std::mt19937_64 rng(size);
+        std::set<std::int64_t> unique;
+        while (unique.size() < size) {
+            unique.insert(static_cast<std::int64_t>(rng() % (size * 4)));
+        }
+        keys.assign(unique.begin(), unique.end());
+        for (std::size_t i = 0; i < NUM_PROBES; ++i) {
+            probes.push_back(i % 2 == 0 ? keys[rng() % size] : static_cast<std::int64_t>(rng() % (size * 4)));
+        }
+    }
+};
+
+template <typename Set>
+void BM_SetContains(benchmark::State& state) {
+    Keys data(static_cast<std::size_t>(state.range(0)));
+    Set set;
+    for (auto key : data.keys) {
+        set.insert(key);
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.contains(data.probes[i++ % NUM_PROBES]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+void BM_MapTryAt(benchmark::State& state) {
+    Keys data(static_cast<std::size_t>(state.range(0)));
+    Map map;
+    for (auto key : data.keys) {
+        map.insert({key, std::to_string(key)});
+    }
+    std::string value;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.try_at(data.probes[i++ % NUM_PROBES], value));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LowerBound_Std(benchmark::State& state) {
+    Keys data(static_cast<std::size_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::lower_bound(data.keys.begin(), data.keys.end(), data.probes[i++ % NUM_PROBES]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LowerBound_Flat(benchmark::State& state) {
+    Keys data(static_cast<std::size_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cxx_lab::detail::flat_lower_bound(data.keys.begin(), data.keys.end(),
+                                                                   data.probes[i++ % NUM_PROBES], std::less<std::int64_t>()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+using NodeSet = cxx_lab::SafeSet<std::int64_t>;
+using FlatSafeSet = cxx_lab::SafeSet<std::int64_t, cxx_lab::FlatSet<std::int64_t>>;
+using NodeMap = cxx_lab::SafeMap<std::int64_t, std::string>;
+using FlatSafeMap = cxx_lab::SafeMap<std::int64_t, std::string, cxx_lab::FlatMap<std::int64_t, std::string>>;
+
+BENCHMARK_TEMPLATE(BM_SetContains, NodeSet)->RangeMultiplier(4)->Range(256, 16384);
+BENCHMARK_TEMPLATE(BM_SetContains, FlatSafeSet)->RangeMultiplier(4)->Range(256, 16384);
+BENCHMARK_TEMPLATE(BM_MapTryAt, NodeMap)->RangeMultiplier(4)->Range(256, 16384);
+BENCHMARK_TEMPLATE(BM_MapTryAt, FlatSafeMap)->RangeMultiplier(4)->Range(256, 16384);
+BENCHMARK(BM_LowerBound_Std)->RangeMultiplier(4)->Range(256, 16384);
+BENCHMARK(BM_LowerBound_Flat)->RangeMultiplier(4)->Range(256, 16384);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+// bench_move_semantics.cpp
+//
+// Cost of handing std::string and std::vector<char> payloads through the safe containers
+// by copy (push_back(const T&)) versus by move (push_back(T&&)) and in-place construction
+// (emplace_back). Pops move the element out in every case. The argument is the payload size.
+//
+// ./bench_move_semantics --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <container/safe_bounded_queue.hpp>
+#include <container/safe_circular_queue.hpp>
+#include <container/safe_deque.hpp>
+
+namespace {
+
+template <typename Queue>
+Queue make_queue() {
+    if constexpr (std::is_constructible_v<Queue, size_t>) {
+        return Queue(1024);
+    } else {
+        return Queue();
+    }
+}
+
+template <typename Payload>
+Payload make_payload(size_t size) {
+    return Payload(size, 'x');
+}
+
+template <typename Queue>
+void BM_PushCopy(benchmark::State& state) {
+    using Payload = typename Queue::value_type;
+    auto queue = make_queue<Queue>();
+    Payload out;
+
+    for (auto _ : state) {
+        Payload payload = make_payload<Payload>(state.range(0));
+        queue.push_back(payload);
+        queue.pop_front(out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Queue>
+void BM_PushMove(benchmark::State& state) {
+    using Payload = typename Queue::value_type;
+    auto queue = make_queue<Queue>();
+    Payload out;
+
+    for (auto _ : state) {
+        Payload payload = make_payload<Payload>(state.range(0));
+        queue.push_back(std::move(payload));
+        queue.pop_front(out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Queue>
+void BM_Emplace(benchmark::State& state) {
+    using Payload = typename Queue::value_type;
+    auto queue = make_queue<Queue>();
+    Payload out;
+
+    for (auto _ : state) {
+        queue.emplace_back(static_cast<size_t>(state.range(0)), 'x');
+        queue.pop_front(out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+#define CXX_LAB_MOVE_BENCHMARKS(Queue)                                          \
+    BENCHMARK_TEMPLATE(BM_PushCopy, Queue)->RangeMultiplier(16)->Range(64, 64 << 10); \
+    BENCHMARK_TEMPLATE(BM_PushMove, Queue)->RangeMultiplier(16)->Range(64, 64 << 10); \
+    BENCHMARK_TEMPLATE(BM_Emplace, Queue)->RangeMultiplier(16)->Range(64, 64 << 10)
+
+CXX_LAB_MOVE_BENCHMARKS(cxx_lab::SafeBoundedQueue<std::string>);
+CXX_LAB_MOVE_BENCHMARKS(cxx_lab::SafeBoundedQueue<std::vector<char>>);
+CXX_LAB_MOVE_BENCHMARKS(cxx_lab::SafeDeque<std::string>);
+CXX_LAB_MOVE_BENCHMARKS(cxx_lab::SafeDeque<std::vector<char>>);
+CXX_LAB_MOVE_BENCHMARKS(cxx_lab::SafeCircularQueue<std::string>);
+CXX_LAB_MOVE_BENCHMARKS(cxx_lab::SafeCircularQueue<std::vector<char>>);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,48 @@
+// bench_mpmc_bounded_queue.cpp
+//
+// Messages per second through the mutex-based SafeBoundedQueue versus the lock-free
+// MpmcBoundedQueue. Half of the benchmark threads produce and half consume.
+//
+// ./bench_mpmc_bounded_queue --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+
+#include <container/mpmc_bounded_queue.hpp>
+#include <container/safe_bounded_queue.hpp>
+
+namespace {
+
+constexpr int ITEMS_PER_ITERATION = 1000;
+constexpr size_t QUEUE_CAPACITY = 1024;
+
+template <typename Queue>
+void BM_ProducersConsumers(benchmark::State& state) {
+    static Queue queue(QUEUE_CAPACITY);
+    const bool producer = (state.thread_index() % 2) == 0;
+
+    for (auto _ : state) {
+        if (producer) {
+            for (int i = 0; i < ITEMS_PER_ITERATION; ++i) {
+                queue.push_back(i);
+            }
+        } else {
+            int value = 0;
+            for (int i = 0; i < ITEMS_PER_ITERATION; ++i) {
+                queue.pop_front(value);
+                benchmark::DoNotOptimize(value);
+            }
+        }
+    }
+
+    // Every thread runs the same number of iterations, so the queue is drained here
+    state.SetItemsProcessed(state.iterations() * ITEMS_PER_ITERATION);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, cxx_lab::SafeBoundedQueue<int>)
+    ->ThreadRange(2, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, cxx_lab::MpmcBoundedQueue<int>)
+    ->ThreadRange(2, 32)->UseRealTime();
+
+BENCHMARK_MAIN();
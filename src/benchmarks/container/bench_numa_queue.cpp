@@ -0,0 +1,77 @@
+// bench_numa_queue.cpp
+//
+// Throughput of NumaQueue against one shared SafeBoundedQueue, with a producer and a consumer
+// per node. The nodes come from NumaTopology::simulated(), so this runs on a single-node machine:
+// each thread uses its node's sub-queue through the *_at() calls. On such a machine the benchmark
+// shows what splitting the lock buys (less contention, stealing only when a node runs dry), not
+// the cross-socket traffic a real multi-node host also saves; run it there with detect() for that.
+//
+// ./bench_numa_queue --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+
+#include <container/fixed_ring.hpp>
+#include <container/numa_queue.hpp>
+#include <container/safe_bounded_queue.hpp>
+
+namespace {
+
+constexpr std::size_t CAPACITY_PER_NODE = 1024;
+constexpr int ITEMS_PER_PRODUCER = 20000;
+
+// Runs one producer and one consumer per node; push(node, i) and pop(node, item) do the work
+template <typename Push, typename Pop>
+void run_pairs(std::size_t nodes, Push&& push, Pop&& pop) {
+    std::vector<std::thread> threads;
+    for (std::size_t node = 0; node < nodes; ++node) {
+        threads.emplace_back([&, node]() {
+            for (int i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                push(node, i);
+            }
+        });
+        threads.emplace_back([&, node]() {
+            int item = 0;
+            for (int i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                pop(node, item);
+            }
+            benchmark::DoNotOptimize(item);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void BM_SharedQueue(benchmark::State& state) {
+    const auto nodes = static_cast<std::size_t>(state.range(0));
+    cxx_lab::SafeBoundedQueue<int, cxx_lab::FixedRing<int>> queue(CAPACITY_PER_NODE * nodes);
+    for (auto _ : state) {
+        run_pairs(nodes, [&](std::size_t, int i) { queue.push_back(i); },
+                  [&](std::size_t, int& item) { queue.pop_front(item); });
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(nodes) * ITEMS_PER_PRODUCER);
+}
+
+void BM_NumaQueue(benchmark::State& state) {
+    const auto nodes = static_cast<std::size_t>(state.range(0));
+    cxx_lab::NumaQueue<int> queue(CAPACITY_PER_NODE, cxx_lab::NumaTopology::simulated(nodes));
+    std::size_t stolen = 0;
+    for (auto _ : state) {
+        run_pairs(nodes, [&](std::size_t node, int i) { queue.push_at(node, i); },
+                  [&](std::size_t node, int& item) { queue.pop_at(node, item); });
+    }
+    for (std::size_t node = 0; node < nodes; ++node) {
+        stolen += queue.stolen_count(node);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(nodes) * ITEMS_PER_PRODUCER);
+    state.counters["stolen"] = benchmark::Counter(static_cast<double>(stolen), benchmark::Counter::kAvgIterations);
+}
+
+} // namespace
+
+BENCHMARK(BM_SharedQueue)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NumaQueue)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
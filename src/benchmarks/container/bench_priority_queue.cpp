@@ -0,0 +1,114 @@
+// bench_priority_queue.cpp
+//
+// Tail latency of urgent messages through a saturated queue. A bulk producer keeps a
+// 1024-slot queue full of low-priority messages, an urgent producer sends a high-priority
+// message every 50us, and one consumer spends 1us on each message, so the queue stays full.
+// In the FIFO SafeBoundedQueue an urgent message waits behind everything already queued;
+// SafeBoundedPriorityQueue pops it next. The p50/p99/p999 counters are the urgent messages' push-to-pop latencies.
+//
+// ./bench_priority_queue --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <container/safe_bounded_priority_queue.hpp>
+#include <container/safe_bounded_queue.hpp>
+
+namespace {
+
+constexpr std::size_t CAPACITY = 1024;
+constexpr int URGENT_MESSAGES = 200;
+constexpr auto URGENT_PERIOD = std::chrono::microseconds(50);
+constexpr auto WORK_PER_MESSAGE = std::chrono::microseconds(1);
+
+using Clock = std::chrono::steady_clock;
+
+struct Message {
+    std::uint32_t priority = 0; ///< 0 for bulk traffic, 1 for urgent messages
+    Clock::time_point sent;
+
+    bool operator<(const Message& other) const { return priority < other.priority; }
+};
+
+struct FifoQueue {
+    cxx_lab::SafeBoundedQueue<Message> queue{CAPACITY};
+
+    bool push(const Message& message, std::chrono::milliseconds timeout) { return queue.push_back(message, timeout); }
+    void pop(Message& message) { queue.pop_front(message); }
+};
+
+template <std::size_t Arity>
+struct PriorityQueue {
+    cxx_lab::SafeBoundedPriorityQueue<Message, std::less<Message>, Arity> queue{CAPACITY};
+
+    bool push(const Message& message, std::chrono::milliseconds timeout) { return queue.push(message, timeout); }
+    void pop(Message& message) { queue.pop(message); }
+};
+
+double percentile(std::vector<double>& samples, double p) {
+    auto nth = samples.begin() + static_cast<std::ptrdiff_t>(p * (samples.size() - 1));
+    std::nth_element(samples.begin(), nth, samples.end());
+    return *nth;
+}
+
+template <typename Queue>
+void BM_UrgentLatency(benchmark::State& state) {
+    std::vector<double> latencies;
+    latencies.reserve(URGENT_MESSAGES * 16);
+
+    for (auto _ : state) {
+        Queue queue;
+        std::atomic<bool> stop{false};
+
+        std::thread bulk([&]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                queue.push(Message{0, Clock::now()}, std::chrono::milliseconds(1));
+            }
+        });
+        // Let the bulk producer saturate the queue first
+        for (std::size_t i = 0; i < CAPACITY; ++i) {
+            std::this_thread::yield();
+        }
+        std::thread urgent([&]() {
+            auto next = Clock::now();
+            for (int i = 0; i < URGENT_MESSAGES; ++i) {
+                next += URGENT_PERIOD;
+                std::this_thread::sleep_until(next);
+                while (!queue.push(Message{1, Clock::now()}, std::chrono::milliseconds(1))) {
+                }
+            }
+        });
+
+        Message message;
+        for (int received = 0; received < URGENT_MESSAGES;) {
+            queue.pop(message);
+            for (auto done = Clock::now() + WORK_PER_MESSAGE; Clock::now() < done;) {
+            }
+            if (message.priority > 0) {
+                latencies.push_back(std::chrono::duration<double, std::nano>(Clock::now() - message.sent).count());
+                ++received;
+            }
+        }
+        stop = true;
+        urgent.join();
+        // The bulk producer may be blocked on a full queue; its push times out
+        bulk.join();
+    }
+
+    state.counters["urgent_p50_ns"] = percentile(latencies, 0.50);
+    state.counters["urgent_p99_ns"] = percentile(latencies, 0.99);
+    state.counters["urgent_p999_ns"] = percentile(latencies, 0.999);
+}
+
+BENCHMARK_TEMPLATE(BM_UrgentLatency, FifoQueue)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_UrgentLatency, PriorityQueue<2>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_UrgentLatency, PriorityQueue<4>)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,424 @@
+// bench_safe_containers.cpp
+//
+// Regression suite for the lock-based containers: SafeBoundedQueue (over std::deque and over
+// FixedRing), SafeCircularQueue, SafeDeque, SafeMap, SafeMultiMap and SafeSet.
+//
+// Every benchmark moves ITEMS_PER_ITERATION payloads from P producer threads to C consumer
+// threads. Queues are drained by whichever consumer pops first; the keyed containers assign
+// every key to one consumer, which waits for it (at() on SafeMap, extract() on the others).
+// The benchmark name carries the container and payload size in bytes; the arguments are
+//
+//   producers, consumers, mode (0 = try_* retried with yield, 1 = timed, 2 = blocking)
+//
+// Besides items_per_second and bytes_per_second, each run reports push_p50_ns, push_p99_ns,
+// push_p999_ns and the same for pop_ (lookup for keyed containers). An operation's latency
+// includes its retries and waits. SafeCircularQueue overwrites its oldest element when a
+// timed or blocking push finds it full, so it also reports the items dropped per iteration.
+//
+// ./bench_safe_containers --benchmark_format=json --benchmark_out=safe_containers.json
+// ./bench_safe_containers --benchmark_filter='SafeMap.*mode:2'
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <container/safe_bounded_queue.hpp>
+#include <container/safe_circular_queue.hpp>
+#include <container/safe_deque.hpp>
+#include <container/safe_map.hpp>
+#include <container/safe_multimap.hpp>
+#include <container/safe_set.hpp>
+
+namespace {
+
+constexpr std::uint64_t ITEMS_PER_ITERATION = 20000;
+constexpr size_t QUEUE_CAPACITY = 1024;
+constexpr std::chrono::milliseconds TIMEOUT(1);
+constexpr std::uint64_t POISON = std::numeric_limits<std::uint64_t>::max(); ///< Stops a queue consumer
+
+enum class Mode { Try = 0, Timed = 1, Blocking = 2 };
+
+/**
+ * @brief A sequence number padded to Bytes bytes.
+ */
+template <size_t Bytes>
+struct Payload {
+    static_assert(Bytes >= sizeof(std::uint64_t), "Payload must hold its sequence number");
+
+    Payload() = default;
+    explicit Payload(std::uint64_t s) : seq(s) {}
+
+    bool operator<(const Payload& other) const {
+        return seq < other.seq;
+    }
+
+    std::uint64_t seq = 0;
+    std::array<char, Bytes - sizeof(std::uint64_t)> padding{};
+};
+
+/**
+ * @brief Calls attempt until it reports success, yielding in between.
+ */
+template <typename Attempt>
+void retry(Attempt&& attempt) {
+    while (!attempt()) {
+        std::this_thread::yield();
+    }
+}
+
+// =====================
+// Workloads
+// =====================
+
+/**
+ * @brief Producers push_back() and consumers pop_front() sequence numbers until they see POISON.
+ */
+template <typename Queue, size_t Bytes>
+struct QueueWorkload {
+    static constexpr bool keyed = false;
+    static constexpr size_t payload_bytes = Bytes;
+
+    static std::unique_ptr<Queue> make() {
+        if constexpr (std::is_constructible_v<Queue, size_t>) {
+            return std::make_unique<Queue>(QUEUE_CAPACITY);
+        } else {
+            return std::make_unique<Queue>();
+        }
+    }
+
+    static void produce(Queue& queue, Mode mode, std::uint64_t seq) {
+        const Payload<Bytes> item(seq);
+        switch (mode) {
+        case Mode::Try:
+            retry([&]() { return queue.try_push_back(item); });
+            break;
+        case Mode::Timed:
+            retry([&]() { return queue.push_back(item, TIMEOUT); });
+            break;
+        case Mode::Blocking:
+            queue.push_back(item);
+            break;
+        }
+    }
+
+    static std::uint64_t consume(Queue& queue, Mode mode) {
+        Payload<Bytes> item;
+        switch (mode) {
+        case Mode::Try:
+            retry([&]() { return queue.try_pop_front(item); });
+            break;
+        case Mode::Timed:
+            retry([&]() { return queue.pop_front(item, TIMEOUT); });
+            break;
+        case Mode::Blocking:
+            queue.pop_front(item);
+            break;
+        }
+        return item.seq;
+    }
+};
+
+/**
+ * @brief Producers insert key seq, the consumer owning seq looks it up with at().
+ */
+template <size_t Bytes>
+struct SafeMapWorkload {
+    using Map = cxx_lab::SafeMap<std::uint64_t, Payload<Bytes>>;
+    static constexpr bool keyed = true;
+    static constexpr size_t payload_bytes = Bytes;
+
+    static std::unique_ptr<Map> make() {
+        return std::make_unique<Map>();
+    }
+
+    static void produce(Map& map, Mode mode, std::uint64_t seq) {
+        const typename Map::value_type value(seq, Payload<Bytes>(seq));
+        switch (mode) {
+        case Mode::Try:
+            retry([&]() { return map.try_insert(value); });
+            break;
+        case Mode::Timed:
+            retry([&]() { return map.insert(value, TIMEOUT); });
+            break;
+        case Mode::Blocking:
+            map.insert(value);
+            break;
+        }
+    }
+
+    static void consume(Map& map, Mode mode, std::uint64_t seq) {
+        Payload<Bytes> item;
+        switch (mode) {
+        case Mode::Try:
+            retry([&]() { return map.try_at(seq, item); });
+            break;
+        case Mode::Timed:
+            retry([&]() { return map.at(seq, item, TIMEOUT); });
+            break;
+        case Mode::Blocking:
+            item = map.at(seq);
+            break;
+        }
+        benchmark::DoNotOptimize(item);
+    }
+};
+
+/**
+ * @brief Producers insert key seq, the consumer owning seq extracts it.
+ *
+ * SafeMultiMap::extract() without a timeout does not wait for the key, so the blocking mode
+ * retries it like the other modes.
+ */
+template <size_t Bytes>
+struct SafeMultiMapWorkload {
+    using Map = cxx_lab::SafeMultiMap<std::uint64_t, Payload<Bytes>>;
+    static constexpr bool keyed = true;
+    static constexpr size_t payload_bytes = Bytes;
+
+    static std::unique_ptr<Map> make() {
+        return std::make_unique<Map>();
+    }
+
+    static void produce(Map& map, Mode mode, std::uint64_t seq) {
+        const typename Map::value_type value(seq, Payload<Bytes>(seq));
+        switch (mode) {
+        case Mode::Try:
+            retry([&]() { return map.try_insert(value); });
+            break;
+        case Mode::Timed:
+            retry([&]() { return map.insert(value, TIMEOUT); });
+            break;
+        case Mode::Blocking:
+            map.insert(value);
+            break;
+        }
+    }
+
+    static void consume(Map& map, Mode mode, std::uint64_t seq) {
+        std::vector<Payload<Bytes>> items;
+        switch (mode) {
+        case Mode::Try:
+            retry([&]() { return map.try_extract(seq, items) > 0; });
+            break;
+        case Mode::Timed:
+            retry([&]() { return map.extract(seq, items, TIMEOUT) > 0; });
+            break;
+        case Mode::Blocking:
+            retry([&]() { return map.extract(seq, items) > 0; });
+            break;
+        }
+        benchmark::DoNotOptimize(items.data());
+    }
+};
+
+/**
+ * @brief Producers insert the payload seq, the consumer owning seq extracts it.
+ */
+template <size_t Bytes>
+struct SafeSetWorkload {
+    using Set = cxx_lab::SafeSet<Payload<Bytes>>;
+    static constexpr bool keyed = true;
+    static constexpr size_t payload_bytes = Bytes;
+
+    static std::unique_ptr<Set> make() {
+        return std::make_unique<Set>();
+    }
+
+    static void produce(Set& set, Mode mode, std::uint64_t seq) {
+        const Payload<Bytes> item(seq);
+        switch (mode) {
+        case Mode::Try:
+            retry([&]() { return set.try_insert(item); });
+            break;
+        case Mode::Timed:
+            retry([&]() { return set.insert(item, TIMEOUT); });
+            break;
+        case Mode::Blocking:
+            set.insert(item);
+            break;
+        }
+    }
+
+    static void consume(Set& set, Mode mode, std::uint64_t seq) {
+        const Payload<Bytes> item(seq);
+        switch (mode) {
+        case Mode::Try:
+            retry([&]() { return set.try_extract(item); });
+            break;
+        case Mode::Timed:
+            retry([&]() { return set.extract(item, TIMEOUT); });
+            break;
+        case Mode::Blocking:
+            set.extract(item);
+            break;
+        }
+    }
+};
+
+template <size_t Bytes>
+using SafeBoundedQueueWorkload = QueueWorkload<cxx_lab::SafeBoundedQueue<Payload<Bytes>>, Bytes>;
+
+template <size_t Bytes>
+using SafeBoundedQueueRingWorkload = QueueWorkload<cxx_lab::SafeBoundedQueue<Payload<Bytes>, cxx_lab::FixedRing<Payload<Bytes>>>, Bytes>;
+
+template <size_t Bytes>
+using SafeCircularQueueWorkload = QueueWorkload<cxx_lab::SafeCircularQueue<Payload<Bytes>>, Bytes>;
+
+template <size_t Bytes>
+using SafeDequeWorkload = QueueWorkload<cxx_lab::SafeDeque<Payload<Bytes>>, Bytes>;
+
+// =====================
+// Harness
+// =====================
+
+/**
+ * @brief Runs op and appends its duration in nanoseconds to samples.
+ */
+template <typename Op>
+void record(std::vector<std::uint32_t>& samples, Op&& op) {
+    const auto start = std::chrono::steady_clock::now();
+    op();
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    samples.push_back(static_cast<std::uint32_t>(std::min<std::int64_t>(ns, std::numeric_limits<std::uint32_t>::max())));
+}
+
+/**
+ * @brief Returns the fraction-th smallest sample (e.g. 0.99 for p99); reorders samples.
+ */
+double percentile(std::vector<std::uint32_t>& samples, double fraction) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    auto nth = samples.begin() + static_cast<std::ptrdiff_t>(fraction * static_cast<double>(samples.size() - 1));
+    std::nth_element(samples.begin(), nth, samples.end());
+    return static_cast<double>(*nth);
+}
+
+void report_latency(benchmark::State& state, const char* prefix, std::vector<std::uint32_t>& samples) {
+    const std::string name(prefix);
+    state.counters[name + "_p50_ns"] = percentile(samples, 0.50);
+    state.counters[name + "_p99_ns"] = percentile(samples, 0.99);
+    state.counters[name + "_p999_ns"] = percentile(samples, 0.999);
+}
+
+template <typename Workload>
+void BM_ProducersConsumers(benchmark::State& state) {
+    const auto producers = static_cast<std::uint64_t>(state.range(0));
+    const auto consumers = static_cast<std::uint64_t>(state.range(1));
+    const auto mode = static_cast<Mode>(state.range(2));
+
+    std::vector<std::uint32_t> push_latency;
+    std::vector<std::uint32_t> pop_latency;
+    std::uint64_t consumed_total = 0;
+
+    for (auto _ : state) {
+        auto container = Workload::make();
+        std::vector<std::vector<std::uint32_t>> push_samples(producers);
+        std::vector<std::vector<std::uint32_t>> pop_samples(consumers);
+        std::vector<std::uint64_t> consumed(consumers, 0);
+
+        std::vector<std::thread> producer_threads;
+        for (std::uint64_t p = 0; p < producers; ++p) {
+            producer_threads.emplace_back([&, p]() {
+                push_samples[p].reserve(ITEMS_PER_ITERATION / producers + 1);
+                for (std::uint64_t seq = p; seq < ITEMS_PER_ITERATION; seq += producers) {
+                    record(push_samples[p], [&]() { Workload::produce(*container, mode, seq); });
+                }
+            });
+        }
+
+        std::vector<std::thread> consumer_threads;
+        for (std::uint64_t c = 0; c < consumers; ++c) {
+            consumer_threads.emplace_back([&, c]() {
+                pop_samples[c].reserve(ITEMS_PER_ITERATION / consumers + 1);
+                if constexpr (Workload::keyed) {
+                    for (std::uint64_t seq = c; seq < ITEMS_PER_ITERATION; seq += consumers) {
+                        record(pop_samples[c], [&]() { Workload::consume(*container, mode, seq); });
+                        ++consumed[c];
+                    }
+                } else {
+                    for (;;) {
+                        std::uint64_t seq = 0;
+                        record(pop_samples[c], [&]() { seq = Workload::consume(*container, mode); });
+                        if (seq == POISON) {
+                            pop_samples[c].pop_back();
+                            break;
+                        }
+                        ++consumed[c];
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : producer_threads) {
+            thread.join();
+        }
+        if constexpr (!Workload::keyed) {
+            for (std::uint64_t c = 0; c < consumers; ++c) {
+                Workload::produce(*container, Mode::Blocking, POISON);
+            }
+        }
+        for (auto& thread : consumer_threads) {
+            thread.join();
+        }
+
+        for (auto& samples : push_samples) {
+            push_latency.insert(push_latency.end(), samples.begin(), samples.end());
+        }
+        for (auto& samples : pop_samples) {
+            pop_latency.insert(pop_latency.end(), samples.begin(), samples.end());
+        }
+        for (std::uint64_t count : consumed) {
+            consumed_total += count;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(consumed_total));
+    state.SetBytesProcessed(static_cast<int64_t>(consumed_total * Workload::payload_bytes));
+    report_latency(state, "push", push_latency);
+    report_latency(state, "pop", pop_latency);
+    if constexpr (!Workload::keyed) {
+        const std::uint64_t pushed = static_cast<std::uint64_t>(state.iterations()) * ITEMS_PER_ITERATION;
+        state.counters["dropped"] = benchmark::Counter(static_cast<double>(pushed - consumed_total),
+                                                       benchmark::Counter::kAvgIterations);
+    }
+}
+
+void Sweep(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"producers", "consumers", "mode"});
+    for (int producers : {1, 4}) {
+        for (int consumers : {1, 4}) {
+            for (int mode : {0, 1, 2}) {
+                bench->Args({producers, consumers, mode});
+            }
+        }
+    }
+    bench->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+} // namespace
+
+// Payload sizes: one word, a few cache lines, a page
+#define BENCH_PAYLOAD_SIZES(Workload)                                  \
+    BENCHMARK_TEMPLATE(BM_ProducersConsumers, Workload<8>)->Apply(Sweep);   \
+    BENCHMARK_TEMPLATE(BM_ProducersConsumers, Workload<256>)->Apply(Sweep); \
+    BENCHMARK_TEMPLATE(BM_ProducersConsumers, Workload<4096>)->Apply(Sweep)
+
+BENCH_PAYLOAD_SIZES(SafeBoundedQueueWorkload);
+BENCH_PAYLOAD_SIZES(SafeBoundedQueueRingWorkload);
+BENCH_PAYLOAD_SIZES(SafeCircularQueueWorkload);
+BENCH_PAYLOAD_SIZES(SafeDequeWorkload);
+BENCH_PAYLOAD_SIZES(SafeMapWorkload);
+BENCH_PAYLOAD_SIZES(SafeMultiMapWorkload);
+BENCH_PAYLOAD_SIZES(SafeSetWorkload);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,99 @@
+// bench_safe_map_waiters.cpp
+//
+// Time to satisfy 1000 threads blocked in at() on distinct keys when the keys are inserted
+// one by one. SafeMap wakes only the waiters of the inserted key; BroadcastWaitMap is the
+// single-condition-variable scheme SafeMap used before, where every insertion wakes every
+// waiter (O(waiters^2) wake-ups in total).
+//
+// ./bench_safe_map_waiters --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include <container/safe_map.hpp>
+
+namespace {
+
+constexpr int NUM_WAITERS = 1000;
+
+/**
+ * @brief Minimal map whose inserts wake all waiters through one condition variable.
+ */
+class BroadcastWaitMap {
+public:
+    bool insert(const std::pair<const int, int>& value) {
+        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        bool inserted = container_.insert(value).second;
+        if (inserted) {
+            not_empty_.notify_all();
+        }
+        return inserted;
+    }
+
+    bool at(int key, int& value, const std::chrono::milliseconds& timeout) const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (container_.find(key) == container_.end()) {
+            if (not_empty_.wait_until(lock, deadline) == std::cv_status::timeout) {
+                return false;
+            }
+        }
+        value = container_.find(key)->second;
+        return true;
+    }
+
+private:
+    mutable std::shared_timed_mutex mutex_;
+    mutable std::condition_variable_any not_empty_;
+    std::map<int, int> container_;
+};
+
+template <typename Map>
+void BM_DistinctKeyWaiters(benchmark::State& state) {
+    for (auto _ : state) {
+        Map map;
+        std::atomic<int> started{0};
+        std::vector<std::thread> waiters;
+        waiters.reserve(NUM_WAITERS);
+        for (int key = 0; key < NUM_WAITERS; ++key) {
+            waiters.emplace_back([&map, &started, key]() {
+                int value = 0;
+                started.fetch_add(1);
+                map.at(key, value, std::chrono::seconds(60));
+                benchmark::DoNotOptimize(value);
+            });
+        }
+        // Give the last threads time to block after announcing themselves
+        while (started.load() < NUM_WAITERS) {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int key = 0; key < NUM_WAITERS; ++key) {
+            map.insert({key, key});
+        }
+        for (auto& waiter : waiters) {
+            waiter.join();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * NUM_WAITERS);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_DistinctKeyWaiters, cxx_lab::SafeMap<int, int>)
+    ->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(5);
+BENCHMARK_TEMPLATE(BM_DistinctKeyWaiters, BroadcastWaitMap)
+    ->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(5);
+
+BENCHMARK_MAIN();
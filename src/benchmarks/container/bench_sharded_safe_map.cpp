@@ -0,0 +1,75 @@
+// bench_sharded_safe_map.cpp
+//
+// Operations per second of SafeMap versus ShardedSafeMap under a mixed workload.
+// The first argument is the percentage of reads (contains() lookups); the remaining operations alternate
+// between inserting and erasing random keys, so the map size stays roughly constant.
+//
+// ./bench_sharded_safe_map --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+#include <container/safe_map.hpp>
+#include <container/sharded_safe_map.hpp>
+
+namespace {
+
+constexpr std::uint64_t KEY_SPACE = 1 << 16;
+constexpr int OPS_PER_ITERATION = 1000;
+
+template <typename Map>
+Map& populated_map() {
+    static Map map;
+    static const bool populated = []() {
+        for (std::uint64_t key = 0; key < KEY_SPACE; key += 2) {
+            map.insert({key, key});
+        }
+        return true;
+    }();
+    (void)populated;
+    return map;
+}
+
+template <typename Map>
+void BM_MixedReadWrite(benchmark::State& state) {
+    Map& map = populated_map<Map>();
+    const auto read_percent = static_cast<std::uint64_t>(state.range(0));
+    std::uint64_t rng = 0x9E3779B97F4A7C15ULL * (state.thread_index() + 1);
+
+    for (auto _ : state) {
+        for (int i = 0; i < OPS_PER_ITERATION; ++i) {
+            // xorshift64: cheap enough not to dominate the measurement
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            const std::uint64_t key = rng % KEY_SPACE;
+            if ((rng >> 32) % 100 < read_percent) {
+                benchmark::DoNotOptimize(map.contains(key));
+            } else if ((rng >> 40) & 1) {
+                benchmark::DoNotOptimize(map.insert({key, key}));
+            } else {
+                benchmark::DoNotOptimize(map.erase(key));
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * OPS_PER_ITERATION);
+}
+
+void ReadRatiosAndThreads(benchmark::internal::Benchmark* b) {
+    for (int read_percent : {50, 90, 99}) {
+        b->Arg(read_percent);
+    }
+    b->ThreadRange(1, 32)->UseRealTime();
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_MixedReadWrite, cxx_lab::SafeMap<std::uint64_t, std::uint64_t>)
+    ->Apply(ReadRatiosAndThreads);
+BENCHMARK_TEMPLATE(BM_MixedReadWrite, cxx_lab::ShardedSafeMap<std::uint64_t, std::uint64_t>)
+    ->Apply(ReadRatiosAndThreads);
+BENCHMARK_TEMPLATE(BM_MixedReadWrite, cxx_lab::ShardedSafeMap<std::uint64_t, std::uint64_t, std::hash<std::uint64_t>, 64>)
+    ->Apply(ReadRatiosAndThreads);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,60 @@
+// bench_snapshot_map.cpp
+//
+// Lookups per second of SafeMap (shared lock per lookup) versus SnapshotMap (hazard-pointer
+// protected snapshot) for a read-mostly workload. With an argument of 1, thread 0 also
+// publishes one update per iteration, i.e. per 1000 lookups.
+//
+// ./bench_snapshot_map --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+
+#include <container/safe_map.hpp>
+#include <container/snapshot_map.hpp>
+
+namespace {
+
+constexpr int KEY_SPACE = 1024;
+constexpr int LOOKUPS_PER_ITERATION = 1000;
+
+template <typename Map>
+Map& populated_map() {
+    static Map map;
+    static const bool populated = []() {
+        for (int key = 0; key < KEY_SPACE; ++key) {
+            map.insert({key, key});
+        }
+        return true;
+    }();
+    (void)populated;
+    return map;
+}
+
+template <typename Map>
+void BM_ReadMostly(benchmark::State& state) {
+    Map& map = populated_map<Map>();
+    const bool writer = state.range(0) != 0 && state.thread_index() == 0;
+    int value = 0;
+    int key = state.thread_index();
+
+    for (auto _ : state) {
+        for (int i = 0; i < LOOKUPS_PER_ITERATION; ++i) {
+            key = (key + 7) % KEY_SPACE;
+            benchmark::DoNotOptimize(map.try_at(key, value));
+        }
+        if (writer) {
+            map.erase(KEY_SPACE);
+            map.insert({KEY_SPACE, value});
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_ReadMostly, cxx_lab::SafeMap<int, int>)
+    ->Arg(0)->Arg(1)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReadMostly, cxx_lab::SnapshotMap<int, int>)
+    ->Arg(0)->Arg(1)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,50 @@
+// bench_spsc_circular_queue.cpp
+//
+// Single-producer/single-consumer throughput of the mutex-based SafeCircularQueue
+// versus the wait-free SpscCircularQueue.
+//
+// ./bench_spsc_circular_queue --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <thread>
+
+#include <container/safe_circular_queue.hpp>
+#include <container/spsc_circular_queue.hpp>
+
+namespace {
+
+constexpr int ITEMS_PER_ITERATION = 100000;
+
+template <typename Queue>
+void BM_ProducerConsumer(benchmark::State& state) {
+    Queue queue(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        std::thread producer([&queue]() {
+            for (int i = 0; i < ITEMS_PER_ITERATION; ++i) {
+                // SafeCircularQueue::push_back() overwrites when full, so both queues use try_push_back()
+                while (!queue.try_push_back(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        int value = 0;
+        for (int i = 0; i < ITEMS_PER_ITERATION; ++i) {
+            queue.pop_front(value);
+            benchmark::DoNotOptimize(value);
+        }
+        producer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ITEMS_PER_ITERATION);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_ProducerConsumer, cxx_lab::SafeCircularQueue<int>)
+    ->Arg(64)->Arg(1024)->Arg(16384)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ProducerConsumer, cxx_lab::SpscCircularQueue<int>)
+    ->Arg(64)->Arg(1024)->Arg(16384)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+// bench_wait_policy.cpp
+//
+// Wakeup latency of the blocking pops under the two waiting policies. Two threads play
+// ping-pong through a pair of containers: each round trip is two push-to-wakeup hand-offs
+// to a thread that is blocked in pop. ConditionVariableWait parks in std::condition_variable(_any);
+// AtomicWait spins briefly on an epoch word and then parks on a futex. The "wakeup_us" counter is
+// half the round trip, i.e. one hand-off. Spinning needs a second CPU; on one CPU AtomicWait
+// parks right away and only saves the condition_variable_any bookkeeping.
+//
+// ./bench_wait_policy --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <thread>
+
+#include <container/safe_bounded_priority_queue.hpp>
+#include <container/safe_bounded_queue.hpp>
+#include <container/safe_circular_queue.hpp>
+#include <container/safe_deque.hpp>
+#include <container/wait_policy.hpp>
+
+namespace {
+
+constexpr int STOP = -1; ///< Tells the echo thread to exit
+
+template <typename Wait>
+struct Deque {
+    cxx_lab::SafeDeque<int, std::deque<int>, cxx_lab::NullContainerStats, Wait> queue;
+    void push(int v) { queue.push_back(v); }
+    void pop(int& v) { queue.pop_front(v); }
+};
+
+template <typename Wait>
+struct BoundedQueue {
+    cxx_lab::SafeBoundedQueue<int, std::deque<int>, cxx_lab::NullContainerStats, Wait> queue{16};
+    void push(int v) { queue.push_back(v); }
+    void pop(int& v) { queue.pop_front(v); }
+};
+
+template <typename Wait>
+struct CircularQueue {
+    cxx_lab::SafeCircularQueue<int, cxx_lab::NullContainerStats, Wait> queue{16};
+    void push(int v) { queue.push_back(v); }
+    void pop(int& v) { queue.pop_front(v); }
+};
+
+template <typename Wait>
+struct PriorityQueue {
+    cxx_lab::SafeBoundedPriorityQueue<int, std::less<int>, 4, Wait> queue{16};
+    void push(int v) { queue.push(v); }
+    void pop(int& v) { queue.pop(v); }
+};
+
+template <typename Queue>
+void BM_PingPong(benchmark::State& state) {
+    Queue ping;
+    Queue pong;
+    std::thread echo([&]() {
+        int value = 0;
+        for (;;) {
+            ping.pop(value);
+            if (value == STOP) {
+                break;
+            }
+            pong.push(value);
+        }
+    });
+
+    int value = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto _ : state) {
+        ping.push(1);
+        pong.pop(value);
+        benchmark::DoNotOptimize(value);
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    ping.push(STOP);
+    echo.join();
+
+    state.counters["wakeup_us"] = elapsed.count() / (2.0 * static_cast<double>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_PingPong, Deque<cxx_lab::ConditionVariableWait>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, Deque<cxx_lab::AtomicWait>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, BoundedQueue<cxx_lab::ConditionVariableWait>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, BoundedQueue<cxx_lab::AtomicWait>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, CircularQueue<cxx_lab::ConditionVariableWait>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, CircularQueue<cxx_lab::AtomicWait>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, PriorityQueue<cxx_lab::ConditionVariableWait>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, PriorityQueue<cxx_lab::AtomicWait>)->UseRealTime();
+
+BENCHMARK_MAIN();
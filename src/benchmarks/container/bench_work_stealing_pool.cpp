@@ -0,0 +1,96 @@
+// bench_work_stealing_pool.cpp
+//
+// Fork/join throughput: a recursive Fibonacci that posts one branch of every call above a
+// serial cutoff to the pool, on asio::thread_pool (one shared queue) versus WorkStealingPool
+// (per-worker deques). Both are driven through asio::post, so only the executor differs.
+// Arguments are the thread count and the cutoff; a smaller cutoff means more, smaller tasks.
+//
+// ./bench_work_stealing_pool --benchmark_format=json
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+#include <container/work_stealing_pool.hpp>
+
+namespace asio = boost::asio;
+
+namespace {
+
+constexpr int FIB_N = 27;
+
+std::uint64_t serial_fib(int n) {
+    return n < 2 ? static_cast<std::uint64_t>(n) : serial_fib(n - 1) + serial_fib(n - 2);
+}
+
+/**
+ * @brief Tracks the tasks of one fork/join run and the sum they accumulate.
+ */
+struct Join {
+    std::atomic<std::int64_t> pending{1};
+    std::atomic<std::int64_t> spawned{0};
+    std::atomic<std::uint64_t> sum{0};
+    int cutoff = 0;
+
+    void finish_one() {
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            pending.notify_all();
+        }
+    }
+};
+
+template <typename Pool>
+void fork_fib(Pool& pool, Join& join, int n) {
+    while (n >= join.cutoff) {
+        join.pending.fetch_add(1, std::memory_order_relaxed);
+        join.spawned.fetch_add(1, std::memory_order_relaxed);
+        asio::post(pool, [&pool, &join, n]() {
+            fork_fib(pool, join, n - 1);
+            join.finish_one();
+        });
+        n -= 2;
+    }
+    join.sum.fetch_add(serial_fib(n), std::memory_order_relaxed);
+}
+
+template <typename Pool>
+void BM_ForkJoin(benchmark::State& state) {
+    Pool pool(static_cast<std::size_t>(state.range(0)));
+    std::int64_t tasks = 0;
+    for (auto _ : state) {
+        Join join;
+        join.cutoff = static_cast<int>(state.range(1));
+        asio::post(pool, [&]() {
+            fork_fib(pool, join, FIB_N);
+            join.finish_one();
+        });
+        for (std::int64_t pending = join.pending.load(); pending != 0; pending = join.pending.load()) {
+            join.pending.wait(pending);
+        }
+        if (join.sum.load() != serial_fib(FIB_N)) {
+            state.SkipWithError("wrong result");
+        }
+        tasks = join.spawned.load();
+    }
+    state.counters["tasks"] = static_cast<double>(tasks);
+    pool.join();
+}
+
+void fork_join_args(benchmark::internal::Benchmark* bench) {
+    for (int threads : {1, 2, 4}) {
+        for (int cutoff : {8, 14}) {
+            bench->Args({threads, cutoff});
+        }
+    }
+    bench->ArgNames({"threads", "cutoff"})->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(BM_ForkJoin, asio::thread_pool)->Apply(fork_join_args);
+BENCHMARK_TEMPLATE(BM_ForkJoin, cxx_lab::WorkStealingPool)->Apply(fork_join_args);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,162 @@
+#ifndef CXX_LAB_ASYNC_WAIT_LIST_HPP
+#define CXX_LAB_ASYNC_WAIT_LIST_HPP
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <boost/asio/post.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace cxx_lab {
+
+namespace detail {
+
+/**
+ * @brief A FIFO of suspended asynchronous operations waiting for a container state change.
+ *
+ * This is the asynchronous counterpart of a condition variable: instead of a thread, a
+ * composed operation (`self` of asio::async_compose) is parked here, and waking it posts the
+ * operation to its own executor so it can retry. Parking and waking never run user code, so
+ * both are done while holding the owning container's mutex, which also makes the list itself
+ * safe without a lock of its own.
+ *
+ * Operations still parked when the list is destroyed are destroyed without being resumed, so a
+ * container must outlive the asynchronous operations started on it.
+ */
+class AsyncWaitList {
+public:
+    AsyncWaitList() = default;
+    AsyncWaitList(const AsyncWaitList&) = delete;
+    AsyncWaitList& operator=(const AsyncWaitList&) = delete;
+
+    /**
+     * @brief Parks a composed operation until the next wake-up.
+     *
+     * The caller must not touch the operation's state afterwards; it now lives in the list.
+     */
+    template <typename Self>
+    void park(Self&& self) {
+        waiters_.push_back(std::make_unique<Waiter<std::decay_t<Self>>>(std::forward<Self>(self)));
+    }
+
+    /**
+     * @brief Resumes up to count parked operations, oldest first.
+     *
+     * @return The number of operations resumed.
+     */
+    std::size_t wake(std::size_t count = 1) {
+        std::size_t woken = 0;
+        for (; woken < count && !waiters_.empty(); ++woken) {
+            auto waiter = std::move(waiters_.front());
+            waiters_.pop_front();
+            waiter->resume();
+        }
+        return woken;
+    }
+
+    /**
+     * @brief Resumes every parked operation.
+     */
+    void wake_all() {
+        wake(waiters_.size());
+    }
+
+    bool empty() const {
+        return waiters_.empty();
+    }
+
+private:
+    struct WaiterBase {
+        virtual ~WaiterBase() = default;
+        virtual void resume() = 0;
+    };
+
+    template <typename Self>
+    struct Waiter final : WaiterBase {
+        explicit Waiter(Self&& s) : self(std::move(s)) {}
+
+        void resume() override {
+            // Runs the operation again on its associated executor, never inline
+            boost::asio::post(std::move(self));
+        }
+
+        Self self;
+    };
+
+    std::deque<std::unique_ptr<WaiterBase>> waiters_; ///< Parked operations in arrival order
+};
+
+/**
+ * @brief Composed operation that retries an attempt until it succeeds, parking in between.
+ *
+ * `attempt(result, self)` runs under the container's lock and either stores the result and
+ * returns true, or parks `self` on an AsyncWaitList and returns false. The operation never
+ * completes from inside the initiating function; a first-try success is posted instead.
+ *
+ * @tparam Result The value the operation completes with, or void for `void(error_code)`.
+ * @tparam Attempt A callable `bool(std::optional<Result>&, Self&)` (or `bool(Self&)` for void).
+ *                 It must not use its own state after parking `self`, since it is moved along.
+ */
+template <typename Result, typename Attempt>
+class AsyncRetryOp {
+public:
+    explicit AsyncRetryOp(Attempt attempt) : attempt_(std::move(attempt)) {}
+
+    template <typename Self>
+    void operator()(Self& self) {
+        if (!result_) {
+            const bool initiating = !started_;
+            started_ = true;
+            if (!attempt_(result_, self)) {
+                return; // Parked until the container changes
+            }
+            if (initiating) {
+                boost::asio::post(std::move(self));
+                return;
+            }
+        }
+        self.complete(boost::system::error_code{}, std::move(*result_));
+    }
+
+private:
+    Attempt attempt_;
+    std::optional<Result> result_;
+    bool started_ = false;
+};
+
+template <typename Attempt>
+class AsyncRetryOp<void, Attempt> {
+public:
+    explicit AsyncRetryOp(Attempt attempt) : attempt_(std::move(attempt)) {}
+
+    template <typename Self>
+    void operator()(Self& self) {
+        if (!done_) {
+            const bool initiating = !started_;
+            started_ = true;
+            if (!attempt_(self)) {
+                return; // Parked until the container changes
+            }
+            done_ = true;
+            if (initiating) {
+                boost::asio::post(std::move(self));
+                return;
+            }
+        }
+        self.complete(boost::system::error_code{});
+    }
+
+private:
+    Attempt attempt_;
+    bool done_ = false;
+    bool started_ = false;
+};
+
+} // namespace detail
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_ASYNC_WAIT_LIST_HPP
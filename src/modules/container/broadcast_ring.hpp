@@ -0,0 +1,276 @@
+#ifndef CXX_LAB_BROADCAST_RING_HPP
+#define CXX_LAB_BROADCAST_RING_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <container/wait_policy.hpp>
+
+namespace cxx_lab {
+
+/**
+ * @brief A fixed-size ring that every subscriber reads in full: one writer side, many readers.
+ *
+ * Each pushed element gets the next sequence number and lands in slot sequence % capacity,
+ * overwriting the element capacity pushes older. Nothing is removed by reading: every Reader
+ * keeps its own cursor (the next sequence it wants), so each element is stored once however many
+ * subscribers there are. Pushes never block; a reader that falls more than capacity elements
+ * behind skips ahead to the oldest element still stored and counts the ones it missed.
+ *
+ * @code
+ * cxx_lab::BroadcastRing<Sample> ring(1024);
+ * auto reader = ring.subscribe();
+ * ring.push(sample);                  // producer
+ * reader.pop(sample, 10ms);           // each consumer, with its own reader
+ * reader.lag();                       // elements pushed but not yet read by this reader
+ * @endcode
+ *
+ * Pushes take the lock exclusively, reads take it shared, so readers do not serialize each other.
+ *
+ * @tparam T The type of elements stored in the ring.
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
+ */
+template <typename T, typename Wait = ConditionVariableWait>
+class BroadcastRing {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using sequence_type = std::uint64_t;
+    using condition_type = typename Wait::template condition_type<std::shared_timed_mutex>;
+
+    class Reader;
+
+    /**
+     * @brief Constructs a BroadcastRing with a specified capacity.
+     *
+     * @param capacity The number of most recent elements kept for the readers.
+     * @throws std::invalid_argument if capacity is zero.
+     */
+    explicit BroadcastRing(size_type capacity) : capacity_(capacity) {
+        if (capacity_ == 0) {
+            throw std::invalid_argument("Capacity must be greater than zero.");
+        }
+        slots_.reserve(capacity_);
+    }
+
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+
+    /**
+     * @brief Appends an element, overwriting the oldest one if the ring is full, and wakes the readers.
+     *
+     * @param value The element to push.
+     */
+    void push(const T& value) {
+        store([&](T& slot) { slot = value; }, [&]() { slots_.push_back(value); });
+    }
+
+    /**
+     * @brief Moves an element in, overwriting the oldest one if the ring is full, and wakes the readers.
+     *
+     * @param value The element to push.
+     */
+    void push(T&& value) {
+        store([&](T& slot) { slot = std::move(value); }, [&]() { slots_.push_back(std::move(value)); });
+    }
+
+    /**
+     * @brief Returns a reader positioned after the newest element: it sees only later pushes.
+     */
+    Reader subscribe() const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        return Reader(*this, head_);
+    }
+
+    /**
+     * @brief Returns a reader positioned at the oldest element still stored.
+     */
+    Reader subscribe_from_oldest() const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        return Reader(*this, oldest());
+    }
+
+    /**
+     * @brief Retrieves the number of elements pushed so far, i.e. the sequence of the next push.
+     */
+    sequence_type sequence() const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        return head_;
+    }
+
+    /**
+     * @brief Retrieves the number of elements currently stored (at most capacity()).
+     */
+    size_type size() const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        return slots_.size();
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+private:
+    template <typename Assign, typename Append>
+    void store(Assign&& assign, Append&& append) {
+        {
+            std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+            if (slots_.size() < capacity_) {
+                append();
+            } else {
+                assign(slots_[static_cast<size_type>(head_ % capacity_)]);
+            }
+            ++head_;
+        }
+        not_empty_.notify_all();
+    }
+
+    /**
+     * @brief Sequence of the oldest element still stored. Caller holds the lock.
+     */
+    sequence_type oldest() const {
+        return head_ - slots_.size();
+    }
+
+    const size_type capacity_;                    ///< Number of slots
+    mutable std::shared_timed_mutex mutex_;       ///< Exclusive for pushes, shared for reads
+    mutable condition_type not_empty_;            ///< Notified on every push
+    std::vector<T> slots_;                        ///< Element of sequence s is at s % capacity_
+    sequence_type head_ = 0;                      ///< Sequence of the next push
+};
+
+/**
+ * @brief One subscriber's cursor into a BroadcastRing.
+ *
+ * A Reader is used by one thread at a time; give each consumer its own (copies are independent
+ * cursors). The ring must outlive its readers.
+ */
+template <typename T, typename Wait>
+class BroadcastRing<T, Wait>::Reader {
+public:
+    /**
+     * @brief Copies the next element out without blocking.
+     *
+     * @param item Reference to store the element.
+     * @return true if an element was read, false if the reader is up to date.
+     */
+    bool try_pop(T& item) {
+        return try_read([&](const T& value) { item = value; });
+    }
+
+    /**
+     * @brief Copies the next element out, blocking up to the specified timeout.
+     *
+     * @param item Reference to store the element.
+     * @param timeout The maximum duration to wait for a new element.
+     * @return true if an element was read within the timeout, false otherwise.
+     */
+    bool pop(T& item, const std::chrono::milliseconds& timeout) {
+        return read(timeout, [&](const T& value) { item = value; });
+    }
+
+    /**
+     * @brief Copies the next element out, blocking until one is pushed.
+     *
+     * @param item Reference to store the element.
+     */
+    void pop(T& item) {
+        std::shared_lock<std::shared_timed_mutex> lock(ring_->mutex_);
+        ring_->not_empty_.wait(lock, [this]() { return next_ < ring_->head_; });
+        consume([&](const T& value) { item = value; });
+    }
+
+    /**
+     * @brief Passes the next element to func in place, without copying it and without blocking.
+     *
+     * func runs under the ring's shared lock: it must not push to the same ring.
+     *
+     * @param func A callable taking a const T&.
+     * @return true if an element was read, false if the reader is up to date.
+     */
+    template <typename F>
+    bool try_read(F&& func) {
+        std::shared_lock<std::shared_timed_mutex> lock(ring_->mutex_);
+        if (next_ == ring_->head_) {
+            return false;
+        }
+        consume(func);
+        return true;
+    }
+
+    /**
+     * @brief Passes the next element to func in place, blocking up to the specified timeout.
+     *
+     * @param timeout The maximum duration to wait for a new element.
+     * @param func A callable taking a const T&; runs under the ring's shared lock.
+     * @return true if an element was read within the timeout, false otherwise.
+     */
+    template <typename F>
+    bool read(const std::chrono::milliseconds& timeout, F&& func) {
+        std::shared_lock<std::shared_timed_mutex> lock(ring_->mutex_);
+        if (!ring_->not_empty_.wait_for(lock, timeout, [this]() { return next_ < ring_->head_; })) {
+            return false;
+        }
+        consume(func);
+        return true;
+    }
+
+    /**
+     * @brief Retrieves how far behind the newest element this reader is.
+     *
+     * @return The number of elements pushed and not yet read; more than capacity() means some
+     *         will be skipped.
+     */
+    sequence_type lag() const {
+        std::shared_lock<std::shared_timed_mutex> lock(ring_->mutex_);
+        return ring_->head_ - next_;
+    }
+
+    /**
+     * @brief Retrieves the number of elements this reader skipped because they were overwritten.
+     */
+    sequence_type missed() const noexcept {
+        return missed_;
+    }
+
+    /**
+     * @brief Retrieves the sequence of the next element this reader will read.
+     */
+    sequence_type position() const noexcept {
+        return next_;
+    }
+
+private:
+    friend class BroadcastRing;
+
+    Reader(const BroadcastRing& ring, sequence_type next) : ring_(&ring), next_(next) {}
+
+    /**
+     * @brief Skips overwritten elements, then reads the next one. Caller holds the ring's lock
+     *        and has checked that there is an element to read.
+     */
+    template <typename F>
+    void consume(F&& func) {
+        const sequence_type oldest = ring_->oldest();
+        if (next_ < oldest) {
+            missed_ += oldest - next_;
+            next_ = oldest;
+        }
+        func(ring_->slots_[static_cast<size_type>(next_ % ring_->capacity_)]);
+        ++next_;
+    }
+
+    const BroadcastRing* ring_; ///< The ring read from
+    sequence_type next_;        ///< Sequence of the next element to read
+    sequence_type missed_ = 0;  ///< Overwritten elements skipped so far
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_BROADCAST_RING_HPP
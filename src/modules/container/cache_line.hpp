@@ -0,0 +1,18 @@
+#ifndef CXX_LAB_CACHE_LINE_HPP
+#define CXX_LAB_CACHE_LINE_HPP
+
+#include <cstddef>
+
+namespace cxx_lab {
+
+/**
+ * @brief Size in bytes used to pad data that is written by different threads.
+ *
+ * std::hardware_destructive_interference_size is not stable across compiler flags
+ * (GCC warns when it is used in headers), so the common x86-64/AArch64 value is fixed here.
+ */
+inline constexpr std::size_t cache_line_size = 64;
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_CACHE_LINE_HPP
@@ -0,0 +1,202 @@
+#ifndef CXX_LAB_CHASE_LEV_DEQUE_HPP
+#define CXX_LAB_CHASE_LEV_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <container/cache_line.hpp>
+
+namespace cxx_lab {
+
+/**
+ * @brief A lock-free work-stealing deque (Chase and Lev, with the C11 memory orders of Lê et al.).
+ *
+ * One owner thread pushes and pops at the bottom (LIFO, so it keeps working on the most recently
+ * spawned, cache-hot task), while any number of thieves steal from the top (FIFO, so they take
+ * the oldest and usually largest pieces of work). The owner's push and pop touch only its own
+ * index unless the deque is down to its last element; thieves contend with each other through a
+ * single CAS on the top index.
+ *
+ * The buffer is a power-of-two ring that the owner doubles when it is full. Thieves may still be
+ * reading a replaced buffer, so old buffers are kept until the deque is destroyed (a deque that
+ * grew to n slots holds at most 2n slots in total).
+ *
+ * Elements are read speculatively by thieves before their CAS decides who owns them, so T must be
+ * trivially copyable; in practice it is a pointer to a task.
+ *
+ * @tparam T The element type; trivially copyable, typically a pointer.
+ */
+template <typename T>
+class ChaseLevDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "ChaseLevDeque elements are copied speculatively by thieves");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a ChaseLevDeque with room for at least the specified number of elements.
+     *
+     * @param capacity The initial capacity (rounded up to a power of two); the deque grows as needed.
+     * @throws std::invalid_argument if capacity is zero.
+     */
+    explicit ChaseLevDeque(size_type capacity = DEFAULT_CAPACITY) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than zero.");
+        }
+        size_type rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        buffers_.push_back(std::make_unique<Buffer>(rounded));
+        buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+    }
+
+    ChaseLevDeque(const ChaseLevDeque&) = delete;
+    ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+
+    // =====================
+    // Owner Operations
+    // =====================
+
+    /**
+     * @brief Pushes an element at the bottom. Owner thread only.
+     *
+     * @param value The element to push.
+     */
+    void push(T value) {
+        const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t top = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top > static_cast<std::int64_t>(buffer->mask)) {
+            buffer = grow(buffer, top, bottom);
+        }
+        buffer->put(bottom, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Pops the most recently pushed element. Owner thread only.
+     *
+     * @param value Reference to store the popped element.
+     * @return true if an element was popped, false if the deque is empty (or a thief took the last one).
+     */
+    bool pop(T& value) {
+        const std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed); // Empty
+            return false;
+        }
+        value = buffer->get(bottom);
+        if (top == bottom) {
+            // Last element: race the thieves for it
+            const bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // =====================
+    // Thief Operations
+    // =====================
+
+    /**
+     * @brief Steals the oldest element. Any thread.
+     *
+     * @param value Reference to store the stolen element.
+     * @return true if an element was stolen, false if the deque is empty or another thread won the race.
+     */
+    bool steal(T& value) {
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return false; // Empty
+        }
+        Buffer* buffer = buffer_.load(std::memory_order_acquire);
+        const T candidate = buffer->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false; // Lost the race to the owner or another thief
+        }
+        value = candidate;
+        return true;
+    }
+
+    // =====================
+    // Utility Methods
+    // =====================
+
+    /**
+     * @brief Returns the number of elements; only a hint while other threads operate on the deque.
+     */
+    size_type size() const {
+        const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the number of slots of the current buffer. Owner thread only.
+     */
+    size_type capacity() const {
+        return buffer_.load(std::memory_order_relaxed)->mask + 1;
+    }
+
+private:
+    static constexpr size_type DEFAULT_CAPACITY = 256; ///< Default initial capacity
+
+    /**
+     * @brief A power-of-two ring of atomic slots indexed by the unbounded top/bottom positions.
+     */
+    struct Buffer {
+        explicit Buffer(size_type size) : mask(size - 1), slots(new std::atomic<T>[size]) {}
+
+        T get(std::int64_t index) const {
+            return slots[static_cast<size_type>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, T value) {
+            slots[static_cast<size_type>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+
+        size_type mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+    Buffer* grow(Buffer* buffer, std::int64_t top, std::int64_t bottom) {
+        auto bigger = std::make_unique<Buffer>((buffer->mask + 1) * 2);
+        for (std::int64_t i = top; i < bottom; ++i) {
+            bigger->put(i, buffer->get(i));
+        }
+        Buffer* result = bigger.get();
+        buffers_.push_back(std::move(bigger)); // Thieves may still read the old buffer
+        buffer_.store(result, std::memory_order_release);
+        return result;
+    }
+
+    alignas(cache_line_size) std::atomic<std::int64_t> top_{0};    ///< Next element to steal; written by thieves
+    alignas(cache_line_size) std::atomic<std::int64_t> bottom_{0}; ///< Next free slot; written by the owner
+    std::atomic<Buffer*> buffer_{nullptr};                         ///< Current ring
+    std::vector<std::unique_ptr<Buffer>> buffers_;                 ///< Current and retired rings; owner only
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_CHASE_LEV_DEQUE_HPP
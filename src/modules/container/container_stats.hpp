@@ -0,0 +1,246 @@
+#ifndef CXX_LAB_CONTAINER_STATS_HPP
+#define CXX_LAB_CONTAINER_STATS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace cxx_lab {
+
+/**
+ * @brief A point-in-time copy of a container's contention and latency counters.
+ *
+ * Counters are cumulative since construction (or the last ContainerStats::reset()), so a
+ * scraper computes rates from the difference of two snapshots.
+ */
+struct ContainerStatsSnapshot {
+    /// Number of lock-wait buckets; bucket 0 counts acquisitions that did not wait,
+    /// bucket i (i > 0) waits in [2^(i-1), 2^i) nanoseconds, the last bucket everything longer.
+    static constexpr std::size_t LOCK_WAIT_BUCKETS = 40;
+
+    std::array<std::uint64_t, LOCK_WAIT_BUCKETS> lock_wait_ns{}; ///< Histogram of lock acquisition waits
+    std::uint64_t lock_acquisitions = 0;                          ///< Successful lock acquisitions
+    std::uint64_t try_busy = 0;             ///< try_* calls that failed because the lock was held
+    std::uint64_t try_full = 0;             ///< try_* calls that failed because there was no room
+    std::uint64_t try_empty = 0;            ///< try_* calls that failed because there was no element (or key)
+    std::uint64_t notify_one = 0;           ///< Single-waiter notifications
+    std::uint64_t notify_all = 0;           ///< Broadcast notifications
+    std::uint64_t high_water = 0;           ///< Largest number of elements observed
+
+    /**
+     * @brief Estimates a lock-wait percentile from the histogram.
+     *
+     * @param fraction The percentile as a fraction, e.g. 0.99.
+     * @return The upper bound of the bucket containing the percentile (zero if it did not wait).
+     */
+    std::chrono::nanoseconds lock_wait_percentile(double fraction) const {
+        const auto rank = static_cast<std::uint64_t>(fraction * static_cast<double>(lock_acquisitions));
+        std::uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < LOCK_WAIT_BUCKETS; ++bucket) {
+            seen += lock_wait_ns[bucket];
+            if (seen > rank) {
+                return std::chrono::nanoseconds(bucket == 0 ? 0 : (std::int64_t{1} << bucket));
+            }
+        }
+        return std::chrono::nanoseconds(std::int64_t{1} << (LOCK_WAIT_BUCKETS - 1));
+    }
+};
+
+/**
+ * @brief Stats policy that records nothing; the default for every safe container.
+ *
+ * All hooks are empty and the policy is an empty member, so a container instantiated with it
+ * compiles to exactly the uninstrumented code (no clock reads, no atomics, no extra storage).
+ */
+struct NullContainerStats {
+    static constexpr bool enabled = false;
+
+    void record_lock_wait(std::chrono::nanoseconds) const {}
+    void record_try_busy() const {}
+    void record_try_full() const {}
+    void record_try_empty() const {}
+    void record_notify_one() const {}
+    void record_notify_all() const {}
+    void record_size(std::size_t) const {}
+
+    ContainerStatsSnapshot snapshot() const {
+        return {};
+    }
+
+    void reset() const {}
+};
+
+/**
+ * @brief Stats policy that counts lock waits, try_* failures, notifications and the high-water mark.
+ *
+ * Select it as the Stats template argument of a safe container and read it through the
+ * container's `stats()` accessor:
+ * @code
+ * SafeBoundedQueue<Job, std::deque<Job>, ContainerStats> queue(1024);
+ * ...
+ * auto snap = queue.stats().snapshot();
+ * log(snap.lock_wait_percentile(0.99), snap.try_full, snap.high_water);
+ * @endcode
+ *
+ * Counters are relaxed atomics, so snapshot() may be called from any thread at any time; a
+ * snapshot taken concurrently with updates is not a single consistent cut.
+ */
+class ContainerStats {
+public:
+    static constexpr bool enabled = true;
+
+    ContainerStats() = default;
+    ContainerStats(const ContainerStats&) = delete;
+    ContainerStats& operator=(const ContainerStats&) = delete;
+
+    void record_lock_wait(std::chrono::nanoseconds waited) {
+        lock_wait_ns_[bucket_of(waited)].fetch_add(1, std::memory_order_relaxed);
+        lock_acquisitions_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_try_busy() {
+        try_busy_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_try_full() {
+        try_full_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_try_empty() {
+        try_empty_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_notify_one() {
+        notify_one_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_notify_all() {
+        notify_all_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Raises the high-water mark to size if it is larger. Called with the container lock held.
+     */
+    void record_size(std::size_t size) {
+        if (size > high_water_.load(std::memory_order_relaxed)) {
+            high_water_.store(size, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Copies the current counters.
+     */
+    ContainerStatsSnapshot snapshot() const {
+        ContainerStatsSnapshot snap;
+        for (std::size_t bucket = 0; bucket < ContainerStatsSnapshot::LOCK_WAIT_BUCKETS; ++bucket) {
+            snap.lock_wait_ns[bucket] = lock_wait_ns_[bucket].load(std::memory_order_relaxed);
+        }
+        snap.lock_acquisitions = lock_acquisitions_.load(std::memory_order_relaxed);
+        snap.try_busy = try_busy_.load(std::memory_order_relaxed);
+        snap.try_full = try_full_.load(std::memory_order_relaxed);
+        snap.try_empty = try_empty_.load(std::memory_order_relaxed);
+        snap.notify_one = notify_one_.load(std::memory_order_relaxed);
+        snap.notify_all = notify_all_.load(std::memory_order_relaxed);
+        snap.high_water = high_water_.load(std::memory_order_relaxed);
+        return snap;
+    }
+
+    /**
+     * @brief Zeroes every counter, e.g. after a scrape that wants per-interval values.
+     */
+    void reset() {
+        for (auto& bucket : lock_wait_ns_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        lock_acquisitions_.store(0, std::memory_order_relaxed);
+        try_busy_.store(0, std::memory_order_relaxed);
+        try_full_.store(0, std::memory_order_relaxed);
+        try_empty_.store(0, std::memory_order_relaxed);
+        notify_one_.store(0, std::memory_order_relaxed);
+        notify_all_.store(0, std::memory_order_relaxed);
+        high_water_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static std::size_t bucket_of(std::chrono::nanoseconds waited) {
+        if (waited.count() <= 0) {
+            return 0;
+        }
+        // Index of the highest set bit, plus one
+        const auto bits = static_cast<std::size_t>(64 - __builtin_clzll(static_cast<unsigned long long>(waited.count())));
+        return bits < ContainerStatsSnapshot::LOCK_WAIT_BUCKETS ? bits : ContainerStatsSnapshot::LOCK_WAIT_BUCKETS - 1;
+    }
+
+    std::array<std::atomic<std::uint64_t>, ContainerStatsSnapshot::LOCK_WAIT_BUCKETS> lock_wait_ns_{};
+    std::atomic<std::uint64_t> lock_acquisitions_{0};
+    std::atomic<std::uint64_t> try_busy_{0};
+    std::atomic<std::uint64_t> try_full_{0};
+    std::atomic<std::uint64_t> try_empty_{0};
+    std::atomic<std::uint64_t> notify_one_{0};
+    std::atomic<std::uint64_t> notify_all_{0};
+    std::atomic<std::uint64_t> high_water_{0};
+};
+
+namespace detail {
+
+/**
+ * @brief Locks lock (unique or shared), reporting the time spent waiting to stats.
+ *
+ * An uncontended acquisition costs one try_lock and no clock reads.
+ */
+template <typename Stats, typename Lock>
+void lock_with_stats(Stats& stats, Lock& lock) {
+    if constexpr (Stats::enabled) {
+        if (lock.try_lock()) {
+            stats.record_lock_wait(std::chrono::nanoseconds(0));
+            return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        lock.lock();
+        stats.record_lock_wait(std::chrono::steady_clock::now() - start);
+    } else {
+        lock.lock();
+    }
+}
+
+/**
+ * @brief Tries to lock lock without blocking, counting a busy lock as a try_* failure.
+ */
+template <typename Stats, typename Lock>
+bool try_lock_with_stats(Stats& stats, Lock& lock) {
+    if (!lock.try_lock()) {
+        stats.record_try_busy();
+        return false;
+    }
+    stats.record_lock_wait(std::chrono::nanoseconds(0));
+    return true;
+}
+
+/**
+ * @brief Locks lock, giving up after timeout, and reports the time spent waiting to stats.
+ */
+template <typename Stats, typename Lock, typename Rep, typename Period>
+bool try_lock_for_with_stats(Stats& stats, Lock& lock, const std::chrono::duration<Rep, Period>& timeout) {
+    if constexpr (Stats::enabled) {
+        if (lock.try_lock()) {
+            stats.record_lock_wait(std::chrono::nanoseconds(0));
+            return true;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        if (!lock.try_lock_for(timeout)) {
+            return false;
+        }
+        stats.record_lock_wait(std::chrono::steady_clock::now() - start);
+        return true;
+    } else {
+        return lock.try_lock_for(timeout);
+    }
+}
+
+} // namespace detail
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_CONTAINER_STATS_HPP
@@ -0,0 +1,173 @@
+#ifndef CXX_LAB_EVENT_COUNT_HPP
+#define CXX_LAB_EVENT_COUNT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#endif
+
+namespace cxx_lab {
+
+/**
+ * @brief A lightweight event count for parking threads of lock-free data structures.
+ *
+ * An event count lets a thread sleep until "something changed" without a mutex. The waiter
+ * announces itself, re-checks its condition and only then sleeps; the notifier only touches
+ * the kernel when at least one thread is announced, so notifications on the fast path cost a
+ * fence and a load.
+ *
+ * Usage:
+ * @code
+ * while (!queue.try_pop_front(value)) {
+ *     auto key = event.prepare_wait();
+ *     if (queue.try_pop_front(value)) { event.cancel_wait(); break; }
+ *     event.wait(key);
+ * }
+ * // producer side, after publishing an element:
+ * event.notify_one();
+ * @endcode
+ *
+ * On Linux the waiting is done with a private futex on the epoch word (which also gives a timed
+ * wait); elsewhere std::atomic::wait is used and timed waits poll.
+ */
+class EventCount {
+public:
+    using key_type = std::uint32_t;
+
+    EventCount() = default;
+    EventCount(const EventCount&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+
+    /**
+     * @brief Announces a waiter and returns the epoch to pass to wait().
+     *
+     * The caller must re-check its condition after this call and then call either wait() or cancel_wait().
+     *
+     * @return The current epoch.
+     */
+    key_type prepare_wait() {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Checks, without sleeping, whether a notification has moved the epoch past key.
+     *
+     * Lets a waiter spin briefly between prepare_wait() and wait() / cancel_wait().
+     *
+     * @param key The value returned by prepare_wait().
+     */
+    bool notified(key_type key) const {
+        return epoch_.load(std::memory_order_acquire) != key;
+    }
+
+    /**
+     * @brief Withdraws a waiter announced by prepare_wait() without sleeping.
+     */
+    void cancel_wait() {
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Sleeps until the epoch moves past key, then withdraws the waiter.
+     *
+     * @param key The value returned by prepare_wait().
+     */
+    void wait(key_type key) {
+        while (epoch_.load(std::memory_order_acquire) == key) {
+#if defined(__linux__)
+            futex(FUTEX_WAIT_PRIVATE, key, nullptr);
+#else
+            epoch_.wait(key, std::memory_order_acquire);
+#endif
+        }
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Sleeps until the epoch moves past key or the deadline passes, then withdraws the waiter.
+     *
+     * @param key The value returned by prepare_wait().
+     * @param deadline The point in time after which to give up.
+     * @return true if notified, false if the deadline passed first.
+     */
+    bool wait_until(key_type key, const std::chrono::steady_clock::time_point& deadline) {
+        bool notified = true;
+        while (epoch_.load(std::memory_order_acquire) == key) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                notified = false;
+                break;
+            }
+#if defined(__linux__)
+            auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now);
+            timespec ts;
+            ts.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+            ts.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+            futex(FUTEX_WAIT_PRIVATE, key, &ts);
+#else
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+#endif
+        }
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+        return notified;
+    }
+
+    /**
+     * @brief Wakes one waiting thread, if any.
+     *
+     * Call after the state change that waiters are checking for has been published.
+     */
+    void notify_one() {
+        notify(1);
+    }
+
+    /**
+     * @brief Wakes all waiting threads, if any.
+     */
+    void notify_all() {
+        notify(INT_MAX);
+    }
+
+private:
+    void notify(int count) {
+        // Pairs with the seq_cst increment in prepare_wait(): either the notifier sees the
+        // waiter, or the waiter's re-check sees the published state change.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) {
+            return; // Fast path: nobody is parked
+        }
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+#if defined(__linux__)
+        futex(FUTEX_WAKE_PRIVATE, static_cast<key_type>(count), nullptr);
+#else
+        if (count == 1) {
+            epoch_.notify_one();
+        } else {
+            epoch_.notify_all();
+        }
+#endif
+    }
+
+#if defined(__linux__)
+    long futex(int op, key_type value, const timespec* timeout) {
+        static_assert(sizeof(std::atomic<key_type>) == sizeof(key_type), "futex word must be 32 bits");
+        return syscall(SYS_futex, reinterpret_cast<key_type*>(&epoch_), op, value, timeout, nullptr, 0);
+    }
+#endif
+
+    std::atomic<key_type> epoch_{0};   ///< Bumped on every notification that has waiters
+    std::atomic<key_type> waiters_{0}; ///< Number of threads between prepare_wait() and wait()/cancel_wait()
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_EVENT_COUNT_HPP
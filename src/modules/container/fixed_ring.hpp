@@ -0,0 +1,369 @@
+#ifndef CXX_LAB_FIXED_RING_HPP
+#define CXX_LAB_FIXED_RING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace cxx_lab {
+
+namespace detail {
+
+/**
+ * @brief Random access iterator over the logical (front to back) order of a FixedRing.
+ */
+template <typename Ring, typename Value>
+class FixedRingIterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    FixedRingIterator() = default;
+    FixedRingIterator(Ring* ring, std::size_t index) : ring_(ring), index_(index) {}
+
+    /// Allows iterator -> const_iterator conversion
+    template <typename OtherRing, typename OtherValue,
+              typename = std::enable_if_t<std::is_convertible_v<OtherValue*, Value*>>>
+    FixedRingIterator(const FixedRingIterator<OtherRing, OtherValue>& other)
+        : ring_(other.ring_), index_(other.index_) {}
+
+    reference operator*() const { return (*ring_)[index_]; }
+    pointer operator->() const { return std::addressof((*ring_)[index_]); }
+    reference operator[](difference_type n) const { return (*ring_)[index_ + n]; }
+
+    FixedRingIterator& operator++() { ++index_; return *this; }
+    FixedRingIterator operator++(int) { FixedRingIterator old = *this; ++index_; return old; }
+    FixedRingIterator& operator--() { --index_; return *this; }
+    FixedRingIterator operator--(int) { FixedRingIterator old = *this; --index_; return old; }
+    FixedRingIterator& operator+=(difference_type n) { index_ += n; return *this; }
+    FixedRingIterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+    friend FixedRingIterator operator+(FixedRingIterator it, difference_type n) { return it += n; }
+    friend FixedRingIterator operator+(difference_type n, FixedRingIterator it) { return it += n; }
+    friend FixedRingIterator operator-(FixedRingIterator it, difference_type n) { return it -= n; }
+    friend difference_type operator-(const FixedRingIterator& a, const FixedRingIterator& b) {
+        return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+    }
+    friend bool operator==(const FixedRingIterator& a, const FixedRingIterator& b) { return a.index_ == b.index_; }
+    friend bool operator!=(const FixedRingIterator& a, const FixedRingIterator& b) { return a.index_ != b.index_; }
+    friend bool operator<(const FixedRingIterator& a, const FixedRingIterator& b) { return a.index_ < b.index_; }
+    friend bool operator>(const FixedRingIterator& a, const FixedRingIterator& b) { return a.index_ > b.index_; }
+    friend bool operator<=(const FixedRingIterator& a, const FixedRingIterator& b) { return a.index_ <= b.index_; }
+    friend bool operator>=(const FixedRingIterator& a, const FixedRingIterator& b) { return a.index_ >= b.index_; }
+
+private:
+    template <typename, typename>
+    friend class FixedRingIterator;
+
+    Ring* ring_ = nullptr;  ///< The iterated ring
+    std::size_t index_ = 0; ///< Logical position, 0 being the front
+};
+
+} // namespace detail
+
+/**
+ * @brief A sequence container over one preallocated, contiguous ring of slots.
+ *
+ * FixedRing is a storage policy for SafeBoundedQueue (its Container parameter) that never
+ * allocates while the queue is in use: the slots are allocated once for the full capacity and
+ * elements are placement-constructed into them and destroyed in place. Pushing and popping at
+ * either end only moves the head index and the size, so a queue that "breathes" between empty
+ * and full does not touch the allocator at all, unlike std::deque, which allocates and frees
+ * chunks as it grows and shrinks.
+ *
+ * Memory is only (re)allocated by `set_capacity()`, which SafeBoundedQueue calls from its
+ * constructor and from its own `set_capacity()`:
+ * @code
+ * SafeBoundedQueue<Job, FixedRing<Job>> queue(4096); // one allocation of 4096 slots
+ * @endcode
+ *
+ * Pushing into a full ring throws std::length_error; SafeBoundedQueue never does, since it
+ * only pushes below its capacity. The interface otherwise follows std::deque (push/pop/emplace
+ * at both ends, front(), back(), at(), operator[], random access iterators, erase(), resize(),
+ * clear()).
+ *
+ * @tparam T The type of elements stored in the ring.
+ * @tparam Allocator The allocator for the slots (default is std::allocator<T>).
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class FixedRing {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using iterator = detail::FixedRingIterator<FixedRing, T>;
+    using const_iterator = detail::FixedRingIterator<const FixedRing, const T>;
+
+    /**
+     * @brief Constructs an empty ring without slots; call set_capacity() before pushing.
+     */
+    FixedRing() noexcept(noexcept(Allocator())) : FixedRing(Allocator()) {}
+
+    explicit FixedRing(const Allocator& alloc) noexcept : alloc_(alloc) {}
+
+    /**
+     * @brief Constructs an empty ring with capacity slots.
+     *
+     * @param capacity The number of slots to preallocate.
+     * @param alloc The allocator for the slots.
+     */
+    explicit FixedRing(size_type capacity, const Allocator& alloc = Allocator()) : alloc_(alloc) {
+        set_capacity(capacity);
+    }
+
+    FixedRing(const FixedRing& other)
+        : alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+        set_capacity(other.capacity_);
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    FixedRing(FixedRing&& other) noexcept
+        : alloc_(std::move(other.alloc_)),
+          slots_(std::exchange(other.slots_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          head_(std::exchange(other.head_, 0)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    FixedRing& operator=(FixedRing other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~FixedRing() {
+        clear();
+        deallocate();
+    }
+
+    void swap(FixedRing& other) noexcept {
+        using std::swap;
+        swap(alloc_, other.alloc_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(head_, other.head_);
+        swap(size_, other.size_);
+    }
+
+    // =====================
+    // Capacity
+    // =====================
+
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+    bool full() const noexcept { return size_ == capacity_; }
+    size_type max_size() const noexcept { return alloc_traits::max_size(alloc_); }
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /**
+     * @brief Reallocates the ring with new_capacity slots; the only call that allocates.
+     *
+     * Elements are moved to the new slots front first; if new_capacity is smaller than size(),
+     * the elements at the back that do not fit are destroyed. Does nothing if the capacity is
+     * unchanged. If moving an element throws, the ring is left unchanged.
+     *
+     * @param new_capacity The new number of slots.
+     */
+    void set_capacity(size_type new_capacity) {
+        if (new_capacity == capacity_) {
+            return;
+        }
+        const size_type kept = std::min(size_, new_capacity);
+        T* slots = new_capacity > 0 ? alloc_traits::allocate(alloc_, new_capacity) : nullptr;
+        size_type moved = 0;
+        try {
+            for (; moved < kept; ++moved) {
+                alloc_traits::construct(alloc_, slots + moved, std::move_if_noexcept((*this)[moved]));
+            }
+        } catch (...) {
+            for (size_type i = 0; i < moved; ++i) {
+                alloc_traits::destroy(alloc_, slots + i);
+            }
+            alloc_traits::deallocate(alloc_, slots, new_capacity);
+            throw;
+        }
+        clear();
+        deallocate();
+        slots_ = slots;
+        capacity_ = new_capacity;
+        size_ = kept;
+    }
+
+    // =====================
+    // Element access
+    // =====================
+
+    reference operator[](size_type index) noexcept { return slots_[physical(index)]; }
+    const_reference operator[](size_type index) const noexcept { return slots_[physical(index)]; }
+
+    reference at(size_type index) {
+        check_index(index);
+        return (*this)[index];
+    }
+
+    const_reference at(size_type index) const {
+        check_index(index);
+        return (*this)[index];
+    }
+
+    reference front() noexcept { return slots_[head_]; }
+    const_reference front() const noexcept { return slots_[head_]; }
+    reference back() noexcept { return (*this)[size_ - 1]; }
+    const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // =====================
+    // Modifiers
+    // =====================
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        check_room();
+        T* slot = slots_ + physical(size_);
+        alloc_traits::construct(alloc_, slot, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    template <typename... Args>
+    reference emplace_front(Args&&... args) {
+        check_room();
+        const size_type head = head_ == 0 ? capacity_ - 1 : head_ - 1;
+        alloc_traits::construct(alloc_, slots_ + head, std::forward<Args>(args)...);
+        head_ = head;
+        ++size_;
+        return slots_[head_];
+    }
+
+    void pop_front() noexcept {
+        alloc_traits::destroy(alloc_, slots_ + head_);
+        head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+        --size_;
+    }
+
+    void pop_back() noexcept {
+        alloc_traits::destroy(alloc_, slots_ + physical(size_ - 1));
+        --size_;
+    }
+
+    /**
+     * @brief Erases [first, last). Erasing a prefix only advances the head.
+     *
+     * @return An iterator to the element that followed the erased range.
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto offset = static_cast<size_type>(first - cbegin());
+        const auto count = static_cast<size_type>(last - first);
+        if (offset == 0) {
+            for (size_type i = 0; i < count; ++i) {
+                pop_front();
+            }
+            return begin();
+        }
+        iterator dest = begin() + static_cast<difference_type>(offset);
+        std::move(dest + static_cast<difference_type>(count), end(), dest);
+        for (size_type i = 0; i < count; ++i) {
+            pop_back();
+        }
+        return begin() + static_cast<difference_type>(offset);
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    /**
+     * @brief Destroys every element; the slots are kept.
+     */
+    void clear() noexcept {
+        while (size_ > 0) {
+            pop_back();
+        }
+        head_ = 0;
+    }
+
+    /**
+     * @brief Destroys elements at the back or value-initializes new ones, up to capacity().
+     *
+     * @throws std::length_error if count exceeds capacity().
+     */
+    void resize(size_type count) {
+        if (count > capacity_) {
+            throw std::length_error("FixedRing::resize exceeds capacity");
+        }
+        while (size_ > count) {
+            pop_back();
+        }
+        while (size_ < count) {
+            emplace_back();
+        }
+    }
+
+private:
+    size_type physical(size_type index) const noexcept {
+        const size_type slot = head_ + index;
+        return slot >= capacity_ ? slot - capacity_ : slot;
+    }
+
+    void check_room() const {
+        if (size_ == capacity_) {
+            throw std::length_error("FixedRing is full");
+        }
+    }
+
+    void check_index(size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("FixedRing::at index out of range");
+        }
+    }
+
+    void deallocate() noexcept {
+        if (slots_ != nullptr) {
+            alloc_traits::deallocate(alloc_, slots_, capacity_);
+            slots_ = nullptr;
+        }
+        capacity_ = 0;
+        head_ = 0;
+    }
+
+    [[no_unique_address]] Allocator alloc_; ///< Allocator for the slots
+    T* slots_ = nullptr;                    ///< capacity_ raw slots, live ones are [head_, head_ + size_) mod capacity_
+    size_type capacity_ = 0;                ///< Number of slots
+    size_type head_ = 0;                    ///< Slot of the front element
+    size_type size_ = 0;                    ///< Number of live elements
+};
+
+template <typename T, typename Allocator>
+void swap(FixedRing<T, Allocator>& a, FixedRing<T, Allocator>& b) noexcept {
+    a.swap(b);
+}
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_FIXED_RING_HPP
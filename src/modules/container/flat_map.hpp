@@ -0,0 +1,430 @@
+#ifndef CXX_LAB_FLAT_MAP_HPP
+#define CXX_LAB_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <container/flat_set.hpp>
+
+namespace cxx_lab {
+
+namespace detail {
+
+/**
+ * @brief Random access iterator over the parallel key and mapped vectors of a FlatMap.
+ *
+ * Dereferencing yields a proxy pair of references, as std::flat_map does, so `it->first` and
+ * `it->second` work as they do for std::map.
+ */
+template <typename Key, typename T, bool Const>
+class FlatMapIterator {
+    using KeyIt = typename std::vector<Key>::const_iterator;
+    using MappedIt = std::conditional_t<Const, typename std::vector<T>::const_iterator, typename std::vector<T>::iterator>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::pair<Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const Key&, std::conditional_t<Const, const T&, T&>>;
+
+    /**
+     * @brief Holds the proxy pair so that operator-> has something to point to.
+     */
+    struct pointer {
+        reference ref;
+        const reference* operator->() const { return &ref; }
+    };
+
+    FlatMapIterator() = default;
+    FlatMapIterator(KeyIt key, MappedIt mapped) : key_(key), mapped_(mapped) {}
+
+    /**
+     * @brief Converts an iterator into a const_iterator.
+     */
+    template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+    FlatMapIterator(const FlatMapIterator<Key, T, OtherConst>& other) : key_(other.key_), mapped_(other.mapped_) {}
+
+    reference operator*() const { return reference(*key_, *mapped_); }
+    pointer operator->() const { return pointer{**this}; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    FlatMapIterator& operator++() { ++key_; ++mapped_; return *this; }
+    FlatMapIterator operator++(int) { FlatMapIterator copy = *this; ++*this; return copy; }
+    FlatMapIterator& operator--() { --key_; --mapped_; return *this; }
+    FlatMapIterator operator--(int) { FlatMapIterator copy = *this; --*this; return copy; }
+    FlatMapIterator& operator+=(difference_type n) { key_ += n; mapped_ += n; return *this; }
+    FlatMapIterator& operator-=(difference_type n) { key_ -= n; mapped_ -= n; return *this; }
+
+    friend FlatMapIterator operator+(FlatMapIterator it, difference_type n) { return it += n; }
+    friend FlatMapIterator operator+(difference_type n, FlatMapIterator it) { return it += n; }
+    friend FlatMapIterator operator-(FlatMapIterator it, difference_type n) { return it -= n; }
+    friend difference_type operator-(const FlatMapIterator& a, const FlatMapIterator& b) { return a.key_ - b.key_; }
+    friend bool operator==(const FlatMapIterator& a, const FlatMapIterator& b) { return a.key_ == b.key_; }
+    friend auto operator<=>(const FlatMapIterator& a, const FlatMapIterator& b) { return a.key_ <=> b.key_; }
+
+    /**
+     * @brief The position of the key, for the owning FlatMap.
+     */
+    KeyIt key_iterator() const { return key_; }
+
+private:
+    template <typename, typename, bool>
+    friend class FlatMapIterator;
+
+    KeyIt key_;       ///< Position in the key vector
+    MappedIt mapped_; ///< The same position in the mapped vector
+};
+
+} // namespace detail
+
+/**
+ * @brief An ordered map with unique keys stored in two parallel sorted std::vectors.
+ *
+ * A drop-in Container for SafeMap: it provides the std::map members SafeMap uses, but keeps
+ * the keys in one contiguous vector and the mapped values in another, so lookups scan densely
+ * packed keys (vectorized for integral keys, see FlatSet) and never touch a mapped value until
+ * they hit. Elements are exposed as pair-of-references proxies, so bind them with `auto`
+ * rather than `value_type&`.
+ *
+ * Single insertions and erasures shift the tails of both vectors (O(n)); for bulk loads use
+ * the range insert(), which sorts and merges the batch in one pass. Any insertion or erasure
+ * invalidates iterators and references, so SafeMap does not offer its reference-returning
+ * at(key) on this backend.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam T The type of the mapped values.
+ * @tparam Compare Strict weak ordering of the keys (default is std::less<Key>).
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class FlatMap {
+public:
+    using key_container_type = std::vector<Key>;
+    using mapped_container_type = std::vector<T>;
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = detail::FlatMapIterator<Key, T, false>;
+    using const_iterator = detail::FlatMapIterator<Key, T, true>;
+    using reference = typename iterator::reference;
+    using const_reference = typename const_iterator::reference;
+
+    FlatMap() : keys_(), values_(), compare_() {}
+
+    explicit FlatMap(const Compare& compare) : keys_(), values_(), compare_(compare) {}
+
+    /**
+     * @brief Takes over parallel vectors whose keys are already sorted and free of duplicates.
+     *
+     * @throws std::invalid_argument if the vectors differ in size.
+     */
+    FlatMap(sorted_unique_t, key_container_type keys, mapped_container_type values, const Compare& compare = Compare())
+        : keys_(std::move(keys)), values_(std::move(values)), compare_(compare) {
+        if (keys_.size() != values_.size()) {
+            throw std::invalid_argument("FlatMap needs as many mapped values as keys.");
+        }
+    }
+
+    template <typename InputIt>
+    FlatMap(InputIt first, InputIt last, const Compare& compare = Compare()) : keys_(), values_(), compare_(compare) {
+        insert(first, last);
+    }
+
+    FlatMap(std::initializer_list<value_type> values, const Compare& compare = Compare())
+        : FlatMap(values.begin(), values.end(), compare) {}
+
+    // =====================
+    // Iterators and Capacity
+    // =====================
+
+    iterator begin() noexcept { return iterator(keys_.cbegin(), values_.begin()); }
+    iterator end() noexcept { return iterator(keys_.cend(), values_.end()); }
+    const_iterator begin() const noexcept { return const_iterator(keys_.cbegin(), values_.cbegin()); }
+    const_iterator end() const noexcept { return const_iterator(keys_.cend(), values_.cend()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+    size_type max_size() const noexcept { return std::min(keys_.max_size(), values_.max_size()); }
+
+    void reserve(size_type n) {
+        keys_.reserve(n);
+        values_.reserve(n);
+    }
+
+    // =====================
+    // Element Access
+    // =====================
+
+    /**
+     * @brief Accesses the mapped value of key.
+     *
+     * @throws std::out_of_range if the key is not present.
+     */
+    T& at(const key_type& key) {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FlatMap::at: key not found");
+        }
+        return it->second;
+    }
+
+    const T& at(const key_type& key) const {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FlatMap::at: key not found");
+        }
+        return it->second;
+    }
+
+    T& operator[](const key_type& key) {
+        return try_emplace(key).first->second;
+    }
+
+    // =====================
+    // Modifiers
+    // =====================
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(std::forward<Args>(args)...);
+        return insert(std::move(value));
+    }
+
+    /**
+     * @brief Inserts T(args...) under key unless key is present, in which case nothing is constructed.
+     */
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+        auto position = lower_bound_index(key);
+        if (position < keys_.size() && !compare_(key, keys_[position])) {
+            return {at_index(position), false};
+        }
+        insert_at(position, std::forward<K>(key), std::forward<Args>(args)...);
+        return {at_index(position), true};
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& mapped) {
+        auto result = try_emplace(key, std::forward<M>(mapped));
+        if (!result.second) {
+            result.first->second = std::forward<M>(mapped);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Inserts a batch of elements: sorts the batch and merges it in one pass.
+     *
+     * O(n + m log m) for m new elements instead of O(n m) for m single insertions. Elements
+     * whose key is already present (or repeated earlier in the batch) are skipped.
+     */
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        std::vector<value_type> batch(first, last);
+        std::stable_sort(batch.begin(), batch.end(),
+                         [this](const value_type& a, const value_type& b) { return compare_(a.first, b.first); });
+        merge(batch);
+    }
+
+    /**
+     * @brief Inserts a batch of elements whose keys are already sorted and free of duplicates.
+     */
+    template <typename InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last) {
+        std::vector<value_type> batch(first, last);
+        merge(batch);
+    }
+
+    void insert(std::initializer_list<value_type> values) {
+        insert(values.begin(), values.end());
+    }
+
+    iterator erase(const_iterator pos) {
+        const auto position = static_cast<difference_type>(index_of(pos));
+        keys_.erase(keys_.begin() + position);
+        values_.erase(values_.begin() + position);
+        return at_index(static_cast<size_type>(position));
+    }
+
+    iterator erase(iterator pos) {
+        return erase(const_iterator(pos));
+    }
+
+    size_type erase(const key_type& key) {
+        auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        values_.clear();
+    }
+
+    void swap(FlatMap& other) noexcept {
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(values_, other.values_);
+        swap(compare_, other.compare_);
+    }
+
+    // =====================
+    // Lookup
+    // =====================
+
+    iterator find(const key_type& key) {
+        auto position = find_index(key);
+        return position < keys_.size() ? at_index(position) : end();
+    }
+
+    const_iterator find(const key_type& key) const {
+        auto position = find_index(key);
+        return position < keys_.size() ? const_at_index(position) : end();
+    }
+
+    size_type count(const key_type& key) const {
+        return find_index(key) < keys_.size() ? 1 : 0;
+    }
+
+    bool contains(const key_type& key) const {
+        return find_index(key) < keys_.size();
+    }
+
+    iterator lower_bound(const key_type& key) {
+        return at_index(lower_bound_index(key));
+    }
+
+    const_iterator lower_bound(const key_type& key) const {
+        return const_at_index(lower_bound_index(key));
+    }
+
+    iterator upper_bound(const key_type& key) {
+        auto position = lower_bound_index(key);
+        return at_index(position < keys_.size() && !compare_(key, keys_[position]) ? position + 1 : position);
+    }
+
+    const_iterator upper_bound(const key_type& key) const {
+        auto position = lower_bound_index(key);
+        return const_at_index(position < keys_.size() && !compare_(key, keys_[position]) ? position + 1 : position);
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    key_compare key_comp() const { return compare_; }
+
+    /**
+     * @brief Provides the sorted key vector.
+     */
+    const key_container_type& keys() const noexcept { return keys_; }
+
+    /**
+     * @brief Provides the mapped values, in key order.
+     */
+    const mapped_container_type& values() const noexcept { return values_; }
+
+    friend bool operator==(const FlatMap& a, const FlatMap& b) {
+        return a.keys_ == b.keys_ && a.values_ == b.values_;
+    }
+
+private:
+    size_type lower_bound_index(const key_type& key) const {
+        return static_cast<size_type>(detail::flat_lower_bound(keys_.begin(), keys_.end(), key, compare_) - keys_.begin());
+    }
+
+    /**
+     * @brief Returns the index of key, or size() if it is not present.
+     */
+    size_type find_index(const key_type& key) const {
+        auto position = lower_bound_index(key);
+        return position < keys_.size() && !compare_(key, keys_[position]) ? position : keys_.size();
+    }
+
+    size_type index_of(const_iterator it) const {
+        return static_cast<size_type>(it.key_iterator() - keys_.cbegin());
+    }
+
+    iterator at_index(size_type position) {
+        const auto offset = static_cast<difference_type>(position);
+        return iterator(keys_.cbegin() + offset, values_.begin() + offset);
+    }
+
+    const_iterator const_at_index(size_type position) const {
+        const auto offset = static_cast<difference_type>(position);
+        return const_iterator(keys_.cbegin() + offset, values_.cbegin() + offset);
+    }
+
+    template <typename K, typename... Args>
+    void insert_at(size_type position, K&& key, Args&&... args) {
+        const auto offset = static_cast<difference_type>(position);
+        keys_.insert(keys_.begin() + offset, std::forward<K>(key));
+        try {
+            values_.emplace(values_.begin() + offset, std::forward<Args>(args)...);
+        } catch (...) {
+            keys_.erase(keys_.begin() + offset); // Keep the vectors parallel
+            throw;
+        }
+    }
+
+    /**
+     * @brief Merges a batch sorted by key into the map. Existing keys, then the first of
+     *        equivalent batch keys, win.
+     */
+    void merge(std::vector<value_type>& batch) {
+        key_container_type keys;
+        mapped_container_type values;
+        keys.reserve(keys_.size() + batch.size());
+        values.reserve(keys_.size() + batch.size());
+
+        auto append = [&](auto&& key, auto&& value) {
+            if (keys.empty() || compare_(keys.back(), key)) {
+                keys.push_back(std::forward<decltype(key)>(key));
+                values.push_back(std::forward<decltype(value)>(value));
+            }
+        };
+        size_type i = 0;
+        auto next = batch.begin();
+        while (i < keys_.size() || next != batch.end()) {
+            if (next == batch.end() || (i < keys_.size() && !compare_(next->first, keys_[i]))) {
+                append(std::move(keys_[i]), std::move(values_[i]));
+                ++i;
+            } else {
+                append(std::move(next->first), std::move(next->second));
+                ++next;
+            }
+        }
+        keys_.swap(keys);
+        values_.swap(values);
+    }
+
+    key_container_type keys_;      ///< Sorted, unique keys
+    mapped_container_type values_; ///< values_[i] is mapped to keys_[i]
+    Compare compare_;              ///< Orders the keys
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_FLAT_MAP_HPP
@@ -0,0 +1,350 @@
+#ifndef CXX_LAB_FLAT_SET_HPP
+#define CXX_LAB_FLAT_SET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cxx_lab {
+
+/**
+ * @brief Tag telling FlatSet / FlatMap that a range is already sorted and free of duplicates.
+ */
+struct sorted_unique_t {
+    explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+
+namespace detail {
+
+template <typename Key, typename Compare>
+constexpr bool is_simd_searchable_v =
+    std::is_integral_v<Key> && !std::is_same_v<Key, bool> &&
+    (std::is_same_v<Compare, std::less<Key>> || std::is_same_v<Compare, std::less<>>);
+
+/**
+ * @brief Number of keys compared at once at the end of a flat lower_bound: two cache lines.
+ */
+template <typename Key>
+constexpr std::size_t flat_search_block_v = 128 / sizeof(Key);
+
+/**
+ * @brief Counts the keys of a fixed-size block that are less than key.
+ *
+ * The fixed trip count and branch-free body let the compiler turn this into packed compares
+ * (SSE2/AVX2/NEON), comparing a whole block in a handful of instructions.
+ */
+template <typename Key>
+std::size_t count_less_in_block(const Key* block, Key key) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < flat_search_block_v<Key>; ++i) {
+        count += block[i] < key;
+    }
+    return count;
+}
+
+/**
+ * @brief std::lower_bound over a sorted contiguous range, vectorized for integral keys.
+ *
+ * For integral keys under std::less, a branch-free binary search (conditional moves, no
+ * mispredictions) narrows the range down to one block, then the block is compared with
+ * packed instructions. Other keys and orders fall back to std::lower_bound.
+ */
+template <typename RandomIt, typename Key, typename Compare>
+RandomIt flat_lower_bound(RandomIt first, RandomIt last, const Key& key, const Compare& compare) {
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    if constexpr (std::contiguous_iterator<RandomIt> && std::is_same_v<value_type, Key> &&
+                  is_simd_searchable_v<Key, Compare>) {
+        constexpr std::size_t block = flat_search_block_v<Key>;
+        std::size_t size = static_cast<std::size_t>(last - first);
+        if (size < block) {
+            return std::lower_bound(first, last, key, compare);
+        }
+        const Key* data = std::to_address(first);
+        const Key* base = data;
+        // Invariant: the answer lies in [base, base + size]
+        while (size > block) {
+            const std::size_t half = size / 2;
+            base = base[half - 1] < key ? base + half : base;
+            size -= half;
+        }
+        // Every key before base is less than key, so a full block ending no later than the
+        // range end still counts the right offset
+        const Key* window = std::min(base, data + (last - first) - block);
+        return first + ((window - data) + static_cast<std::ptrdiff_t>(count_less_in_block(window, key)));
+    } else {
+        return std::lower_bound(first, last, key, compare);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief An ordered set of unique keys stored in one sorted std::vector.
+ *
+ * A drop-in Container for SafeSet: it provides the std::set members SafeSet uses, but keeps
+ * the keys contiguous, so a set of a few thousand keys costs one allocation instead of one
+ * per key and lookups walk cache lines instead of tree nodes. Lookups on integral keys use a
+ * vectorized lower_bound.
+ *
+ * Single insertions and erasures shift the tail of the vector (O(n)); for bulk loads use the
+ * range insert(), which sorts and merges the batch in one pass. As with std::vector, any
+ * insertion or erasure invalidates iterators.
+ *
+ * @code
+ * cxx_lab::SafeSet<int, cxx_lab::FlatSet<int>> ids;
+ * ids.access([&](cxx_lab::FlatSet<int>& set) { set.insert(batch.begin(), batch.end()); });
+ * @endcode
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Compare Strict weak ordering of the keys (default is std::less<Key>).
+ * @tparam Allocator The allocator of the key vector.
+ */
+template <typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key>>
+class FlatSet {
+public:
+    using container_type = std::vector<Key, Allocator>;
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Key&;
+    using const_reference = const Key&;
+    using iterator = typename container_type::const_iterator; ///< Keys are immutable, as in std::set
+    using const_iterator = iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
+    FlatSet() : keys_(), compare_() {}
+
+    explicit FlatSet(const Compare& compare, const Allocator& alloc = Allocator()) : keys_(alloc), compare_(compare) {}
+
+    explicit FlatSet(const Allocator& alloc) : keys_(alloc), compare_() {}
+
+    /**
+     * @brief Takes over a vector of keys, sorting it and removing duplicates.
+     */
+    explicit FlatSet(container_type keys, const Compare& compare = Compare())
+        : keys_(std::move(keys)), compare_(compare) {
+        sort_and_unique();
+    }
+
+    /**
+     * @brief Takes over a vector of keys that is already sorted and free of duplicates.
+     */
+    FlatSet(sorted_unique_t, container_type keys, const Compare& compare = Compare())
+        : keys_(std::move(keys)), compare_(compare) {}
+
+    template <typename InputIt>
+    FlatSet(InputIt first, InputIt last, const Compare& compare = Compare()) : keys_(first, last), compare_(compare) {
+        sort_and_unique();
+    }
+
+    FlatSet(std::initializer_list<Key> keys, const Compare& compare = Compare()) : FlatSet(keys.begin(), keys.end(), compare) {}
+
+    // =====================
+    // Iterators and Capacity
+    // =====================
+
+    iterator begin() const noexcept { return keys_.begin(); }
+    iterator end() const noexcept { return keys_.end(); }
+    iterator cbegin() const noexcept { return keys_.begin(); }
+    iterator cend() const noexcept { return keys_.end(); }
+    reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+    size_type max_size() const noexcept { return keys_.max_size(); }
+    size_type capacity() const noexcept { return keys_.capacity(); }
+    void reserve(size_type n) { keys_.reserve(n); }
+    void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+    // =====================
+    // Modifiers
+    // =====================
+
+    std::pair<iterator, bool> insert(const value_type& key) {
+        return insert_unique(key);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& key) {
+        return insert_unique(std::move(key));
+    }
+
+    /**
+     * @brief Inserts a key; the hint is ignored (the position is found by binary search anyway).
+     */
+    iterator insert(const_iterator, const value_type& key) {
+        return insert_unique(key).first;
+    }
+
+    /**
+     * @brief Inserts a batch of keys: appends them, sorts the batch, and merges it in one pass.
+     *
+     * O(n + m log m) for m new keys instead of O(n m) for m single insertions. Keys already
+     * present (or repeated in the batch) are skipped.
+     */
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        const size_type old_size = keys_.size();
+        keys_.insert(keys_.end(), first, last);
+        auto middle = keys_.begin() + static_cast<difference_type>(old_size);
+        std::stable_sort(middle, keys_.end(), compare_);
+        merge_tail(middle);
+    }
+
+    /**
+     * @brief Inserts a batch of keys that is already sorted and free of duplicates.
+     */
+    template <typename InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last) {
+        const size_type old_size = keys_.size();
+        keys_.insert(keys_.end(), first, last);
+        merge_tail(keys_.begin() + static_cast<difference_type>(old_size));
+    }
+
+    void insert(std::initializer_list<Key> keys) {
+        insert(keys.begin(), keys.end());
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert_unique(Key(std::forward<Args>(args)...));
+    }
+
+    iterator erase(const_iterator pos) {
+        return keys_.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        return keys_.erase(first, last);
+    }
+
+    size_type erase(const key_type& key) {
+        auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        keys_.erase(it);
+        return 1;
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+    }
+
+    void swap(FlatSet& other) noexcept {
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(compare_, other.compare_);
+    }
+
+    /**
+     * @brief Moves the sorted key vector out, leaving the set empty.
+     */
+    container_type extract() && {
+        container_type keys = std::move(keys_);
+        keys_.clear();
+        return keys;
+    }
+
+    /**
+     * @brief Replaces the keys with a vector that is already sorted and free of duplicates.
+     */
+    void replace(container_type&& keys) {
+        keys_ = std::move(keys);
+    }
+
+    // =====================
+    // Lookup
+    // =====================
+
+    iterator find(const key_type& key) const {
+        auto it = lower_bound(key);
+        return it != end() && !compare_(key, *it) ? it : end();
+    }
+
+    size_type count(const key_type& key) const {
+        return find(key) != end() ? 1 : 0;
+    }
+
+    bool contains(const key_type& key) const {
+        return find(key) != end();
+    }
+
+    iterator lower_bound(const key_type& key) const {
+        return detail::flat_lower_bound(keys_.begin(), keys_.end(), key, compare_);
+    }
+
+    iterator upper_bound(const key_type& key) const {
+        auto it = lower_bound(key);
+        return it != end() && !compare_(key, *it) ? std::next(it) : it;
+    }
+
+    std::pair<iterator, iterator> equal_range(const key_type& key) const {
+        auto it = lower_bound(key);
+        return {it, it != end() && !compare_(key, *it) ? std::next(it) : it};
+    }
+
+    key_compare key_comp() const { return compare_; }
+    value_compare value_comp() const { return compare_; }
+
+    /**
+     * @brief Provides the sorted key vector.
+     */
+    const container_type& keys() const noexcept { return keys_; }
+
+    friend bool operator==(const FlatSet& a, const FlatSet& b) {
+        return a.keys_ == b.keys_;
+    }
+
+private:
+    template <typename K>
+    std::pair<iterator, bool> insert_unique(K&& key) {
+        auto it = lower_bound(key);
+        if (it != end() && !compare_(key, *it)) {
+            return {it, false};
+        }
+        return {keys_.insert(it, std::forward<K>(key)), true};
+    }
+
+    /**
+     * @brief Merges the sorted keys [middle, end) into the sorted keys before them and drops
+     *        duplicates, keeping the ones that were there first.
+     */
+    void merge_tail(typename container_type::iterator middle) {
+        std::inplace_merge(keys_.begin(), middle, keys_.end(), compare_);
+        drop_duplicates();
+    }
+
+    void sort_and_unique() {
+        std::stable_sort(keys_.begin(), keys_.end(), compare_);
+        drop_duplicates();
+    }
+
+    /**
+     * @brief Erases all but the first of each run of equivalent keys. Keys must be sorted.
+     */
+    void drop_duplicates() {
+        auto equivalent = [this](const Key& a, const Key& b) { return !compare_(a, b) && !compare_(b, a); };
+        keys_.erase(std::unique(keys_.begin(), keys_.end(), equivalent), keys_.end());
+    }
+
+    container_type keys_; ///< Sorted, unique keys
+    Compare compare_;     ///< Orders the keys
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_FLAT_SET_HPP
@@ -0,0 +1,175 @@
+#ifndef CXX_LAB_HAZARD_POINTER_HPP
+#define CXX_LAB_HAZARD_POINTER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <container/cache_line.hpp>
+
+namespace cxx_lab {
+
+/**
+ * @brief A process-wide registry of hazard pointers.
+ *
+ * A hazard pointer is a per-thread slot in which a reader publishes the object it is about to
+ * dereference. A writer that has unlinked an object may only delete it once no slot holds it.
+ * Each slot lives on its own cache line and is written only by the thread that owns it, so
+ * protecting an object costs the reader one store and one re-load but no shared writes.
+ *
+ * Records are handed out to threads on first use, given back when the thread exits and never
+ * freed, so scanning needs no locks.
+ */
+class HazardDomain {
+public:
+    /**
+     * @brief One hazard slot, owned by at most one thread at a time.
+     */
+    struct alignas(cache_line_size) Record {
+        std::atomic<const void*> hazard{nullptr}; ///< The protected object, or nullptr
+        std::atomic<bool> active{false};          ///< Whether a thread owns this record
+        Record* next = nullptr;                   ///< Next record in the domain (immutable once linked)
+    };
+
+    /**
+     * @brief Retrieves the domain shared by all containers.
+     *
+     * The domain is intentionally never destroyed so that thread exit and static destruction
+     * order do not matter.
+     */
+    static HazardDomain& instance() {
+        static HazardDomain* domain = new HazardDomain();
+        return *domain;
+    }
+
+    HazardDomain(const HazardDomain&) = delete;
+    HazardDomain& operator=(const HazardDomain&) = delete;
+
+    /**
+     * @brief Takes ownership of a free record, allocating one if all are in use.
+     */
+    Record* acquire() {
+        for (Record* record = head_.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            bool expected = false;
+            if (!record->active.load(std::memory_order_relaxed) &&
+                record->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return record;
+            }
+        }
+        Record* record = new Record();
+        record->active.store(true, std::memory_order_relaxed);
+        Record* head = head_.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!head_.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        return record;
+    }
+
+    /**
+     * @brief Gives a record back to the domain.
+     */
+    void release(Record* record) {
+        record->hazard.store(nullptr, std::memory_order_release);
+        record->active.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Collects every currently protected pointer, sorted for binary search.
+     */
+    std::vector<const void*> protected_pointers() const {
+        std::vector<const void*> result;
+        for (Record* record = head_.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            if (const void* hazard = record->hazard.load(std::memory_order_seq_cst)) {
+                result.push_back(hazard);
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+private:
+    HazardDomain() = default;
+
+    std::atomic<Record*> head_{nullptr}; ///< Singly linked list of all records ever allocated
+};
+
+/**
+ * @brief Protects one object read through an atomic pointer for the guard's lifetime.
+ *
+ * The first guard of a thread uses a record cached in thread-local storage; nested guards on
+ * the same thread fall back to acquiring another record from the domain.
+ *
+ * Usage:
+ * @code
+ * HazardGuard guard;
+ * const Node* node = guard.protect(head_);
+ * // node may be dereferenced until guard is destroyed
+ * @endcode
+ */
+class HazardGuard {
+public:
+    HazardGuard() {
+        LocalRecord& local = local_record();
+        if (!local.busy) {
+            local.busy = true;
+            record_ = local.record;
+            owns_local_ = true;
+        } else {
+            record_ = HazardDomain::instance().acquire();
+        }
+    }
+
+    ~HazardGuard() {
+        if (owns_local_) {
+            record_->hazard.store(nullptr, std::memory_order_release);
+            local_record().busy = false;
+        } else {
+            HazardDomain::instance().release(record_);
+        }
+    }
+
+    HazardGuard(const HazardGuard&) = delete;
+    HazardGuard& operator=(const HazardGuard&) = delete;
+
+    /**
+     * @brief Loads source and publishes it as hazardous until it is stable.
+     *
+     * @return The protected pointer; it stays valid until the guard is destroyed.
+     */
+    template <typename T>
+    const T* protect(const std::atomic<const T*>& source) {
+        const T* pointer = source.load(std::memory_order_acquire);
+        for (;;) {
+            record_->hazard.store(pointer, std::memory_order_seq_cst);
+            // Pairs with the writer's exchange + scan: if the source still holds pointer now,
+            // any later scan is guaranteed to see the hazard.
+            const T* current = source.load(std::memory_order_seq_cst);
+            if (current == pointer) {
+                return pointer;
+            }
+            pointer = current;
+        }
+    }
+
+private:
+    struct LocalRecord {
+        HazardDomain::Record* record = HazardDomain::instance().acquire();
+        bool busy = false;
+
+        ~LocalRecord() {
+            HazardDomain::instance().release(record);
+        }
+    };
+
+    static LocalRecord& local_record() {
+        thread_local LocalRecord local;
+        return local;
+    }
+
+    HazardDomain::Record* record_;
+    bool owns_local_ = false;
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_HAZARD_POINTER_HPP
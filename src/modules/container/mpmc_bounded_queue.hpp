@@ -0,0 +1,388 @@
+#ifndef CXX_LAB_MPMC_BOUNDED_QUEUE_HPP
+#define CXX_LAB_MPMC_BOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <container/cache_line.hpp>
+#include <container/event_count.hpp>
+
+namespace cxx_lab {
+
+/**
+ * @brief A bounded lock-free multi-producer/multi-consumer queue.
+ *
+ * This queue is an alternative to SafeBoundedQueue for workloads with many producers and
+ * consumers. It follows Dmitry Vyukov's bounded MPMC design: every slot carries a sequence
+ * number that tells producers and consumers whether the slot is free or filled for the
+ * current lap, so an operation is one CAS on the shared position plus one store to its slot.
+ *
+ * The push/pop surface mirrors the FIFO half of SafeBoundedQueue:
+ * - `try_push_back()`, `try_pop_front()`: Non-blocking attempts.
+ * - `push_back(value, timeout)`, `pop_front(value, timeout)`: Blocking with timeout.
+ * - `push_back(value)`, `pop_front(value)`: Blocking until done.
+ *
+ * Blocking operations first retry the lock-free fast path for a short spin and only then park
+ * on an EventCount (a futex on Linux). Producers and consumers pay for a wake-up only when a
+ * thread is actually parked on the other side.
+ *
+ * The capacity is rounded up to the next power of two (at least 2, since a single slot cannot
+ * tell a full lap from an empty one) and is fixed for the queue's lifetime.
+ *
+ * A claimed slot must be filled or emptied, or every thread behind it waits for it forever, so
+ * T must be nothrow move-constructible and move-assignable. An element whose construction can
+ * throw, such as a copy of a std::string, is built before a slot is claimed and then moved in.
+ *
+ * @tparam T The type of elements stored in the queue.
+ */
+template <typename T>
+class MpmcBoundedQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                  "MpmcBoundedQueue cannot undo a claimed slot, so moving T must not throw");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an MpmcBoundedQueue with at least the specified capacity.
+     *
+     * @param capacity The minimum number of elements the queue can hold (rounded up to a power of two, at least 2).
+     * @throws std::invalid_argument if capacity is zero.
+     */
+    explicit MpmcBoundedQueue(size_type capacity = DEFAULT_CAPACITY)
+        : capacity_(round_up_pow2(capacity)), mask_(capacity_ - 1), cells_(new Cell[capacity_])
+    {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than zero.");
+        }
+        for (size_type i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcBoundedQueue(const MpmcBoundedQueue&) = delete;
+    MpmcBoundedQueue& operator=(const MpmcBoundedQueue&) = delete;
+
+    ~MpmcBoundedQueue() {
+        // Destroy the remaining elements
+        const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+        for (size_type head = dequeue_pos_.load(std::memory_order_acquire); head != tail; ++head) {
+            cells_[head & mask_].element()->~T();
+        }
+    }
+
+    // =====================
+    // Non-Blocking Operations
+    // =====================
+
+    /**
+     * @brief Attempts to push an element to the back without blocking.
+     *
+     * @param value The element to push.
+     * @return true if the push was successful, false if the queue is full.
+     */
+    bool try_push_back(const T& value) {
+        return try_emplace_back(value);
+    }
+
+    /**
+     * @brief Attempts to move an element to the back without blocking.
+     *
+     * @param value The element to push. It is left untouched if the queue is full.
+     * @return true if the push was successful, false if the queue is full.
+     */
+    bool try_push_back(T&& value) {
+        return try_emplace_back(std::move(value));
+    }
+
+    /**
+     * @brief Attempts to construct an element in place at the back without blocking.
+     *
+     * If that constructor may throw, the element is built first and moved into the slot, so it
+     * is constructed even when the queue turns out to be full.
+     *
+     * @param args The arguments to pass to the element's constructor.
+     * @return true if the element was constructed, false if the queue is full.
+     */
+    template <typename... Args>
+    bool try_emplace_back(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+            return emplace_claimed(std::forward<Args>(args)...);
+        } else {
+            T value(std::forward<Args>(args)...);
+            return emplace_claimed(std::move(value));
+        }
+    }
+
+    /**
+     * @brief Attempts to pop an element from the front without blocking.
+     *
+     * @param value Reference to store the popped element.
+     * @return true if the pop was successful, false if the queue is empty.
+     */
+    bool try_pop_front(T& value) {
+        Cell* cell;
+        size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_type seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Queue is empty
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        T* element = cell->element();
+        value = std::move(*element);
+        element->~T();
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        not_full_.notify_one();
+        return true;
+    }
+
+    // =====================
+    // Blocking Operations with Timeout
+    // =====================
+
+    /**
+     * @brief Attempts to push an element to the back, blocking until the push is successful or timeout occurs.
+     *
+     * @param value The element to push.
+     * @param timeout The maximum duration to wait for the push to succeed.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push_back(const T& value, const std::chrono::milliseconds& timeout) {
+        if constexpr (std::is_nothrow_copy_constructible_v<T>) {
+            return wait_for(not_full_, timeout, [&]() { return try_emplace_back(value); });
+        } else {
+            T copy(value); // Copied once, not on every attempt
+            return push_back(std::move(copy), timeout);
+        }
+    }
+
+    /**
+     * @brief Attempts to move an element to the back, blocking until the push is successful or timeout occurs.
+     *
+     * @param value The element to push. It is left untouched if the timeout expires.
+     * @param timeout The maximum duration to wait for the push to succeed.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push_back(T&& value, const std::chrono::milliseconds& timeout) {
+        return wait_for(not_full_, timeout, [&]() { return try_emplace_back(std::move(value)); });
+    }
+
+    /**
+     * @brief Attempts to pop an element from the front, blocking until the pop is successful or timeout occurs.
+     *
+     * @param value Reference to store the popped element.
+     * @param timeout The maximum duration to wait for the pop to succeed.
+     * @return true if the pop was successful within the timeout, false otherwise.
+     */
+    bool pop_front(T& value, const std::chrono::milliseconds& timeout) {
+        return wait_for(not_empty_, timeout, [&]() { return try_pop_front(value); });
+    }
+
+    // =====================
+    // Blocking Operations without Timeout
+    // =====================
+
+    /**
+     * @brief Pushes an element to the back, blocking until the push is successful.
+     *
+     * @param value The element to push.
+     */
+    void push_back(const T& value) {
+        if constexpr (std::is_nothrow_copy_constructible_v<T>) {
+            wait(not_full_, [&]() { return try_emplace_back(value); });
+        } else {
+            T copy(value); // Copied once, not on every attempt
+            push_back(std::move(copy));
+        }
+    }
+
+    /**
+     * @brief Moves an element to the back, blocking until the push is successful.
+     *
+     * @param value The element to push.
+     */
+    void push_back(T&& value) {
+        wait(not_full_, [&]() { return try_emplace_back(std::move(value)); });
+    }
+
+    /**
+     * @brief Pops an element from the front, blocking until the pop is successful.
+     *
+     * @param value Reference to store the popped element.
+     */
+    void pop_front(T& value) {
+        wait(not_empty_, [&]() { return try_pop_front(value); });
+    }
+
+    // =====================
+    // Utility Functions
+    // =====================
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * With concurrent producers and consumers the result is only a snapshot.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Retrieves the approximate number of elements in the queue.
+     *
+     * Includes elements whose push or pop is still in progress.
+     *
+     * @return The number of elements.
+     */
+    size_type size() const {
+        const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+        const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /**
+     * @brief Retrieves the capacity of the queue.
+     *
+     * @return The capacity (a power of two).
+     */
+    size_type capacity() const {
+        return capacity_;
+    }
+
+private:
+    static constexpr size_type DEFAULT_CAPACITY = 1024; ///< Default queue capacity
+    static constexpr int SPIN_TRIES = 64;               ///< Fast-path retries before parking
+
+    /**
+     * @brief A slot with its lap sequence number and uninitialized element storage.
+     */
+    struct Cell {
+        std::atomic<size_type> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* element() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    /**
+     * @brief Claims the back slot and constructs the element in it. Constructing must not throw.
+     */
+    template <typename... Args>
+    bool emplace_claimed(Args&&... args) noexcept {
+        Cell* cell;
+        size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_type seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Queue is full
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        ::new (static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        not_empty_.notify_one();
+        return true;
+    }
+
+    static size_type round_up_pow2(size_type value) {
+        size_type result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    template <typename Op>
+    static bool spin(Op& op) {
+        // Spinning only helps when the other side can make progress on another CPU
+        static const int spin_tries = std::thread::hardware_concurrency() > 1 ? SPIN_TRIES : 0;
+        for (int i = 0; i < spin_tries; ++i) {
+            if (op()) {
+                return true;
+            }
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+        return false;
+    }
+
+    template <typename Op>
+    static void wait(EventCount& event, Op&& op) {
+        if (op() || spin(op)) {
+            return;
+        }
+        for (;;) {
+            auto key = event.prepare_wait();
+            if (op()) {
+                event.cancel_wait();
+                return;
+            }
+            event.wait(key);
+            if (op()) {
+                return;
+            }
+        }
+    }
+
+    template <typename Op>
+    static bool wait_for(EventCount& event, const std::chrono::milliseconds& timeout, Op&& op) {
+        if (op() || spin(op)) {
+            return true;
+        }
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (;;) {
+            auto key = event.prepare_wait();
+            if (op()) {
+                event.cancel_wait();
+                return true;
+            }
+            if (!event.wait_until(key, deadline)) {
+                return op(); // Timeout occurred, one last attempt
+            }
+            if (op()) {
+                return true;
+            }
+        }
+    }
+
+    alignas(cache_line_size) std::atomic<size_type> enqueue_pos_{0}; ///< Next position to claim for a push
+    alignas(cache_line_size) std::atomic<size_type> dequeue_pos_{0}; ///< Next position to claim for a pop
+    alignas(cache_line_size) EventCount not_empty_;                  ///< Parks consumers of an empty queue
+    alignas(cache_line_size) EventCount not_full_;                   ///< Parks producers of a full queue
+    alignas(cache_line_size) const size_type capacity_;              ///< Number of cells (power of two)
+    const size_type mask_;                                           ///< capacity_ - 1, used to wrap positions
+    std::unique_ptr<Cell[]> cells_;                                  ///< Slot storage
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_MPMC_BOUNDED_QUEUE_HPP
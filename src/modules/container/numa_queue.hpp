@@ -0,0 +1,374 @@
+#ifndef CXX_LAB_NUMA_QUEUE_HPP
+#define CXX_LAB_NUMA_QUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <container/cache_line.hpp>
+#include <container/event_count.hpp>
+#include <container/fixed_ring.hpp>
+#include <container/numa_topology.hpp>
+#include <container/safe_bounded_queue.hpp>
+#include <container/wait_policy.hpp>
+
+namespace cxx_lab {
+
+/**
+ * @brief A bounded MPMC queue split into one SafeBoundedQueue per NUMA node.
+ *
+ * One queue shared by every thread of a multi-socket host bounces its lock and its slots
+ * between the sockets on every operation. NumaQueue keeps a sub-queue per node instead, with
+ * its slots in node-local memory (NodeLocalAllocator: libnuma, or first touch by a thread bound
+ * to the node). Producers push to the sub-queue of the node they run on; consumers pop from
+ * theirs and only steal from the other nodes, nearest first, when it is empty. Items therefore
+ * usually stay on one socket, and the queue as a whole is FIFO only per sub-queue.
+ *
+ * A push that finds its own sub-queue full (or locked) spills to a neighbour before blocking. Consumers
+ * that find nothing anywhere park on one EventCount; only the push that makes a sub-queue
+ * non-empty wakes one of them, and each woken consumer wakes the next while work is left.
+ *
+ * The *_at() variants take the node explicitly (e.g. for threads that were bound to a node
+ * with NumaTopology::bind_current_thread(), or for a simulated topology); the others use the
+ * node of the CPU the caller is running on.
+ *
+ * @code
+ * cxx_lab::NumaQueue<Job> jobs(4096); // 4096 slots per node of NumaTopology::detect()
+ * jobs.push(job);                     // to the caller's node
+ * jobs.pop(job);                      // local first, then stolen from the nearest node
+ * @endcode
+ *
+ * @tparam T The type of elements stored in the queue.
+ * @tparam Wait The waiting policy of the sub-queues' blocked producers.
+ */
+template <typename T, typename Wait = ConditionVariableWait>
+class NumaQueue {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using queue_type = SafeBoundedQueue<T, FixedRing<T, NodeLocalAllocator<T>>, NullContainerStats, Wait>;
+
+    /**
+     * @brief Constructs a NumaQueue with one sub-queue per node of topology.
+     *
+     * Each sub-queue is built on a thread bound to its node, so that its memory is node-local.
+     *
+     * @param capacity_per_node The maximum number of elements of each sub-queue.
+     * @param topology The nodes to split the queue over (default is this machine's).
+     * @throws std::invalid_argument if capacity_per_node is zero.
+     */
+    explicit NumaQueue(size_type capacity_per_node, NumaTopology topology = NumaTopology::detect())
+        : topology_(std::move(topology)) {
+        if (capacity_per_node == 0) {
+            throw std::invalid_argument("Capacity must be greater than zero.");
+        }
+        nodes_.resize(topology_.node_count());
+        for (size_type node = 0; node < nodes_.size(); ++node) {
+            std::exception_ptr error;
+            std::thread builder([&, node]() {
+                try {
+                    topology_.bind_current_thread(node);
+                    nodes_[node] = std::make_unique<Node>(capacity_per_node, topology_.os_node(node),
+                                                          topology_.neighbours(node));
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            });
+            builder.join();
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    NumaQueue(const NumaQueue&) = delete;
+    NumaQueue& operator=(const NumaQueue&) = delete;
+
+    // =====================
+    // Push Operations
+    // =====================
+
+    /**
+     * @brief Pushes to the caller's node, or a neighbour if that one is full or busy, without blocking.
+     *
+     * @param value The element to push.
+     * @return true if the push was successful, false if every sub-queue is full or locked.
+     */
+    bool try_push(const T& value) {
+        return try_push_at(local_node(), value);
+    }
+
+    bool try_push(T&& value) {
+        return try_push_at(local_node(), std::move(value));
+    }
+
+    /**
+     * @brief Pushes to the caller's node, or a neighbour; blocks on the caller's node if none takes it.
+     *
+     * @param value The element to push.
+     */
+    void push(const T& value) {
+        push_at(local_node(), value);
+    }
+
+    void push(T&& value) {
+        push_at(local_node(), std::move(value));
+    }
+
+    /**
+     * @brief try_push() as if called from a thread on node.
+     *
+     * @param node The producer's node, below node_count().
+     * @param value The element to push. It is left untouched if the push fails.
+     */
+    bool try_push_at(size_type node, const T& value) {
+        return try_insert(node, value);
+    }
+
+    bool try_push_at(size_type node, T&& value) {
+        return try_insert(node, std::move(value));
+    }
+
+    /**
+     * @brief push() as if called from a thread on node.
+     *
+     * @param node The producer's node, below node_count().
+     * @param value The element to push.
+     */
+    void push_at(size_type node, const T& value) {
+        insert(node, value);
+    }
+
+    void push_at(size_type node, T&& value) {
+        insert(node, std::move(value));
+    }
+
+    // =====================
+    // Pop Operations
+    // =====================
+
+    /**
+     * @brief Pops from the caller's node, or steals from the nearest non-empty node, without blocking.
+     *
+     * @param value Reference to store the popped element.
+     * @return true if an element was popped, false if every sub-queue is empty or locked.
+     */
+    bool try_pop(T& value) {
+        return try_pop_at(local_node(), value);
+    }
+
+    /**
+     * @brief Pops like try_pop(), waiting up to timeout for an element to arrive on any node.
+     */
+    bool pop(T& value, const std::chrono::milliseconds& timeout) {
+        return pop_at(local_node(), value, timeout);
+    }
+
+    /**
+     * @brief Pops like try_pop(), waiting as long as it takes for an element to arrive on any node.
+     */
+    void pop(T& value) {
+        pop_at(local_node(), value);
+    }
+
+    /**
+     * @brief try_pop() as if called from a thread on node.
+     *
+     * @param node The consumer's node, below node_count().
+     * @param value Reference to store the popped element.
+     */
+    bool try_pop_at(size_type node, T& value) {
+        return scan(node, value, false);
+    }
+
+    /**
+     * @brief pop(value, timeout) as if called from a thread on node.
+     */
+    bool pop_at(size_type node, T& value, const std::chrono::milliseconds& timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!scan(node, value, false)) {
+            auto key = not_empty_.prepare_wait();
+            if (scan(node, value, true)) {
+                not_empty_.cancel_wait();
+                return true;
+            }
+            if (!not_empty_.wait_until(key, deadline)) {
+                return scan(node, value, true);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief pop(value) as if called from a thread on node.
+     */
+    void pop_at(size_type node, T& value) {
+        while (!scan(node, value, false)) {
+            auto key = not_empty_.prepare_wait();
+            if (scan(node, value, true)) {
+                not_empty_.cancel_wait();
+                return;
+            }
+            not_empty_.wait(key);
+        }
+    }
+
+    // =====================
+    // Utility Functions
+    // =====================
+
+    /**
+     * @brief Returns the node of the CPU the caller is running on.
+     */
+    size_type local_node() const {
+        return topology_.current_node();
+    }
+
+    size_type node_count() const noexcept {
+        return nodes_.size();
+    }
+
+    const NumaTopology& topology() const noexcept {
+        return topology_;
+    }
+
+    /**
+     * @brief Provides the sub-queue of a node.
+     */
+    queue_type& node_queue(size_type node) {
+        return nodes_.at(node)->queue;
+    }
+
+    /**
+     * @brief Retrieves the total number of elements; only a hint while other threads operate on the queue.
+     */
+    size_type size() const {
+        size_type total = 0;
+        for (const auto& node : nodes_) {
+            total += node->queue.size();
+        }
+        return total;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Retrieves the number of elements that consumers on node took from other nodes.
+     */
+    size_type stolen_count(size_type node) const {
+        return nodes_.at(node)->stolen.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @brief One node's sub-queue and counters, on cache lines of their own.
+     */
+    struct alignas(cache_line_size) Node {
+        Node(size_type capacity, int os_node, std::vector<size_type> nearest)
+            : queue(capacity, NodeLocalAllocator<T>(os_node)), neighbours(std::move(nearest)) {}
+
+        queue_type queue;
+        std::vector<size_type> neighbours;           ///< The other nodes, nearest first
+        std::atomic<std::ptrdiff_t> items{0};        ///< Queue size, updated after each push and pop
+        std::atomic<size_type> stolen{0};            ///< Elements this node's consumers stole
+    };
+
+    /**
+     * @brief Pops from node, then from its neighbours, nearest first.
+     *
+     * The quick pass only try-locks and skips neighbours whose hint says empty, so a busy or idle
+     * queue costs nothing; the thorough pass, run before a consumer parks, locks every sub-queue,
+     * so that an element published before the consumer announced itself is never missed.
+     */
+    bool scan(size_type node, T& value, bool thorough) {
+        Node& home = *nodes_.at(node);
+        if (take(home, value, thorough)) {
+            return true;
+        }
+        for (size_type victim : home.neighbours) {
+            Node& other = *nodes_[victim];
+            if ((thorough || other.items.load(std::memory_order_relaxed) > 0) && take(other, value, thorough)) {
+                home.stolen.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool take(Node& node, T& value, bool thorough) {
+        const bool taken = thorough ? node.queue.pop_front(value, std::chrono::milliseconds(0))
+                                    : node.queue.try_pop_front(value);
+        if (taken && node.items.fetch_sub(1, std::memory_order_acq_rel) > 1) {
+            not_empty_.notify_one(); // Work is left: pass the wake-up on to the next parked consumer
+        }
+        return taken;
+    }
+
+    /**
+     * @brief Pushes to node, then to its neighbours, without blocking; a busy sub-queue counts as full.
+     */
+    template <typename U>
+    bool try_insert(size_type node, U&& value) {
+        Node& home = *nodes_.at(node);
+        if (give(home, std::forward<U>(value))) {
+            return true;
+        }
+        for (size_type neighbour : home.neighbours) {
+            // A failed push leaves value untouched, so it can be offered again
+            if (give(*nodes_[neighbour], std::forward<U>(value))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename U>
+    void insert(size_type node, U&& value) {
+        if (try_insert(node, std::forward<U>(value))) {
+            return;
+        }
+        Node& home = *nodes_[node];
+        home.queue.push_back(std::forward<U>(value));
+        published(home);
+    }
+
+    template <typename U>
+    bool give(Node& node, U&& value) {
+        if (!node.queue.try_push_back(std::forward<U>(value))) {
+            return false;
+        }
+        published(node);
+        return true;
+    }
+
+    /**
+     * @brief Counts a pushed element and wakes a parked consumer if the sub-queue was empty.
+     *
+     * A push onto a non-empty sub-queue wakes nobody: the consumer woken for an earlier element
+     * wakes the next one from take() if it leaves work behind. Waking on every push would instead
+     * cost a futex call per element while a woken consumer has yet to run. The acq_rel counter
+     * updates chain each push to the pop that sees it, so the notify fence of either side orders
+     * it against a consumer that parked after finding the sub-queue empty.
+     */
+    void published(Node& node) {
+        if (node.items.fetch_add(1, std::memory_order_acq_rel) <= 0) {
+            not_empty_.notify_one();
+        }
+    }
+
+    NumaTopology topology_;                  ///< The nodes the queue is split over
+    std::vector<std::unique_ptr<Node>> nodes_; ///< One sub-queue per node, allocated on that node
+    EventCount not_empty_;                   ///< Parks consumers that found every sub-queue empty
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_NUMA_QUEUE_HPP
@@ -0,0 +1,359 @@
+#ifndef CXX_LAB_NUMA_TOPOLOGY_HPP
+#define CXX_LAB_NUMA_TOPOLOGY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(CXX_LAB_HAVE_LIBNUMA)
+#include <numa.h>
+#endif
+
+namespace cxx_lab {
+
+namespace detail {
+
+/**
+ * @brief Parses a kernel CPU list such as "0-3,8,10-11".
+ *
+ * @return The CPU numbers in order; malformed parts are skipped.
+ */
+inline std::vector<int> parse_cpu_list(std::string_view list) {
+    std::vector<int> cpus;
+    while (!list.empty()) {
+        const std::size_t comma = list.find(',');
+        std::string part(list.substr(0, comma));
+        list = comma == std::string_view::npos ? std::string_view() : list.substr(comma + 1);
+
+        char* end = nullptr;
+        const long first = std::strtol(part.c_str(), &end, 10);
+        if (end == part.c_str()) {
+            continue;
+        }
+        long last = first;
+        if (*end == '-') {
+            const char* range_end = end + 1;
+            last = std::strtol(range_end, &end, 10);
+            if (end == range_end) {
+                continue;
+            }
+        }
+        for (long cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @brief Checks once whether libnuma is present and the kernel supports NUMA policies.
+ */
+inline bool libnuma_available() {
+#if defined(CXX_LAB_HAVE_LIBNUMA)
+    static const bool available = numa_available() >= 0;
+    return available;
+#else
+    return false;
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief The machine's NUMA nodes and their CPUs, for placing threads and memory.
+ *
+ * detect() reads /sys/devices/system/node (no library needed); nodes without CPUs (memory-only
+ * nodes) are left out, and a machine without that directory is one node with every CPU.
+ * Nodes are numbered 0..node_count()-1 here; os_node() gives the kernel's number.
+ *
+ * simulated() splits the CPUs into a number of pretend nodes, so that NUMA-aware code and its
+ * benchmarks can run on a single-node machine; memory is then allocated normally.
+ */
+class NumaTopology {
+public:
+    /**
+     * @brief Constructs a topology from explicit per-node CPU lists.
+     *
+     * @param node_cpus The CPUs of each node.
+     * @param os_nodes The kernel node numbers, or empty for a simulated topology.
+     * @throws std::invalid_argument if there is no node, or os_nodes has the wrong size.
+     */
+    explicit NumaTopology(std::vector<std::vector<int>> node_cpus, std::vector<int> os_nodes = {})
+        : node_cpus_(std::move(node_cpus)), os_nodes_(std::move(os_nodes)) {
+        if (node_cpus_.empty()) {
+            throw std::invalid_argument("A topology needs at least one node.");
+        }
+        if (!os_nodes_.empty() && os_nodes_.size() != node_cpus_.size()) {
+            throw std::invalid_argument("One kernel node number is needed per node.");
+        }
+        distances_.assign(node_cpus_.size(), std::vector<int>(node_cpus_.size(), REMOTE_DISTANCE));
+        for (std::size_t node = 0; node < node_cpus_.size(); ++node) {
+            distances_[node][node] = LOCAL_DISTANCE;
+        }
+        // Walk the nodes backwards, so that a CPU shared by simulated nodes maps to the first one
+        for (std::size_t node = node_cpus_.size(); node-- > 0;) {
+            for (int cpu : node_cpus_[node]) {
+                if (cpu >= 0) {
+                    if (static_cast<std::size_t>(cpu) >= cpu_nodes_.size()) {
+                        cpu_nodes_.resize(static_cast<std::size_t>(cpu) + 1, 0);
+                    }
+                    cpu_nodes_[static_cast<std::size_t>(cpu)] = node;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Reads the topology of this machine.
+     */
+    static NumaTopology detect() {
+        namespace fs = std::filesystem;
+        std::vector<std::pair<int, std::vector<int>>> found;
+        std::error_code error;
+        for (const auto& entry : fs::directory_iterator("/sys/devices/system/node", error)) {
+            const std::string name = entry.path().filename().string();
+            if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+                !std::all_of(name.begin() + 4, name.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+                continue;
+            }
+            std::ifstream file(entry.path() / "cpulist");
+            std::string list;
+            std::getline(file, list);
+            std::vector<int> cpus = detail::parse_cpu_list(list);
+            if (!cpus.empty()) {
+                found.emplace_back(std::stoi(name.substr(4)), std::move(cpus));
+            }
+        }
+        if (found.empty()) {
+            return simulated(1);
+        }
+        std::sort(found.begin(), found.end());
+
+        std::vector<std::vector<int>> node_cpus;
+        std::vector<int> os_nodes;
+        for (auto& [os_node, cpus] : found) {
+            os_nodes.push_back(os_node);
+            node_cpus.push_back(std::move(cpus));
+        }
+        NumaTopology topology(std::move(node_cpus), std::move(os_nodes));
+        topology.read_distances();
+        return topology;
+    }
+
+    /**
+     * @brief Splits this machine's CPUs round-robin into the given number of pretend nodes.
+     *
+     * With fewer CPUs than nodes, nodes share CPUs.
+     *
+     * @throws std::invalid_argument if nodes is zero.
+     */
+    static NumaTopology simulated(std::size_t nodes) {
+        if (nodes == 0) {
+            throw std::invalid_argument("A topology needs at least one node.");
+        }
+        const std::size_t cpu_count = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<std::vector<int>> node_cpus(nodes);
+        for (std::size_t i = 0; i < std::max(cpu_count, nodes); ++i) {
+            node_cpus[i % nodes].push_back(static_cast<int>(i % cpu_count));
+        }
+        return NumaTopology(std::move(node_cpus));
+    }
+
+    std::size_t node_count() const noexcept {
+        return node_cpus_.size();
+    }
+
+    const std::vector<int>& cpus(std::size_t node) const {
+        return node_cpus_.at(node);
+    }
+
+    /**
+     * @brief Checks whether the nodes are pretend ones made by simulated().
+     */
+    bool is_simulated() const noexcept {
+        return os_nodes_.empty();
+    }
+
+    /**
+     * @brief Returns the kernel's number of a node, or -1 for a simulated topology.
+     */
+    int os_node(std::size_t node) const {
+        return os_nodes_.empty() ? -1 : os_nodes_.at(node);
+    }
+
+    /**
+     * @brief Returns the relative access cost between two nodes (10 for local, as in the ACPI SLIT).
+     */
+    int distance(std::size_t from, std::size_t to) const {
+        return distances_.at(from).at(to);
+    }
+
+    /**
+     * @brief Returns the other nodes ordered from nearest to farthest.
+     */
+    std::vector<std::size_t> neighbours(std::size_t node) const {
+        std::vector<std::size_t> others;
+        for (std::size_t other = 0; other < node_count(); ++other) {
+            if (other != node) {
+                others.push_back(other);
+            }
+        }
+        std::stable_sort(others.begin(), others.end(), [&](std::size_t a, std::size_t b) {
+            return distance(node, a) < distance(node, b);
+        });
+        return others;
+    }
+
+    /**
+     * @brief Returns the node a CPU belongs to (the first one, if simulated nodes share it), or 0.
+     */
+    std::size_t node_of_cpu(int cpu) const noexcept {
+        return cpu >= 0 && static_cast<std::size_t>(cpu) < cpu_nodes_.size() ? cpu_nodes_[static_cast<std::size_t>(cpu)] : 0;
+    }
+
+    /**
+     * @brief Returns the node of the CPU the calling thread is running on.
+     */
+    std::size_t current_node() const {
+#if defined(__linux__)
+        const int cpu = sched_getcpu();
+        return cpu < 0 ? 0 : node_of_cpu(cpu);
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief Restricts the calling thread to the CPUs of a node.
+     *
+     * Memory the thread touches first is then placed on that node (for a real topology).
+     *
+     * @return true if the affinity was set, false if the platform does not support it.
+     */
+    bool bind_current_thread(std::size_t node) const {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus(node)) {
+            CPU_SET(cpu, &set);
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        (void)node;
+        return false;
+#endif
+    }
+
+private:
+    static constexpr int LOCAL_DISTANCE = 10;  ///< SLIT distance of a node to itself
+    static constexpr int REMOTE_DISTANCE = 20; ///< Assumed SLIT distance between nodes if unknown
+
+    /**
+     * @brief Reads /sys/devices/system/node/node<N>/distance for the nodes that have CPUs.
+     */
+    void read_distances() {
+        for (std::size_t from = 0; from < node_count(); ++from) {
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(os_nodes_[from]) + "/distance");
+            std::vector<int> row; // Indexed by kernel node number
+            for (int value; file >> value;) {
+                row.push_back(value);
+            }
+            for (std::size_t to = 0; to < node_count(); ++to) {
+                const auto os_to = static_cast<std::size_t>(os_nodes_[to]);
+                if (os_to < row.size()) {
+                    distances_[from][to] = row[os_to];
+                }
+            }
+        }
+    }
+
+    std::vector<std::vector<int>> node_cpus_; ///< CPUs of each node
+    std::vector<int> os_nodes_;               ///< Kernel node numbers; empty if simulated
+    std::vector<std::vector<int>> distances_; ///< SLIT distances between nodes
+    std::vector<std::size_t> cpu_nodes_;      ///< Node of each CPU number
+};
+
+/**
+ * @brief An allocator whose memory lives on one NUMA node.
+ *
+ * Built with libnuma (CXX_LAB_HAVE_LIBNUMA), it allocates with numa_alloc_onnode(). Otherwise,
+ * or for node -1, it relies on the kernel's first-touch policy: it zeroes the memory right away,
+ * so the pages land on the node of the allocating thread, which should be bound to the node
+ * (NumaTopology::bind_current_thread()).
+ *
+ * @tparam T The type of the allocated objects.
+ */
+template <typename T>
+class NodeLocalAllocator {
+public:
+    using value_type = T;
+
+    /**
+     * @param os_node The kernel's node number (NumaTopology::os_node()), or -1 for first touch only.
+     */
+    explicit NodeLocalAllocator(int os_node = -1) noexcept : os_node_(os_node) {}
+
+    template <typename U>
+    NodeLocalAllocator(const NodeLocalAllocator<U>& other) noexcept : os_node_(other.os_node()) {}
+
+    T* allocate(std::size_t n) {
+        const std::size_t bytes = n * sizeof(T);
+#if defined(CXX_LAB_HAVE_LIBNUMA)
+        if (uses_libnuma()) {
+            void* memory = numa_alloc_onnode(bytes, os_node_);
+            if (memory == nullptr) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(memory);
+        }
+#endif
+        void* memory = ::operator new(bytes, std::align_val_t(alignof(T)));
+        std::memset(memory, 0, bytes); // First touch: place the pages now, from this thread
+        return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* pointer, std::size_t n) noexcept {
+#if defined(CXX_LAB_HAVE_LIBNUMA)
+        if (uses_libnuma()) {
+            numa_free(pointer, n * sizeof(T));
+            return;
+        }
+#endif
+        (void)n;
+        ::operator delete(pointer, std::align_val_t(alignof(T)));
+    }
+
+    int os_node() const noexcept {
+        return os_node_;
+    }
+
+    friend bool operator==(const NodeLocalAllocator& a, const NodeLocalAllocator& b) noexcept {
+        return a.os_node_ == b.os_node_;
+    }
+
+private:
+    bool uses_libnuma() const {
+        return os_node_ >= 0 && detail::libnuma_available();
+    }
+
+    int os_node_; ///< Kernel node number, or -1
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_NUMA_TOPOLOGY_HPP
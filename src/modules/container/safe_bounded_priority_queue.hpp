@@ -0,0 +1,479 @@
+#ifndef CXX_LAB_SAFE_BOUNDED_PRIORITY_QUEUE_HPP
+#define CXX_LAB_SAFE_BOUNDED_PRIORITY_QUEUE_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <container/wait_policy.hpp>
+
+namespace cxx_lab {
+
+namespace detail {
+
+/**
+ * @brief An implicit d-ary max-heap (with respect to Compare) on a contiguous vector.
+ *
+ * With Arity = 4 the children of a node are adjacent and usually share a cache line, and the
+ * tree is half as deep as a binary heap, so a pop touches fewer lines at the cost of a few
+ * more comparisons per level. Sifting moves a hole instead of swapping, so each level costs
+ * one move.
+ *
+ * @tparam T The element type.
+ * @tparam Compare Strict weak ordering; the element that compares greatest is on top.
+ * @tparam Arity The number of children per node (at least 2).
+ */
+template <typename T, typename Compare, std::size_t Arity>
+class DAryHeap {
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+public:
+    explicit DAryHeap(Compare compare = Compare()) : compare_(std::move(compare)) {}
+
+    bool empty() const { return items_.empty(); }
+    std::size_t size() const { return items_.size(); }
+    const T& top() const { return items_.front(); }
+
+    /**
+     * @brief Preallocates room for n elements so that pushes up to n do not allocate.
+     */
+    void reserve(std::size_t n) {
+        items_.reserve(n);
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        items_.emplace_back(std::forward<Args>(args)...);
+        sift_up(items_.size() - 1);
+    }
+
+    /**
+     * @brief Removes the top element and returns it.
+     */
+    T pop() {
+        T top = std::move(items_.front());
+        T last = std::move(items_.back());
+        items_.pop_back();
+        if (!items_.empty()) {
+            sift_down(std::move(last));
+        }
+        return top;
+    }
+
+    void clear() {
+        items_.clear();
+    }
+
+private:
+    void sift_up(std::size_t hole) {
+        T value = std::move(items_[hole]);
+        while (hole > 0) {
+            const std::size_t parent = (hole - 1) / Arity;
+            if (!compare_(items_[parent], value)) {
+                break;
+            }
+            items_[hole] = std::move(items_[parent]);
+            hole = parent;
+        }
+        items_[hole] = std::move(value);
+    }
+
+    /**
+     * @brief Places value, taken from the back, starting from the (vacated) root.
+     */
+    void sift_down(T value) {
+        const std::size_t size = items_.size();
+        std::size_t hole = 0;
+        for (;;) {
+            const std::size_t first = hole * Arity + 1;
+            if (first >= size) {
+                break;
+            }
+            const std::size_t last = first + Arity < size ? first + Arity : size;
+            std::size_t best = first;
+            for (std::size_t child = first + 1; child < last; ++child) {
+                if (compare_(items_[best], items_[child])) {
+                    best = child;
+                }
+            }
+            if (!compare_(value, items_[best])) {
+                break;
+            }
+            items_[hole] = std::move(items_[best]);
+            hole = best;
+        }
+        items_[hole] = std::move(value);
+    }
+
+    std::vector<T> items_; ///< Heap-ordered elements, root at index 0
+    Compare compare_;      ///< Orders the elements; greatest on top
+};
+
+template <typename T>
+constexpr bool has_deadline_v = requires(const T& item) { item.deadline < std::chrono::steady_clock::now(); };
+
+template <typename T>
+constexpr bool has_expired_flag_v = requires(T& item) { item.expired = true; };
+
+} // namespace detail
+
+/**
+ * @brief What pops do with an element whose deadline has passed.
+ */
+enum class ExpiryPolicy {
+    Keep, ///< Deliver it like any other element
+    Drop, ///< Discard it and count it in dropped_count()
+    Flag  ///< Deliver it with its `expired` member set to true
+};
+
+/**
+ * @brief An element with an absolute deadline, for earliest-deadline-first scheduling.
+ *
+ * @tparam T The type of the payload.
+ */
+template <typename T>
+struct Deadlined {
+    T value;                                        ///< The payload
+    std::chrono::steady_clock::time_point deadline; ///< The time by which it should be consumed
+    bool expired = false;                           ///< Set by pops under ExpiryPolicy::Flag
+};
+
+/**
+ * @brief Puts the element with the earliest deadline on top of a SafeBoundedPriorityQueue.
+ */
+struct EarliestDeadlineFirst {
+    template <typename T>
+    bool operator()(const T& a, const T& b) const {
+        return a.deadline > b.deadline;
+    }
+};
+
+/**
+ * @brief A thread-safe bounded priority queue.
+ *
+ * The push and pop operations follow SafeBoundedQueue, but pops always return the element
+ * that compares greatest under Compare (as std::priority_queue does), so urgent messages
+ * overtake bulk traffic that is already queued:
+ * - `try_push()`, `try_pop()`: Non-blocking; fail if the queue is full/empty or the lock is busy.
+ * - `push(timeout)`, `pop(timeout)`: Block up to the timeout.
+ * - `push()`, `emplace()`, `pop()`: Block until done.
+ *
+ * Storage is a d-ary heap on a vector reserved for the capacity, so steady-state operations
+ * do not allocate.
+ *
+ * **Earliest deadline first:** store Deadlined<T> (or any type with a `deadline` time point)
+ * and order it with EarliestDeadlineFirst. The ExpiryPolicy given to the constructor then
+ * decides whether pops drop or flag elements whose deadline has passed:
+ * @code
+ * SafeBoundedPriorityQueue<Deadlined<Command>, EarliestDeadlineFirst> queue(1024, ExpiryPolicy::Drop);
+ * queue.push({command, std::chrono::steady_clock::now() + std::chrono::milliseconds(5)});
+ * @endcode
+ *
+ * @tparam T The type of elements stored in the queue.
+ * @tparam Compare The priority order; the greatest element is popped first (default is std::less<T>).
+ * @tparam Arity The number of children per heap node (default is 4).
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
+ */
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4, typename Wait = ConditionVariableWait>
+class SafeBoundedPriorityQueue {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+    using condition_type = typename Wait::template condition_type<std::mutex>;
+
+    /**
+     * @brief Constructs a SafeBoundedPriorityQueue with a specified capacity.
+     *
+     * @param capacity The maximum number of elements the queue can hold.
+     * @param expiry What pops do with expired elements; requires T to have a `deadline` unless Keep.
+     * @param compare The priority order.
+     * @throws std::invalid_argument if capacity is zero, or if expiry is not Keep and T has no
+     *         deadline (or, for Flag, no `expired` member).
+     */
+    explicit SafeBoundedPriorityQueue(size_type capacity = DEFAULT_CAPACITY,
+                                      ExpiryPolicy expiry = ExpiryPolicy::Keep,
+                                      Compare compare = Compare())
+        : mutex_(), not_empty_(), not_full_(), heap_(std::move(compare)), capacity_(capacity), expiry_(expiry) {
+        if (capacity_ == 0) {
+            throw std::invalid_argument("Capacity must be greater than zero.");
+        }
+        if (expiry_ != ExpiryPolicy::Keep && !detail::has_deadline_v<T>) {
+            throw std::invalid_argument("Expiry policies need elements with a deadline.");
+        }
+        if (expiry_ == ExpiryPolicy::Flag && !detail::has_expired_flag_v<T>) {
+            throw std::invalid_argument("ExpiryPolicy::Flag needs elements with an expired member.");
+        }
+        heap_.reserve(capacity_);
+    }
+
+    // =====================
+    // Push Operations
+    // =====================
+
+    /**
+     * @brief Attempts to push an element without blocking.
+     *
+     * @param value The element to push.
+     * @return true if the push was successful, false otherwise (e.g., queue is full or lock not acquired).
+     */
+    bool try_push(const T& value) {
+        return try_insert([&]() { heap_.emplace(value); });
+    }
+
+    /**
+     * @brief Attempts to move an element in without blocking.
+     *
+     * @param value The element to push. It is left untouched if the push fails.
+     * @return true if the push was successful, false otherwise (e.g., queue is full or lock not acquired).
+     */
+    bool try_push(T&& value) {
+        return try_insert([&]() { heap_.emplace(std::move(value)); });
+    }
+
+    /**
+     * @brief Attempts to push an element, blocking until there is room or the timeout occurs.
+     *
+     * @param value The element to push.
+     * @param timeout The maximum duration to wait for room.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push(const T& value, const std::chrono::milliseconds& timeout) {
+        return insert_for(timeout, [&]() { heap_.emplace(value); });
+    }
+
+    /**
+     * @brief Attempts to move an element in, blocking until there is room or the timeout occurs.
+     *
+     * @param value The element to push. It is left untouched if the timeout occurs.
+     * @param timeout The maximum duration to wait for room.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push(T&& value, const std::chrono::milliseconds& timeout) {
+        return insert_for(timeout, [&]() { heap_.emplace(std::move(value)); });
+    }
+
+    /**
+     * @brief Pushes an element, blocking until there is room.
+     *
+     * @param value The element to push.
+     */
+    void push(const T& value) {
+        insert([&]() { heap_.emplace(value); });
+    }
+
+    /**
+     * @brief Moves an element in, blocking until there is room.
+     *
+     * @param value The element to push.
+     */
+    void push(T&& value) {
+        insert([&]() { heap_.emplace(std::move(value)); });
+    }
+
+    /**
+     * @brief Constructs an element in place, blocking until there is room.
+     *
+     * @tparam Args The types of the arguments to construct the element.
+     * @param args The arguments to pass to the element's constructor.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        insert([&]() { heap_.emplace(std::forward<Args>(args)...); });
+    }
+
+    // =====================
+    // Pop Operations
+    // =====================
+
+    /**
+     * @brief Attempts to pop the highest-priority element without blocking.
+     *
+     * @param value Reference to store the popped element.
+     * @return true if the pop was successful, false otherwise (e.g., queue is empty, only expired
+     *         elements were dropped, or lock not acquired).
+     */
+    bool try_pop(T& value) {
+        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return false; // Unable to acquire lock immediately
+        }
+        return take(value);
+    }
+
+    /**
+     * @brief Attempts to pop the highest-priority element, blocking until one is available or timeout occurs.
+     *
+     * @param value Reference to store the popped element.
+     * @param timeout The maximum duration to wait for an element.
+     * @return true if the pop was successful within the timeout, false otherwise.
+     */
+    bool pop(T& value, const std::chrono::milliseconds& timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!take(value)) {
+            if (not_empty_.wait_until(lock, deadline) == std::cv_status::timeout) {
+                return take(value); // Timeout occurred, one last look
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Pops the highest-priority element, blocking until one is available.
+     *
+     * @param value Reference to store the popped element.
+     */
+    void pop(T& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!take(value)) {
+            not_empty_.wait(lock);
+        }
+    }
+
+    // =====================
+    // Utility Methods
+    // =====================
+
+    /**
+     * @brief Removes every element.
+     */
+    void clear() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        heap_.clear();
+        not_full_.notify_all();
+    }
+
+    bool empty() const {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return heap_.empty();
+    }
+
+    size_type size() const {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return heap_.size();
+    }
+
+    size_type capacity() const {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return capacity_;
+    }
+
+    /**
+     * @brief Sets the maximum capacity of the queue.
+     *
+     * Unlike SafeBoundedQueue, shrinking below the current size keeps every element (a heap has
+     * no cheap "lowest priority" end to truncate); pushes block until pops bring the size under
+     * the new capacity.
+     *
+     * @param new_capacity The new maximum capacity.
+     * @throws std::invalid_argument if new_capacity is zero.
+     */
+    void set_capacity(size_type new_capacity) {
+        if (new_capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than zero.");
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        capacity_ = new_capacity;
+        heap_.reserve(capacity_);
+        not_full_.notify_all();
+    }
+
+    /**
+     * @brief Retrieves the number of expired elements discarded under ExpiryPolicy::Drop.
+     */
+    size_type dropped_count() const {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return dropped_;
+    }
+
+private:
+    static constexpr size_type DEFAULT_CAPACITY = 1000; ///< Default queue capacity
+
+    template <typename InsertOp>
+    bool try_insert(InsertOp&& insert_op) {
+        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return false; // Unable to acquire lock immediately
+        }
+        if (heap_.size() >= capacity_) {
+            return false; // Queue is full
+        }
+        insert_op();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    template <typename InsertOp>
+    bool insert_for(const std::chrono::milliseconds& timeout, InsertOp&& insert_op) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!not_full_.wait_for(lock, timeout, [this]() { return heap_.size() < capacity_; })) {
+            return false; // Timeout occurred
+        }
+        insert_op();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    template <typename InsertOp>
+    void insert(InsertOp&& insert_op) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this]() { return heap_.size() < capacity_; });
+        insert_op();
+        not_empty_.notify_one();
+    }
+
+    /**
+     * @brief Pops the top element into value, applying the expiry policy. Called with mutex_ held.
+     *
+     * @return false if the queue is empty (possibly after dropping expired elements).
+     */
+    bool take(T& value) {
+        size_type freed = 0;
+        if constexpr (detail::has_deadline_v<T>) {
+            if (expiry_ == ExpiryPolicy::Drop) {
+                // Under EDF the expired elements are on top; under other orders they are
+                // dropped as they surface
+                const auto now = std::chrono::steady_clock::now();
+                while (!heap_.empty() && heap_.top().deadline < now) {
+                    heap_.pop();
+                    ++dropped_;
+                    ++freed;
+                }
+            }
+        }
+        const bool popped = !heap_.empty();
+        if (popped) {
+            value = heap_.pop();
+            ++freed;
+            if constexpr (detail::has_deadline_v<T> && detail::has_expired_flag_v<T>) {
+                if (expiry_ == ExpiryPolicy::Flag) {
+                    value.expired = value.deadline < std::chrono::steady_clock::now();
+                }
+            }
+        }
+        if (freed == 1) {
+            not_full_.notify_one();
+        } else if (freed > 1) {
+            not_full_.notify_all();
+        }
+        return popped;
+    }
+
+    mutable std::mutex mutex_;                      ///< Mutex to protect access to the heap
+    condition_type not_empty_;                      ///< Condition variable for not empty
+    condition_type not_full_;                       ///< Condition variable for not full
+    detail::DAryHeap<T, Compare, Arity> heap_;      ///< Heap-ordered elements
+    size_type capacity_;                            ///< Maximum capacity of the queue
+    ExpiryPolicy expiry_;                           ///< Handling of expired elements on pop
+    size_type dropped_ = 0;                         ///< Expired elements discarded so far
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_SAFE_BOUNDED_PRIORITY_QUEUE_HPP
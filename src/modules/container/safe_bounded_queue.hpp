@@ -1,13 +1,25 @@
 #ifndef CXX_LAB_SAFE_BOUNDED_QUEUE_HPP
 #define CXX_LAB_SAFE_BOUNDED_QUEUE_HPP
 
+#include <algorithm>
 #include <deque>
+#include <iterator>
 #include <mutex>
 #include <condition_variable>
 #include <chrono>
 #include <functional>
+#include <optional>
 #include <utility>
 #include <stdexcept>
+#include <vector>
+
+#include <boost/asio/compose.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <container/async_wait_list.hpp>
+#include <container/container_stats.hpp>
+#include <container/fixed_ring.hpp>
+#include <container/wait_policy.hpp>
 
 namespace cxx_lab {
 
@@ -18,10 +30,20 @@ namespace cxx_lab {
  * providing synchronized access and modification methods. It supports both non-blocking
  * and blocking operations, with options for timeouts, ensuring safe concurrent usage.
  *
+ * `async_pop_front()` and `async_push_back()` wait without blocking a thread, so coroutines on
+ * an Asio executor can share the queue with threads using the blocking operations.
+ *
+ * If the container has a `set_capacity()` member, the queue sizes it to its own capacity at
+ * construction and in `set_capacity()`. With FixedRing<T> this preallocates every slot, so
+ * steady-state pushes and pops do not allocate.
+ *
  * @tparam T The type of elements stored in the queue.
- * @tparam Container The type of the underlying container (default is std::deque<T>).
+ * @tparam Container The type of the underlying container (default is std::deque<T>, or FixedRing<T>).
+ * @tparam Stats The stats policy: NullContainerStats (no instrumentation) or ContainerStats.
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
  */
-template <typename T, typename Container = std::deque<T>>
+template <typename T, typename Container = std::deque<T>, typename Stats = NullContainerStats,
+          typename Wait = ConditionVariableWait>
 class SafeBoundedQueue {
 public:
     using container_type = Container;
@@ -29,7 +51,9 @@ public:
     using size_type = typename Container::size_type;
     using reference = typename Container::reference;
     using iterator = typename Container::iterator;
+    using condition_type = typename Wait::template condition_type<std::mutex>;
     using const_reference = typename Container::const_reference;
+    using allocator_type = typename Container::allocator_type;
 
     /**
      * @brief Constructs a SafeBoundedQueue with a specified capacity.
@@ -39,10 +63,28 @@ public:
      * @throws std::invalid_argument if capacity is zero.
      */
     explicit SafeBoundedQueue(size_type capacity = DEFAULT_CAPACITY) 
-        : mutex_(), not_empty_(), not_full_(), container_(), capacity_(capacity) {
+        : mutex_(), not_empty_(), not_full_(), async_not_empty_(), async_not_full_(), container_(), capacity_(capacity), stats_() {
+        if (capacity_ == 0) {
+            throw std::invalid_argument("Capacity must be greater than zero.");
+        }
+        fit_storage();
+    }
+
+    /**
+     * @brief Constructs a SafeBoundedQueue whose container allocates with alloc.
+     *
+     * E.g. a FixedRing with a NodeLocalAllocator, to place the slots on one NUMA node.
+     *
+     * @param capacity The maximum number of elements the queue can hold.
+     * @param alloc The allocator of the underlying container.
+     * @throws std::invalid_argument if capacity is zero.
+     */
+    SafeBoundedQueue(size_type capacity, const allocator_type& alloc)
+        : mutex_(), not_empty_(), not_full_(), async_not_empty_(), async_not_full_(), container_(alloc), capacity_(capacity), stats_() {
         if (capacity_ == 0) {
             throw std::invalid_argument("Capacity must be greater than zero.");
         }
+        fit_storage();
     }
 
     // =====================
@@ -56,16 +98,17 @@ public:
      * @return true if the push was successful, false otherwise (e.g., queue is full or lock not acquired).
      */
     bool try_push_back(const T& value) {
-        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
-        if (!lock.owns_lock()) {
-            return false; // Unable to acquire lock immediately
-        }
-        if (container_.size() >= capacity_) {
-            return false; // Queue is full
-        }
-        container_.push_back(value);
-        not_empty_.notify_one();
-        return true;
+        return try_insert([&]() { container_.push_back(value); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the back without blocking.
+     *
+     * @param value The element to push. It is left untouched if the push fails.
+     * @return true if the push was successful, false otherwise (e.g., queue is full or lock not acquired).
+     */
+    bool try_push_back(T&& value) {
+        return try_insert([&]() { container_.push_back(std::move(value)); });
     }
 
     /**
@@ -75,16 +118,17 @@ public:
      * @return true if the push was successful, false otherwise (e.g., queue is full or lock not acquired).
      */
     bool try_push_front(const T& value) {
-        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
-        if (!lock.owns_lock()) {
-            return false; // Unable to acquire lock immediately
-        }
-        if (container_.size() >= capacity_) {
-            return false; // Queue is full
-        }
-        container_.push_front(value);
-        not_empty_.notify_one();
-        return true;
+        return try_insert([&]() { container_.push_front(value); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the front without blocking.
+     *
+     * @param value The element to push. It is left untouched if the push fails.
+     * @return true if the push was successful, false otherwise (e.g., queue is full or lock not acquired).
+     */
+    bool try_push_front(T&& value) {
+        return try_insert([&]() { container_.push_front(std::move(value)); });
     }
 
     // =====================
@@ -99,13 +143,18 @@ public:
      * @return true if the push was successful within the timeout, false otherwise.
      */
     bool push_back(const T& value, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        if (!not_full_.wait_for(lock, timeout, [this]() { return container_.size() < capacity_; })) {
-            return false; // Timeout occurred
-        }
-        container_.push_back(value);
-        not_empty_.notify_one();
-        return true;
+        return insert_for(timeout, [&]() { container_.push_back(value); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the back, blocking until the push is successful or timeout occurs.
+     *
+     * @param value The element to push. It is left untouched if the timeout occurs.
+     * @param timeout The maximum duration to wait for the push to succeed.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push_back(T&& value, const std::chrono::milliseconds& timeout) {
+        return insert_for(timeout, [&]() { container_.push_back(std::move(value)); });
     }
 
     /**
@@ -116,13 +165,18 @@ public:
      * @return true if the push was successful within the timeout, false otherwise.
      */
     bool push_front(const T& value, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        if (!not_full_.wait_for(lock, timeout, [this]() { return container_.size() < capacity_; })) {
-            return false; // Timeout occurred
-        }
-        container_.push_front(value);
-        not_empty_.notify_one();
-        return true;
+        return insert_for(timeout, [&]() { container_.push_front(value); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the front, blocking until the push is successful or timeout occurs.
+     *
+     * @param value The element to push. It is left untouched if the timeout occurs.
+     * @param timeout The maximum duration to wait for the push to succeed.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push_front(T&& value, const std::chrono::milliseconds& timeout) {
+        return insert_for(timeout, [&]() { container_.push_front(std::move(value)); });
     }
 
     // =====================
@@ -135,10 +189,16 @@ public:
      * @param value The element to push.
      */
     void push_back(const T& value) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        not_full_.wait(lock, [this]() { return container_.size() < capacity_; });
-        container_.push_back(value);
-        not_empty_.notify_one();
+        insert([&]() { container_.push_back(value); });
+    }
+
+    /**
+     * @brief Moves an element to the back, blocking until the push is successful.
+     *
+     * @param value The element to push.
+     */
+    void push_back(T&& value) {
+        insert([&]() { container_.push_back(std::move(value)); });
     }
 
     /**
@@ -147,10 +207,38 @@ public:
      * @param value The element to push.
      */
     void push_front(const T& value) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        not_full_.wait(lock, [this]() { return container_.size() < capacity_; });
-        container_.push_front(value);
-        not_empty_.notify_one();
+        insert([&]() { container_.push_front(value); });
+    }
+
+    /**
+     * @brief Moves an element to the front, blocking until the push is successful.
+     *
+     * @param value The element to push.
+     */
+    void push_front(T&& value) {
+        insert([&]() { container_.push_front(std::move(value)); });
+    }
+
+    /**
+     * @brief Constructs an element in place at the back, blocking until there is room.
+     *
+     * @tparam Args The types of the arguments to construct the element.
+     * @param args The arguments to pass to the element's constructor.
+     */
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        insert([&]() { container_.emplace_back(std::forward<Args>(args)...); });
+    }
+
+    /**
+     * @brief Constructs an element in place at the front, blocking until there is room.
+     *
+     * @tparam Args The types of the arguments to construct the element.
+     * @param args The arguments to pass to the element's constructor.
+     */
+    template <typename... Args>
+    void emplace_front(Args&&... args) {
+        insert([&]() { container_.emplace_front(std::forward<Args>(args)...); });
     }
 
     // =====================
@@ -164,16 +252,17 @@ public:
      * @return true if the pop was successful, false otherwise (e.g., queue is empty or lock not acquired).
      */
     bool try_pop_back(T& value) {
-        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
-        if (!lock.owns_lock()) {
+        std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false; // Unable to acquire lock immediately
         }
         if (container_.empty()) {
+            stats_.record_try_empty();
             return false; // Queue is empty
         }
-        value = container_.back();
+        value = std::move(container_.back());
         container_.pop_back();
-        not_full_.notify_one();
+        notify_not_full(1);
         return true;
     }
 
@@ -184,16 +273,17 @@ public:
      * @return true if the pop was successful, false otherwise (e.g., queue is empty or lock not acquired).
      */
     bool try_pop_front(T& value) {
-        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
-        if (!lock.owns_lock()) {
+        std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false; // Unable to acquire lock immediately
         }
         if (container_.empty()) {
+            stats_.record_try_empty();
             return false; // Queue is empty
         }
-        value = container_.front();
+        value = std::move(container_.front());
         container_.pop_front();
-        not_full_.notify_one();
+        notify_not_full(1);
         return true;
     }
 
@@ -209,13 +299,13 @@ public:
      * @return true if the pop was successful within the timeout, false otherwise.
      */
     bool pop_back(T& value, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         if (!not_empty_.wait_for(lock, timeout, [this]() { return !container_.empty(); })) {
             return false; // Timeout occurred
         }
-        value = container_.back();
+        value = std::move(container_.back());
         container_.pop_back();
-        not_full_.notify_one();
+        notify_not_full(1);
         return true;
     }
 
@@ -227,13 +317,13 @@ public:
      * @return true if the pop was successful within the timeout, false otherwise.
      */
     bool pop_front(T& value, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         if (!not_empty_.wait_for(lock, timeout, [this]() { return !container_.empty(); })) {
             return false; // Timeout occurred
         }
-        value = container_.front();
+        value = std::move(container_.front());
         container_.pop_front();
-        not_full_.notify_one();
+        notify_not_full(1);
         return true;
     }
 
@@ -247,11 +337,11 @@ public:
      * @param value Reference to store the popped element.
      */
     void pop_back(T& value) {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         not_empty_.wait(lock, [this]() { return !container_.empty(); });
-        value = container_.back();
+        value = std::move(container_.back());
         container_.pop_back();
-        not_full_.notify_one();
+        notify_not_full(1);
     }
 
     /**
@@ -260,11 +350,123 @@ public:
      * @param value Reference to store the popped element.
      */
     void pop_front(T& value) {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         not_empty_.wait(lock, [this]() { return !container_.empty(); });
-        value = container_.front();
+        value = std::move(container_.front());
         container_.pop_front();
-        not_full_.notify_one();
+        notify_not_full(1);
+    }
+
+    // =====================
+    // Bulk Operations
+    // =====================
+
+    /**
+     * @brief Pushes a range of elements to the back, blocking until all of them are in the queue.
+     *
+     * Elements are inserted under a single lock acquisition and a single notification for as
+     * long as there is room; the call only waits again when the queue fills up mid-range.
+     * Pass std::make_move_iterator() iterators to move the elements in.
+     *
+     * @tparam InputIt An input iterator whose value is convertible to T.
+     * @param first The beginning of the range to push.
+     * @param last The end of the range to push.
+     * @return The number of elements pushed.
+     */
+    template <typename InputIt>
+    size_type push_back_bulk(InputIt first, InputIt last) {
+        size_type pushed = 0;
+        std::unique_lock<std::mutex> lock = acquire();
+        while (first != last) {
+            not_full_.wait(lock, [this]() { return container_.size() < capacity_; });
+            size_type batch = 0;
+            for (; first != last && container_.size() < capacity_; ++first, ++batch) {
+                container_.push_back(*first);
+            }
+            pushed += batch;
+            stats_.record_size(container_.size());
+            notify_not_empty(batch);
+        }
+        return pushed;
+    }
+
+    /**
+     * @brief Pops up to max_n elements from the front, blocking until at least one is available or timeout occurs.
+     *
+     * All available elements (up to max_n) are moved out under a single lock acquisition and a
+     * single notification.
+     *
+     * @tparam OutputIt An output iterator accepting T.
+     * @param out The destination of the popped elements.
+     * @param max_n The maximum number of elements to pop.
+     * @param timeout The maximum duration to wait for the first element.
+     * @return The number of elements popped (0 if the timeout occurred).
+     */
+    template <typename OutputIt>
+    size_type pop_front_bulk(OutputIt out, size_type max_n, const std::chrono::milliseconds& timeout) {
+        std::unique_lock<std::mutex> lock = acquire();
+        if (max_n == 0 || !not_empty_.wait_for(lock, timeout, [this]() { return !container_.empty(); })) {
+            return 0; // Nothing requested or timeout occurred
+        }
+        const size_type count = std::min(max_n, container_.size());
+        auto last = std::next(container_.begin(), count);
+        std::move(container_.begin(), last, out);
+        container_.erase(container_.begin(), last);
+        notify_not_full(count);
+        return count;
+    }
+
+    /**
+     * @brief Moves every element currently in the queue to the back of a vector without blocking for elements.
+     *
+     * @param values The vector receiving the elements; existing contents are kept.
+     * @return The number of elements moved.
+     */
+    size_type drain_into(std::vector<T>& values) {
+        std::unique_lock<std::mutex> lock = acquire();
+        const size_type count = container_.size();
+        values.reserve(values.size() + count);
+        std::move(container_.begin(), container_.end(), std::back_inserter(values));
+        container_.clear();
+        notify_not_full(count);
+        return count;
+    }
+
+    // =====================
+    // Asynchronous Operations
+    // =====================
+
+    /**
+     * @brief Asynchronously pops an element from the front, suspending until one is available.
+     *
+     * The waiting operation occupies no thread: it is parked on the queue and resumed on its
+     * handler's executor by the push that makes an element available. The queue must outlive
+     * the operation.
+     *
+     * @param token The completion token for `void(boost::system::error_code, T)`,
+     *              e.g. boost::asio::use_awaitable.
+     * @return Whatever the completion token produces.
+     */
+    template <typename CompletionToken>
+    auto async_pop_front(CompletionToken&& token) {
+        return boost::asio::async_compose<CompletionToken, void(boost::system::error_code, T)>(
+            detail::AsyncRetryOp<T, PopFrontAttempt>(PopFrontAttempt{this}), token);
+    }
+
+    /**
+     * @brief Asynchronously pushes an element to the back, suspending until there is room.
+     *
+     * The waiting operation occupies no thread: it is parked on the queue and resumed on its
+     * handler's executor by the pop that frees a slot. The queue must outlive the operation.
+     *
+     * @param value The element to push; it is owned by the operation until inserted.
+     * @param token The completion token for `void(boost::system::error_code)`.
+     * @return Whatever the completion token produces.
+     */
+    template <typename CompletionToken>
+    auto async_push_back(T value, CompletionToken&& token) {
+        return boost::asio::async_compose<CompletionToken, void(boost::system::error_code)>(
+            detail::AsyncRetryOp<void, PushBackAttempt>(PushBackAttempt{this, std::move(value)}), token);
     }
 
     // =====================
@@ -279,11 +481,12 @@ public:
      * @return true if the access was successful, false otherwise (e.g., queue is too small or lock not acquired).
      */
     bool try_at(size_type index, T& value) const {
-        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
-        if (!lock.owns_lock()) {
+        std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false; // Unable to acquire lock immediately
         }
         if (index >= container_.size()) {
+            stats_.record_try_empty();
             return false; // Index out of bounds
         }
         value = container_.at(index);
@@ -303,7 +506,7 @@ public:
      * @return true if the access was successful within the timeout, false otherwise.
      */
     bool at(size_type index, T& value, const std::chrono::milliseconds& timeout) const {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         // Wait until the queue has enough elements
         if (!not_empty_.wait_for(lock, timeout, [this, index]() { return container_.size() > index; })) {
             return false; // Timeout occurred
@@ -323,11 +526,47 @@ public:
      * @param value Reference to store the accessed element.
      */
     void at(size_type index, T& value) const {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         not_empty_.wait(lock, [this, index]() { return container_.size() > index; });
         value = container_.at(index);
     }
 
+    // =====================
+    // In-Place Visiting
+    // =====================
+
+    /**
+     * @brief Runs func on the element at the specified index in place, while holding the lock.
+     *
+     * Index 0 is the front of the queue. func must not call back into this queue.
+     *
+     * @param index The index of the element to visit.
+     * @param func A callable taking a const T&.
+     * @return true if the element was visited, false if the index is out of bounds.
+     */
+    template <typename F>
+    bool visit_at(size_type index, F&& func) const {
+        std::unique_lock<std::mutex> lock = acquire();
+        if (index >= container_.size()) {
+            return false;
+        }
+        func(std::as_const(container_)[index]);
+        return true;
+    }
+
+    /**
+     * @brief Runs func on every element in place, front to back, while holding the lock.
+     *
+     * @param func A callable taking a const T&; it must not call back into this queue.
+     */
+    template <typename F>
+    void for_each_locked(F&& func) const {
+        std::unique_lock<std::mutex> lock = acquire();
+        for (const auto& value : container_) {
+            func(value);
+        }
+    }
+
     // =====================
     // Front and Back Access
     // =====================
@@ -338,7 +577,7 @@ public:
      * @return Reference to the front element.
      */
     reference front() {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         not_empty_.wait(lock, [this]() { return !container_.empty(); });
         return container_.front();
     }
@@ -349,7 +588,7 @@ public:
      * @return Const reference to the front element.
      */
     const_reference front() const {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         not_empty_.wait(lock, [this]() { return !container_.empty(); });
         return container_.front();
     }
@@ -360,7 +599,7 @@ public:
      * @return Reference to the back element.
      */
     reference back() {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         not_empty_.wait(lock, [this]() { return !container_.empty(); });
         return container_.back();
     }
@@ -371,7 +610,7 @@ public:
      * @return Const reference to the back element.
      */
     const_reference back() const {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         not_empty_.wait(lock, [this]() { return !container_.empty(); });
         return container_.back();
     }
@@ -389,10 +628,28 @@ public:
      * @param func A function that takes a reference to the associative container.
      */
     void access(const std::function<void(Container&)>& func) {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         func(container_);
     }
 
+    /**
+     * @brief Runs func on the underlying container under the lock and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access(Func&& func) {
+        std::unique_lock<std::mutex> lock = acquire();
+        return std::forward<Func>(func)(container_);
+    }
+
+    /**
+     * @brief Runs func on the underlying container, read-only, and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access_shared(Func&& func) const {
+        std::unique_lock<std::mutex> lock = acquire();
+        return std::forward<Func>(func)(std::as_const(container_));
+    }
+
     // =====================
     // Utility Functions
     // =====================
@@ -401,9 +658,9 @@ public:
      * @brief Clears all elements from the queue.
      */
     void clear() {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         container_.clear();
-        not_full_.notify_all(); // Notify all waiting push operations
+        notify_not_full(capacity_); // Notify all waiting push operations
     }
 
     /**
@@ -416,13 +673,14 @@ public:
      * @throws std::length_error if count exceeds the current capacity.
      */
     void resize(size_type count) {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         if (count > capacity_) {
             throw std::length_error("Resize count exceeds queue capacity.");
         }
         container_.resize(count);
+        stats_.record_size(container_.size());
         if (container_.size() < capacity_) {
-            not_full_.notify_all(); // Notify any waiting push operations
+            notify_not_full(capacity_ - container_.size()); // Notify any waiting push operations
         }
     }
 
@@ -432,7 +690,7 @@ public:
      * @return true if empty, false otherwise.
      */
     bool empty() const {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         return container_.empty();
     }
 
@@ -442,7 +700,7 @@ public:
      * @return The number of elements.
      */
     size_type size() const {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         return container_.size();
     }
 
@@ -450,6 +708,7 @@ public:
      * @brief Sets the maximum capacity of the queue.
      *
      * If the new capacity is less than the current size, the queue is truncated.
+     * A preallocating container such as FixedRing is reallocated here and only here.
      *
      * @param new_capacity The new maximum capacity.
      * @throws std::invalid_argument if new_capacity is zero.
@@ -458,13 +717,14 @@ public:
         if (new_capacity == 0) {
             throw std::invalid_argument("Capacity must be greater than zero.");
         }
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         capacity_ = new_capacity;
         if (container_.size() > capacity_) {
             // Truncate the queue to the new capacity
             container_.resize(capacity_);
         }
-        not_full_.notify_all(); // Notify any waiting push operations
+        fit_storage();
+        notify_not_full(capacity_ - container_.size()); // Notify any waiting push operations
     }
 
     /**
@@ -473,18 +733,176 @@ public:
      * @return The maximum capacity.
      */
     size_type capacity() const {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<std::mutex> lock = acquire();
         return capacity_;
     }
 
+    /**
+     * @brief Provides the stats policy, e.g. to take a periodic snapshot or reset it.
+     *
+     * With the default NullContainerStats the snapshot is always empty.
+     *
+     * @return The stats policy of this queue.
+     */
+    Stats& stats() const {
+        return stats_;
+    }
+
 private:
     static constexpr size_type DEFAULT_CAPACITY = 1000; ///< Default queue capacity
 
+    /**
+     * @brief Locks mutex_, recording the time spent waiting in stats_.
+     */
+    std::unique_lock<std::mutex> acquire() const {
+        std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
+    /**
+     * @brief Sizes preallocated storage (e.g. FixedRing) to capacity_; a no-op for std::deque.
+     */
+    void fit_storage() {
+        if constexpr (requires(Container& c, size_type n) { c.set_capacity(n); }) {
+            container_.set_capacity(capacity_);
+        }
+    }
+
+    /**
+     * @brief Runs insert_op if the lock is free and the queue has room, without blocking.
+     */
+    template <typename InsertOp>
+    bool try_insert(InsertOp&& insert_op) {
+        std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+        if (!detail::try_lock_with_stats(stats_, lock)) {
+            return false; // Unable to acquire lock immediately
+        }
+        if (container_.size() >= capacity_) {
+            stats_.record_try_full();
+            return false; // Queue is full
+        }
+        insert_op();
+        stats_.record_size(container_.size());
+        notify_not_empty(1);
+        return true;
+    }
+
+    /**
+     * @brief Runs insert_op once the queue has room, waiting up to timeout.
+     */
+    template <typename InsertOp>
+    bool insert_for(const std::chrono::milliseconds& timeout, InsertOp&& insert_op) {
+        std::unique_lock<std::mutex> lock = acquire();
+        if (!not_full_.wait_for(lock, timeout, [this]() { return container_.size() < capacity_; })) {
+            return false; // Timeout occurred
+        }
+        insert_op();
+        stats_.record_size(container_.size());
+        notify_not_empty(1);
+        return true;
+    }
+
+    /**
+     * @brief Runs insert_op once the queue has room, waiting as long as necessary.
+     */
+    template <typename InsertOp>
+    void insert(InsertOp&& insert_op) {
+        std::unique_lock<std::mutex> lock = acquire();
+        not_full_.wait(lock, [this]() { return container_.size() < capacity_; });
+        insert_op();
+        stats_.record_size(container_.size());
+        notify_not_empty(1);
+    }
+
+    /**
+     * @brief Pops into result, or parks self until the next push. Used by async_pop_front().
+     */
+    template <typename Self>
+    bool pop_front_or_park(std::optional<T>& result, Self& self) {
+        std::unique_lock<std::mutex> lock = acquire();
+        if (container_.empty()) {
+            async_not_empty_.park(std::move(self));
+            return false;
+        }
+        result.emplace(std::move(container_.front()));
+        container_.pop_front();
+        notify_not_full(1);
+        return true;
+    }
+
+    /**
+     * @brief Pushes value, or parks self until the next pop. Used by async_push_back().
+     */
+    template <typename Self>
+    bool push_back_or_park(T& value, Self& self) {
+        std::unique_lock<std::mutex> lock = acquire();
+        if (container_.size() >= capacity_) {
+            async_not_full_.park(std::move(self));
+            return false;
+        }
+        container_.push_back(std::move(value));
+        stats_.record_size(container_.size());
+        notify_not_empty(1);
+        return true;
+    }
+
+    struct PopFrontAttempt {
+        SafeBoundedQueue* queue;
+
+        template <typename Self>
+        bool operator()(std::optional<T>& result, Self& self) const {
+            return queue->pop_front_or_park(result, self);
+        }
+    };
+
+    struct PushBackAttempt {
+        SafeBoundedQueue* queue;
+        T value;
+
+        template <typename Self>
+        bool operator()(Self& self) {
+            return queue->push_back_or_park(value, self);
+        }
+    };
+
+    /**
+     * @brief Wakes up to count threads and asynchronous operations waiting for elements.
+     */
+    void notify_not_empty(size_type count) {
+        notify_batch(not_empty_, count);
+        async_not_empty_.wake(count);
+    }
+
+    /**
+     * @brief Wakes up to count threads and asynchronous operations waiting for free slots.
+     */
+    void notify_not_full(size_type count) {
+        notify_batch(not_full_, count);
+        async_not_full_.wake(count);
+    }
+
+    /**
+     * @brief Wakes as many waiters as there are new elements (or free slots) in one call.
+     */
+    void notify_batch(condition_type& cond, size_type count) {
+        if (count == 1) {
+            stats_.record_notify_one();
+            cond.notify_one();
+        } else if (count > 1) {
+            stats_.record_notify_all();
+            cond.notify_all();
+        }
+    }
+
     mutable std::mutex mutex_;                     ///< Mutex to protect container access
-    mutable std::condition_variable not_empty_;    ///< Condition variable to signal element availability
-    mutable std::condition_variable not_full_;     ///< Condition variable to signal space availability
+    mutable condition_type not_empty_;            ///< Condition variable to signal element availability
+    mutable condition_type not_full_;             ///< Condition variable to signal space availability
+    detail::AsyncWaitList async_not_empty_;        ///< Asynchronous pops waiting for elements
+    detail::AsyncWaitList async_not_full_;         ///< Asynchronous pushes waiting for space
     Container container_;                          ///< Underlying associative container
     size_type capacity_;                           ///< Maximum capacity of the queue
+    [[no_unique_address]] mutable Stats stats_;    ///< Contention counters (empty unless a stats policy is selected)
 };
 
 } // namespace cxx_lab
@@ -7,9 +7,21 @@
 #include <chrono>
 #include <functional>
 #include <stdexcept>
+#include <utility>
+
+#include <container/container_stats.hpp>
+#include <container/wait_policy.hpp>
 
 namespace cxx_lab {
 
+/**
+ * @brief What the non-blocking pushes of a SafeCircularQueue do when the buffer is full.
+ */
+enum class OverflowPolicy {
+    Reject,         ///< Refuse the element (try_push_* returns false)
+    OverwriteOldest ///< Overwrite the element at the other end and count it in dropped_count()
+};
+
 /**
  * @brief A thread-safe circular container using Boost's circular_buffer.
  *
@@ -17,61 +29,76 @@ namespace cxx_lab {
  * with options for non-blocking, blocking with timeout, and indefinite blocking.
  * It also provides access to elements, capacity management, and utility functions.
  *
+ * The blocking pushes never wait for space: like circular_buffer they overwrite the element at
+ * the other end. With OverflowPolicy::OverwriteOldest the non-blocking pushes do the same, which
+ * suits live telemetry, where the newest data matters more than backpressure. Every overwritten
+ * element is counted in dropped_count(); with several subscribers use BroadcastRing instead.
+ *
  * @tparam T The type of elements stored in the container.
+ * @tparam Stats The stats policy: NullContainerStats (no instrumentation) or ContainerStats.
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
  */
-template <typename T>
+template <typename T, typename Stats = NullContainerStats, typename Wait = ConditionVariableWait>
 class SafeCircularQueue {
 public:
     using container = boost::circular_buffer<T>;
     using value_type = typename container::value_type;
     using size_type = typename container::size_type;
+    using condition_type = typename Wait::template condition_type<std::timed_mutex>;
     using iterator = typename container::iterator;
 
     /**
      * @brief Constructs a SafeCircularContainer with a specified capacity.
      *
      * @param capacity The maximum number of elements the container can hold.
+     * @param overflow What try_push_back / try_push_front do when the buffer is full.
      */
-    explicit SafeCircularQueue(size_t capacity)
-        : mutex_(), not_empty_(), buffer_(capacity) 
+    explicit SafeCircularQueue(size_t capacity, OverflowPolicy overflow = OverflowPolicy::Reject)
+        : mutex_(), not_empty_(), buffer_(capacity), overflow_(overflow), stats_()
     {}
 
     /**
      * @brief Attempts to push an element to the back without blocking.
      *
      * @param item The element to push.
-     * @return true if the push was successful, false if the buffer is full.
+     * @return true if the push was successful, false if the buffer is full (under
+     *         OverflowPolicy::Reject) or the lock is not free.
      */
     bool try_push_back(const T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
-            return false;
-        }
-        if (buffer_.full()) {
-            return false;
-        }
-        buffer_.push_back(item);
-        not_empty_.notify_one();
-        return true;
+        return try_insert([&]() { buffer_.push_back(item); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the back without blocking.
+     *
+     * @param item The element to push. It is left untouched if the push fails.
+     * @return true if the push was successful, false if the buffer is full (under
+     *         OverflowPolicy::Reject) or the lock is not free.
+     */
+    bool try_push_back(T&& item) {
+        return try_insert([&]() { buffer_.push_back(std::move(item)); });
     }
 
     /**
      * @brief Attempts to push an element to the front without blocking.
      *
      * @param item The element to push.
-     * @return true if the push was successful, false if the buffer is full.
+     * @return true if the push was successful, false if the buffer is full (under
+     *         OverflowPolicy::Reject) or the lock is not free.
      */
     bool try_push_front(const T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
-            return false;
-        }
-        if (buffer_.full()) {
-            return false;
-        }
-        buffer_.push_front(item);
-        not_empty_.notify_one();
-        return true;
+        return try_insert([&]() { buffer_.push_front(item); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the front without blocking.
+     *
+     * @param item The element to push. It is left untouched if the push fails.
+     * @return true if the push was successful, false if the buffer is full (under
+     *         OverflowPolicy::Reject) or the lock is not free.
+     */
+    bool try_push_front(T&& item) {
+        return try_insert([&]() { buffer_.push_front(std::move(item)); });
     }
 
     /**
@@ -82,13 +109,18 @@ public:
      * @return true if the push was successful within the timeout, false otherwise.
      */
     bool push_back(const T& item, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock_for(timeout)) {
-            return false;
-        }
-        buffer_.push_back(item);
-        not_empty_.notify_one();
-        return true;
+        return insert_for(timeout, [&]() { buffer_.push_back(item); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the back, blocking up to the specified timeout.
+     *
+     * @param item The element to push. It is left untouched if the timeout expires.
+     * @param timeout The maximum duration to wait for space to become available.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push_back(T&& item, const std::chrono::milliseconds& timeout) {
+        return insert_for(timeout, [&]() { buffer_.push_back(std::move(item)); });
     }
 
     /**
@@ -99,13 +131,18 @@ public:
      * @return true if the push was successful within the timeout, false otherwise.
      */
     bool push_front(const T& item, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock_for(timeout)) {
-            return false;
-        }
-        buffer_.push_front(item);
-        not_empty_.notify_one();
-        return true;
+        return insert_for(timeout, [&]() { buffer_.push_front(item); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the front, blocking up to the specified timeout.
+     *
+     * @param item The element to push. It is left untouched if the timeout expires.
+     * @param timeout The maximum duration to wait for space to become available.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push_front(T&& item, const std::chrono::milliseconds& timeout) {
+        return insert_for(timeout, [&]() { buffer_.push_front(std::move(item)); });
     }
 
     /**
@@ -114,9 +151,16 @@ public:
      * @param item The element to push.
      */
     void push_back(const T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
-        buffer_.push_back(item);
-        not_empty_.notify_one();
+        insert([&]() { buffer_.push_back(item); });
+    }
+
+    /**
+     * @brief Moves an element to the back, blocking until space is available.
+     *
+     * @param item The element to push.
+     */
+    void push_back(T&& item) {
+        insert([&]() { buffer_.push_back(std::move(item)); });
     }
 
     /**
@@ -125,9 +169,41 @@ public:
      * @param item The element to push.
      */
     void push_front(const T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
-        buffer_.push_front(item);
-        not_empty_.notify_one();
+        insert([&]() { buffer_.push_front(item); });
+    }
+
+    /**
+     * @brief Moves an element to the front, blocking until space is available.
+     *
+     * @param item The element to push.
+     */
+    void push_front(T&& item) {
+        insert([&]() { buffer_.push_front(std::move(item)); });
+    }
+
+    /**
+     * @brief Constructs an element and moves it to the back, blocking until space is available.
+     *
+     * boost::circular_buffer has no in-place construction, so the element is built
+     * before the lock is taken and then moved into the buffer.
+     *
+     * @tparam Args The types of the arguments to construct the element.
+     * @param args The arguments to pass to the element's constructor.
+     */
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        push_back(T(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Constructs an element and moves it to the front, blocking until space is available.
+     *
+     * @tparam Args The types of the arguments to construct the element.
+     * @param args The arguments to pass to the element's constructor.
+     */
+    template <typename... Args>
+    void emplace_front(Args&&... args) {
+        push_front(T(std::forward<Args>(args)...));
     }
 
     /**
@@ -138,13 +214,14 @@ public:
      */
     bool try_pop_back(T& item) {
         std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         if (buffer_.empty()) {
+            stats_.record_try_empty();
             return false;
         }
-        item = buffer_.back();
+        item = std::move(buffer_.back());
         buffer_.pop_back();
         return true;
     }
@@ -157,13 +234,14 @@ public:
      */
     bool try_pop_front(T& item) {
         std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         if (buffer_.empty()) {
+            stats_.record_try_empty();
             return false;
         }
-        item = buffer_.front();
+        item = std::move(buffer_.front());
         buffer_.pop_front();
         return true;
     }
@@ -176,11 +254,11 @@ public:
      * @return true if the pop was successful within the timeout, false otherwise.
      */
     bool pop_back(T& item, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         if (!not_empty_.wait_for(lock, timeout, [this](){ return !buffer_.empty(); })) {
             return false;
         }
-        item = buffer_.back();
+        item = std::move(buffer_.back());
         buffer_.pop_back();
         return true;
     }
@@ -193,11 +271,11 @@ public:
      * @return true if the pop was successful within the timeout, false otherwise.
      */
     bool pop_front(T& item, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         if (!not_empty_.wait_for(lock, timeout, [this](){ return !buffer_.empty(); })) {
             return false;
         }
-        item = buffer_.front();
+        item = std::move(buffer_.front());
         buffer_.pop_front();
         return true;
     }
@@ -208,9 +286,9 @@ public:
      * @param item Reference to store the popped element.
      */
     void pop_back(T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         not_empty_.wait(lock, [this](){ return !buffer_.empty(); });
-        item = buffer_.back();
+        item = std::move(buffer_.back());
         buffer_.pop_back();
     }
 
@@ -220,9 +298,9 @@ public:
      * @param item Reference to store the popped element.
      */
     void pop_front(T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         not_empty_.wait(lock, [this](){ return !buffer_.empty(); });
-        item = buffer_.front();
+        item = std::move(buffer_.front());
         buffer_.pop_front();
     }
 
@@ -235,10 +313,11 @@ public:
      */
     bool try_at(size_t index, T& item) const {
         std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         if (index >= buffer_.size()) {
+            stats_.record_try_empty();
             return false;
         }
         item = buffer_[index];
@@ -254,7 +333,7 @@ public:
      * @return true if the access was successful within the timeout, false otherwise.
      */
     bool at(size_t index, T& item, const std::chrono::milliseconds& timeout) const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         if (!not_empty_.wait_for(lock, timeout, [this, index](){ return index < buffer_.size(); })) {
             return false;
         }
@@ -272,11 +351,43 @@ public:
      * @return The accessed element.
      */
     const T& at(size_t index) const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         not_empty_.wait(lock, [this, index](){ return index < buffer_.size(); });
         return buffer_[index];
     }
 
+    /**
+     * @brief Runs func on the element at the specified index in place, while holding the lock.
+     *
+     * Index 0 is the oldest element in the buffer. func must not call back into this queue.
+     *
+     * @param index The index of the element to visit.
+     * @param func A callable taking a const T&.
+     * @return true if the element was visited, false if the index is out of bounds.
+     */
+    template <typename F>
+    bool visit_at(size_t index, F&& func) const {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        if (index >= buffer_.size()) {
+            return false;
+        }
+        func(std::as_const(buffer_)[index]);
+        return true;
+    }
+
+    /**
+     * @brief Runs func on every element in place, front to back, while holding the lock.
+     *
+     * @param func A callable taking a const T&; it must not call back into this queue.
+     */
+    template <typename F>
+    void for_each_locked(F&& func) const {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        for (const auto& item : buffer_) {
+            func(item);
+        }
+    }
+
     /**
      * @brief Provides safe access to the underlying circular buffer.
      *
@@ -286,15 +397,33 @@ public:
      * @param func A function that takes a reference to the circular buffer.
      */
     void access(const std::function<void(boost::circular_buffer<T>&)>& func) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         func(buffer_);
     }
 
+    /**
+     * @brief Runs func on the underlying circular buffer under the lock and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access(Func&& func) {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        return std::forward<Func>(func)(buffer_);
+    }
+
+    /**
+     * @brief Runs func on the underlying circular buffer, read-only, and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access_shared(Func&& func) const {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        return std::forward<Func>(func)(std::as_const(buffer_));
+    }
+
     /**
      * @brief Clears all elements from the container.
      */
     void clear() {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         buffer_.clear();
     }
 
@@ -304,7 +433,7 @@ public:
      * @return true if empty, false otherwise.
      */
     bool empty() const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         return buffer_.empty();
     }
 
@@ -314,7 +443,7 @@ public:
      * @return true if full, false otherwise.
      */
     bool full() const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         return buffer_.full();
     }
 
@@ -324,7 +453,7 @@ public:
      * @return The number of elements.
      */
     size_t size() const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         return buffer_.size();
     }
 
@@ -334,7 +463,7 @@ public:
      * @return The reserved capacity.
      */
     size_t reserve() const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         return buffer_.reserve();
     }
 
@@ -344,7 +473,7 @@ public:
      * @return The capacity.
      */
     size_t capacity() const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         return buffer_.capacity();
     }
 
@@ -354,14 +483,110 @@ public:
      * @param capacity The new capacity.
      */
     void set_capacity(size_t capacity) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         buffer_.set_capacity(capacity);
     }
 
+    /**
+     * @brief Retrieves the number of elements overwritten by pushes into the full buffer.
+     */
+    size_t dropped_count() const {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        return dropped_;
+    }
+
+    /**
+     * @brief Retrieves what the non-blocking pushes do when the buffer is full.
+     */
+    OverflowPolicy overflow_policy() const {
+        return overflow_;
+    }
+
+    /**
+     * @brief Provides the stats policy, e.g. to take a periodic snapshot or reset it.
+     *
+     * @return The stats policy of this container.
+     */
+    Stats& stats() const {
+        return stats_;
+    }
+
 private:
+    /**
+     * @brief Locks mutex_, recording the time spent waiting in stats_.
+     */
+    std::unique_lock<std::timed_mutex> acquire() const {
+        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
+    /**
+     * @brief Runs insert_op if the lock is free and the buffer is not full, without blocking.
+     */
+    template <typename InsertOp>
+    bool try_insert(InsertOp&& insert_op) {
+        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
+        if (!detail::try_lock_with_stats(stats_, lock)) {
+            return false;
+        }
+        if (buffer_.full() && overflow_ == OverflowPolicy::Reject) {
+            stats_.record_try_full();
+            return false;
+        }
+        count_overwrite();
+        insert_op();
+        stats_.record_size(buffer_.size());
+        stats_.record_notify_one();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Runs insert_op once the lock is acquired, waiting for it up to timeout.
+     */
+    template <typename InsertOp>
+    bool insert_for(const std::chrono::milliseconds& timeout, InsertOp&& insert_op) {
+        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
+        if (!detail::try_lock_for_with_stats(stats_, lock, timeout)) {
+            return false;
+        }
+        count_overwrite();
+        insert_op();
+        stats_.record_size(buffer_.size());
+        stats_.record_notify_one();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Runs insert_op once the lock is acquired.
+     */
+    template <typename InsertOp>
+    void insert(InsertOp&& insert_op) {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        count_overwrite();
+        insert_op();
+        stats_.record_size(buffer_.size());
+        stats_.record_notify_one();
+        not_empty_.notify_one();
+    }
+
+    /**
+     * @brief Counts the element the next push will overwrite, if the buffer is full. Caller holds the lock.
+     */
+    void count_overwrite() {
+        if (buffer_.full() && buffer_.capacity() > 0) {
+            ++dropped_;
+        }
+    }
+
     mutable std::timed_mutex mutex_;                    ///< Mutex to protect buffer access
-    mutable std::condition_variable_any not_empty_;     ///< Condition variable for consumers
+    mutable condition_type not_empty_;                  ///< Condition variable for consumers
     container buffer_;                                  ///< Underlying circular buffer
+    OverflowPolicy overflow_;                           ///< What non-blocking pushes do when full
+    size_t dropped_ = 0;                                ///< Elements overwritten so far
+    [[no_unique_address]] mutable Stats stats_;         ///< Contention counters (empty for NullContainerStats)
 };
 
 } // namespace cxx_lab
@@ -1,15 +1,26 @@
 #ifndef SAFE_SEQUENCE_CONTAINER_HPP
 #define SAFE_SEQUENCE_CONTAINER_HPP
 
+#include <algorithm>
 #include <mutex>
 #include <condition_variable>
 #include <deque>
+#include <iterator>
 #include <chrono>
 #include <functional>
+#include <optional>
 #include <stdexcept>
+#include <vector>
 #include <utility> // for std::pair
 #include <cstddef> // for size_t
 
+#include <boost/asio/compose.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <container/async_wait_list.hpp>
+#include <container/container_stats.hpp>
+#include <container/wait_policy.hpp>
+
 namespace cxx_lab {
 
 /**
@@ -22,12 +33,23 @@ namespace cxx_lab {
  * - `try_push_back()`, `try_push_front()`: Non-blocking push attempts.
  * - `push_back(timeout)`, `push_front(timeout)`: Blocking push with timeout.
  * - `push_back()`, `push_front()`: Blocking push until done.
+ * - `emplace_back()`, `emplace_front()`: Blocking in-place construction until done.
+ * - Every push method has a `T&&` overload that moves the item in.
  * 
  * **Pop Methods:**
  * - `try_pop_back()`, `try_pop_front()`: Non-blocking pop attempts.
  * - `pop_back(timeout)`, `pop_front(timeout)`: Blocking pop with timeout.
  * - `pop_back()`, `pop_front()`: Blocking pop until done.
  * 
+ * **Bulk Methods:**
+ * - `push_back_bulk()`: Push a range under one lock and one notification.
+ * - `pop_front_bulk(timeout)`: Pop up to N items under one lock, waiting for the first.
+ * - `drain_into()`: Move every item into a vector.
+ * 
+ * **Asynchronous Methods:**
+ * - `async_pop_front()`: Suspends the calling coroutine (not its thread) until an item is available.
+ * - `async_push_back()`: Pushes and completes through the handler's executor.
+ * 
  * **Access Methods:**
  * - `try_at()`: Non-blocking access.
  * - `at(timeout)`: Blocking access with timeout.
@@ -37,23 +59,28 @@ namespace cxx_lab {
  * **Utility Methods:**
  * - `clear()`, `resize()`: Modify the container.
  * - `empty()`, `size()`, `max_size()`: Query the container state.
+ * - `stats()`: Lock-wait and failure counters of the selected stats policy.
  * 
  * @tparam T The type of elements stored in the container.
  * @tparam Container The underlying sequence container type. Defaults to std::deque<T>.
+ * @tparam Stats The stats policy. Defaults to NullContainerStats, which records nothing.
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
  */
-template <typename T, typename Container = std::deque<T>>
+template <typename T, typename Container = std::deque<T>, typename Stats = NullContainerStats,
+          typename Wait = ConditionVariableWait>
 class SafeDeque {
 public:
     using value_type = typename Container::value_type;
     using size_type = typename Container::size_type;
     using iterator = typename Container::iterator;
+    using condition_type = typename Wait::template condition_type<std::timed_mutex>;
     using container = Container;
 
     /**
      * @brief Constructs a thread-safe container.
      */
     SafeDeque()
-        : mutex_(), cond_var_(), container_()
+        : mutex_(), cond_var_(), async_not_empty_(), container_(), stats_()
     {
         // No additional initialization required
     }
@@ -65,13 +92,17 @@ public:
      * @return true If the item was successfully pushed.
      */
     bool try_push_back(const T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
-            return false;
-        }
-        container_.push_back(item);
-        cond_var_.notify_one(); // Notify one waiting thread, if any
-        return true;
+        return try_insert([&]() { container_.push_back(item); });
+    }
+
+    /**
+     * @brief Attempts to move an item to the back of the container without blocking.
+     * 
+     * @param item The item to be pushed. It is left untouched if the lock is busy.
+     * @return true If the item was successfully pushed.
+     */
+    bool try_push_back(T&& item) {
+        return try_insert([&]() { container_.push_back(std::move(item)); });
     }
 
     /**
@@ -81,13 +112,17 @@ public:
      * @return true If the item was successfully pushed.
      */
     bool try_push_front(const T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
-            return false;
-        }
-        container_.push_front(item);
-        cond_var_.notify_one(); // Notify one waiting thread, if any
-        return true;
+        return try_insert([&]() { container_.push_front(item); });
+    }
+
+    /**
+     * @brief Attempts to move an item to the front of the container without blocking.
+     * 
+     * @param item The item to be pushed. It is left untouched if the lock is busy.
+     * @return true If the item was successfully pushed.
+     */
+    bool try_push_front(T&& item) {
+        return try_insert([&]() { container_.push_front(std::move(item)); });
     }
 
     /**
@@ -99,14 +134,19 @@ public:
      * @return false If the timeout expired before the push could be completed.
      */
     bool push_back(const T& item, std::chrono::milliseconds timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock_for(timeout)) {
-            return false; // Timeout occurred
-        }
-        // Since there's no capacity limit, we can push immediately
-        container_.push_back(item);
-        cond_var_.notify_one(); // Notify one waiting thread, if any
-        return true; // Always succeeds
+        return insert_for(timeout, [&]() { container_.push_back(item); });
+    }
+
+    /**
+     * @brief Attempts to move an item to the back of the container, blocking for up to the specified timeout.
+     * 
+     * @param item The item to be pushed. It is left untouched if the timeout expires.
+     * @param timeout The maximum duration to wait for the push to complete.
+     * @return true If the item was successfully pushed within the timeout period.
+     * @return false If the timeout expired before the push could be completed.
+     */
+    bool push_back(T&& item, std::chrono::milliseconds timeout) {
+        return insert_for(timeout, [&]() { container_.push_back(std::move(item)); });
     }
 
     /**
@@ -118,14 +158,19 @@ public:
      * @return false If the timeout expired before the push could be completed.
      */
     bool push_front(const T& item, std::chrono::milliseconds timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock_for(timeout)) {
-            return false; // Timeout occurred
-        }
-        // Since there's no capacity limit, we can push immediately
-        container_.push_front(item);
-        cond_var_.notify_one(); // Notify one waiting thread, if any
-        return true; // Always succeeds
+        return insert_for(timeout, [&]() { container_.push_front(item); });
+    }
+
+    /**
+     * @brief Attempts to move an item to the front of the container, blocking for up to the specified timeout.
+     * 
+     * @param item The item to be pushed. It is left untouched if the timeout expires.
+     * @param timeout The maximum duration to wait for the push to complete.
+     * @return true If the item was successfully pushed within the timeout period.
+     * @return false If the timeout expired before the push could be completed.
+     */
+    bool push_front(T&& item, std::chrono::milliseconds timeout) {
+        return insert_for(timeout, [&]() { container_.push_front(std::move(item)); });
     }
 
     /**
@@ -134,10 +179,16 @@ public:
      * @param item The item to be pushed.
      */
     void push_back(const T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
-        // Since there's no capacity limit, we can push immediately
-        container_.push_back(item);
-        cond_var_.notify_one(); // Notify one waiting thread, if any
+        insert([&]() { container_.push_back(item); });
+    }
+
+    /**
+     * @brief Moves an item to the back of the container, blocking indefinitely until the push is done.
+     * 
+     * @param item The item to be pushed.
+     */
+    void push_back(T&& item) {
+        insert([&]() { container_.push_back(std::move(item)); });
     }
 
     /**
@@ -146,10 +197,38 @@ public:
      * @param item The item to be pushed.
      */
     void push_front(const T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
-        // Since there's no capacity limit, we can push immediately
-        container_.push_front(item);
-        cond_var_.notify_one(); // Notify one waiting thread, if any
+        insert([&]() { container_.push_front(item); });
+    }
+
+    /**
+     * @brief Moves an item to the front of the container, blocking indefinitely until the push is done.
+     * 
+     * @param item The item to be pushed.
+     */
+    void push_front(T&& item) {
+        insert([&]() { container_.push_front(std::move(item)); });
+    }
+
+    /**
+     * @brief Constructs an item in place at the back of the container, blocking indefinitely until the push is done.
+     * 
+     * @tparam Args The types of the arguments to construct the item.
+     * @param args The arguments to pass to the item's constructor.
+     */
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        insert([&]() { container_.emplace_back(std::forward<Args>(args)...); });
+    }
+
+    /**
+     * @brief Constructs an item in place at the front of the container, blocking indefinitely until the push is done.
+     * 
+     * @tparam Args The types of the arguments to construct the item.
+     * @param args The arguments to pass to the item's constructor.
+     */
+    template <typename... Args>
+    void emplace_front(Args&&... args) {
+        insert([&]() { container_.emplace_front(std::forward<Args>(args)...); });
     }
 
     /**
@@ -161,14 +240,16 @@ public:
      */
     bool try_pop_back(T& item) {
         std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         if (container_.empty()) {
+            stats_.record_try_empty();
             return false; // Container is empty
         }
         item = std::move(container_.back());
         container_.pop_back();
+        stats_.record_notify_one();
         cond_var_.notify_one(); // Notify one waiting thread, if any
         return true;
     }
@@ -182,14 +263,16 @@ public:
      */
     bool try_pop_front(T& item) {
         std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         if (container_.empty()) {
+            stats_.record_try_empty();
             return false; // Container is empty
         }
         item = std::move(container_.front());
         container_.pop_front();
+        stats_.record_notify_one();
         cond_var_.notify_one(); // Notify one waiting thread, if any
         return true;
     }
@@ -203,13 +286,14 @@ public:
      * @return false If the timeout expired before an item could be popped.
      */
     bool pop_back(T& item, std::chrono::milliseconds timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         // Wait until there's an item or timeout
         if (!cond_var_.wait_for(lock, timeout, [this]() { return !container_.empty(); })) {
             return false; // Timeout expired
         }
         item = std::move(container_.back());
         container_.pop_back();
+        stats_.record_notify_one();
         cond_var_.notify_one(); // Notify one waiting thread, if any
         return true;
     }
@@ -223,13 +307,14 @@ public:
      * @return false If the timeout expired before an item could be popped.
      */
     bool pop_front(T& item, std::chrono::milliseconds timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         // Wait until there's an item or timeout
         if (!cond_var_.wait_for(lock, timeout, [this]() { return !container_.empty(); })) {
             return false; // Timeout expired
         }
         item = std::move(container_.front());
         container_.pop_front();
+        stats_.record_notify_one();
         cond_var_.notify_one(); // Notify one waiting thread, if any
         return true;
     }
@@ -240,11 +325,12 @@ public:
      * @param item Reference to store the popped item.
      */
     void pop_back(T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         // Wait indefinitely until there's an item
         cond_var_.wait(lock, [this]() { return !container_.empty(); });
         item = std::move(container_.back());
         container_.pop_back();
+        stats_.record_notify_one();
         cond_var_.notify_one(); // Notify one waiting thread, if any
     }
 
@@ -254,12 +340,109 @@ public:
      * @param item Reference to store the popped item.
      */
     void pop_front(T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         // Wait indefinitely until there's an item
         cond_var_.wait(lock, [this]() { return !container_.empty(); });
         item = std::move(container_.front());
         container_.pop_front();
+        stats_.record_notify_one();
+        cond_var_.notify_one(); // Notify one waiting thread, if any
+    }
+
+    /**
+     * @brief Pushes a range of items to the back of the container under a single lock and a single notification.
+     * 
+     * Pass std::make_move_iterator() iterators to move the items in.
+     * 
+     * @tparam InputIt An input iterator whose value is convertible to T.
+     * @param first The beginning of the range to push.
+     * @param last The end of the range to push.
+     * @return size_t The number of items pushed.
+     */
+    template <typename InputIt>
+    size_t push_back_bulk(InputIt first, InputIt last) {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        size_t pushed = 0;
+        for (; first != last; ++first, ++pushed) {
+            container_.push_back(*first);
+        }
+        stats_.record_size(container_.size());
+        notify_batch(pushed);
+        return pushed;
+    }
+
+    /**
+     * @brief Pops up to `max_n` items from the front, blocking until at least one is available or the timeout expires.
+     * 
+     * All available items (up to `max_n`) are moved out under a single lock acquisition.
+     * 
+     * @tparam OutputIt An output iterator accepting T.
+     * @param out The destination of the popped items.
+     * @param max_n The maximum number of items to pop.
+     * @param timeout The maximum duration to wait for the first item.
+     * @return size_t The number of items popped (0 if the timeout expired).
+     */
+    template <typename OutputIt>
+    size_t pop_front_bulk(OutputIt out, size_t max_n, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        if (max_n == 0 || !cond_var_.wait_for(lock, timeout, [this]() { return !container_.empty(); })) {
+            return 0; // Nothing requested or timeout expired
+        }
+        const size_t count = std::min(max_n, static_cast<size_t>(container_.size()));
+        auto last = std::next(container_.begin(), count);
+        std::move(container_.begin(), last, out);
+        container_.erase(container_.begin(), last);
+        stats_.record_notify_one();
         cond_var_.notify_one(); // Notify one waiting thread, if any
+        return count;
+    }
+
+    /**
+     * @brief Moves every item currently in the container to the back of a vector.
+     * 
+     * @param items The vector receiving the items; existing contents are kept.
+     * @return size_t The number of items moved.
+     */
+    size_t drain_into(std::vector<T>& items) {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        const size_t count = container_.size();
+        items.reserve(items.size() + count);
+        std::move(container_.begin(), container_.end(), std::back_inserter(items));
+        container_.clear();
+        return count;
+    }
+
+    /**
+     * @brief Asynchronously pops an item from the front, suspending until one is available.
+     * 
+     * The waiting operation occupies no thread: it is parked on the container and resumed on its
+     * handler's executor by the push that makes an item available. The container must outlive
+     * the operation.
+     * 
+     * @param token The completion token for `void(boost::system::error_code, T)`,
+     *              e.g. boost::asio::use_awaitable.
+     * @return Whatever the completion token produces.
+     */
+    template <typename CompletionToken>
+    auto async_pop_front(CompletionToken&& token) {
+        return boost::asio::async_compose<CompletionToken, void(boost::system::error_code, T)>(
+            detail::AsyncRetryOp<T, PopFrontAttempt>(PopFrontAttempt{this}), token);
+    }
+
+    /**
+     * @brief Asynchronously pushes an item to the back.
+     * 
+     * The container is unbounded, so the push itself never waits; the completion is posted to
+     * the handler's executor so that a coroutine can `co_await` it like any other operation.
+     * 
+     * @param item The item to push.
+     * @param token The completion token for `void(boost::system::error_code)`.
+     * @return Whatever the completion token produces.
+     */
+    template <typename CompletionToken>
+    auto async_push_back(T item, CompletionToken&& token) {
+        return boost::asio::async_compose<CompletionToken, void(boost::system::error_code)>(
+            detail::AsyncRetryOp<void, PushBackAttempt>(PushBackAttempt{this, std::move(item)}), token);
     }
 
     /**
@@ -272,10 +455,11 @@ public:
      */
     bool try_at(size_t index, T& item) {
         std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         if (index >= container_.size()) {
+            stats_.record_try_empty();
             return false; // Index out of bounds
         }
         auto it = container_.begin();
@@ -294,7 +478,7 @@ public:
      * @return false If the timeout expired before the index became valid.
      */
     bool at(size_t index, T& item, std::chrono::milliseconds timeout) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         // Wait until the container has enough elements or timeout
         if (!cond_var_.wait_for(lock, timeout, [this, index]() { return container_.size() > index; })) {
             return false; // Timeout expired
@@ -314,8 +498,9 @@ public:
      * @return false If the index is out of bounds.
      */
     bool at(size_t index, T& item) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         if (index >= container_.size()) {
+            stats_.record_try_empty();
             return false; // Index out of bounds
         }
         auto it = container_.begin();
@@ -324,6 +509,39 @@ public:
         return true;
     }
 
+    /**
+     * @brief Runs func on the item at the specified index in place, while holding the lock.
+     *
+     * Index 0 is the front; containers without random access are walked from there. func must
+     * not call back into this deque.
+     *
+     * @param index The index of the item to visit.
+     * @param func A callable taking a const T&.
+     * @return true if the item was visited, false if the index is out of bounds.
+     */
+    template <typename F>
+    bool visit_at(size_t index, F&& func) const {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        if (index >= container_.size()) {
+            return false;
+        }
+        func(*std::next(container_.cbegin(), static_cast<std::ptrdiff_t>(index)));
+        return true;
+    }
+
+    /**
+     * @brief Runs func on every item in place, front to back, while holding the lock.
+     *
+     * @param func A callable taking a const T&; it must not call back into this deque.
+     */
+    template <typename F>
+    void for_each_locked(F&& func) const {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        for (const auto& item : container_) {
+            func(item);
+        }
+    }
+
     /**
      * @brief Accesses the container in a thread-safe manner using a callable.
      * 
@@ -333,7 +551,7 @@ public:
      * @param func The callable that takes a reference to the underlying container.
      */
     void access(const std::function<void(Container&)>& func) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         func(container_);
     }
 
@@ -345,16 +563,35 @@ public:
      * @param func The callable that takes a const reference to the underlying container.
      */
     void access(const std::function<void(const Container&)>& func) const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         func(container_);
     }
 
+    /**
+     * @brief Runs func on the underlying container under the lock and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access(Func&& func) {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        return std::forward<Func>(func)(container_);
+    }
+
+    /**
+     * @brief Runs func on the underlying container, read-only, and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access_shared(Func&& func) const {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        return std::forward<Func>(func)(std::as_const(container_));
+    }
+
     /**
      * @brief Clears all elements from the container.
      */
     void clear() {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         container_.clear();
+        stats_.record_notify_all();
         cond_var_.notify_all(); // Notify all waiting threads
     }
 
@@ -367,9 +604,12 @@ public:
      * @param count The new size of the container.
      */
     void resize(size_t count) {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         container_.resize(count);
+        stats_.record_size(container_.size());
+        stats_.record_notify_all();
         cond_var_.notify_all(); // Notify all waiting threads
+        async_not_empty_.wake(count); // New default-inserted items may be available
     }
 
     /**
@@ -378,7 +618,7 @@ public:
      * @return size_t The number of elements.
      */
     size_t size() const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         return container_.size();
     }
 
@@ -389,7 +629,7 @@ public:
      * @return false If the container has one or more elements.
      */
     bool empty() const {
-        std::unique_lock<std::timed_mutex> lock(mutex_);
+        std::unique_lock<std::timed_mutex> lock = acquire();
         return container_.empty();
     }
 
@@ -404,10 +644,124 @@ public:
         return 0; // Indicates unlimited capacity
     }
 
+    /**
+     * @brief Returns the stats policy, e.g. to take a periodic snapshot or reset it.
+     * 
+     * @return Stats& The counters of this container (always empty for NullContainerStats).
+     */
+    Stats& stats() const {
+        return stats_;
+    }
+
 private:
+    /**
+     * @brief Locks the mutex, recording the time spent waiting in `stats_`.
+     */
+    std::unique_lock<std::timed_mutex> acquire() const {
+        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
+    /**
+     * @brief Runs `insert_op` if the lock is free, without blocking.
+     */
+    template <typename InsertOp>
+    bool try_insert(InsertOp&& insert_op) {
+        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
+        if (!detail::try_lock_with_stats(stats_, lock)) {
+            return false;
+        }
+        insert_op();
+        stats_.record_size(container_.size());
+        notify_batch(1);
+        return true;
+    }
+
+    /**
+     * @brief Runs `insert_op` once the lock is acquired, waiting for it up to `timeout`.
+     */
+    template <typename InsertOp>
+    bool insert_for(std::chrono::milliseconds timeout, InsertOp&& insert_op) {
+        std::unique_lock<std::timed_mutex> lock(mutex_, std::defer_lock);
+        if (!detail::try_lock_for_with_stats(stats_, lock, timeout)) {
+            return false; // Timeout occurred
+        }
+        // Since there's no capacity limit, we can push immediately
+        insert_op();
+        stats_.record_size(container_.size());
+        notify_batch(1);
+        return true;
+    }
+
+    /**
+     * @brief Runs `insert_op` once the lock is acquired.
+     */
+    template <typename InsertOp>
+    void insert(InsertOp&& insert_op) {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        // Since there's no capacity limit, we can push immediately
+        insert_op();
+        stats_.record_size(container_.size());
+        notify_batch(1);
+    }
+
+    /**
+     * @brief Pops into `result`, or parks `self` until the next push. Used by async_pop_front().
+     */
+    template <typename Self>
+    bool pop_front_or_park(std::optional<T>& result, Self& self) {
+        std::unique_lock<std::timed_mutex> lock = acquire();
+        if (container_.empty()) {
+            async_not_empty_.park(std::move(self));
+            return false;
+        }
+        result.emplace(std::move(container_.front()));
+        container_.pop_front();
+        return true;
+    }
+
+    struct PopFrontAttempt {
+        SafeDeque* deque;
+
+        template <typename Self>
+        bool operator()(std::optional<T>& result, Self& self) const {
+            return deque->pop_front_or_park(result, self);
+        }
+    };
+
+    struct PushBackAttempt {
+        SafeDeque* deque;
+        T item;
+
+        template <typename Self>
+        bool operator()(Self&) {
+            deque->push_back(std::move(item));
+            return true;
+        }
+    };
+
+    /**
+     * @brief Wakes as many waiting threads and asynchronous pops as there are new items in one call.
+     * 
+     * @param count The number of items just added.
+     */
+    void notify_batch(size_t count) {
+        if (count == 1) {
+            stats_.record_notify_one();
+            cond_var_.notify_one();
+        } else if (count > 1) {
+            stats_.record_notify_all();
+            cond_var_.notify_all();
+        }
+        async_not_empty_.wake(count);
+    }
+
     mutable std::timed_mutex mutex_;                    ///< Mutex to protect access to the container
-    mutable std::condition_variable_any cond_var_;      ///< Condition variable for synchronization
+    mutable condition_type cond_var_;                   ///< Condition variable for synchronization
+    detail::AsyncWaitList async_not_empty_;             ///< Asynchronous pops waiting for items
     Container container_;                               ///< Underlying sequence container (e.g., std::deque)
+    [[no_unique_address]] mutable Stats stats_;         ///< Contention counters (empty for NullContainerStats)
 };
 
 } // namespace cxx_lab
@@ -2,16 +2,59 @@
 #define CXX_LAB_SAFE_MAP_CONTAINER_HPP
 
 #include <map>
+#include <unordered_map>
 #include <shared_mutex>
+#include <mutex>
 #include <condition_variable>
 #include <chrono>
 #include <functional>
+#include <optional>
 #include <vector>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include <boost/asio/compose.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <container/async_wait_list.hpp>
+#include <container/container_stats.hpp>
+#include <container/wait_policy.hpp>
+
 namespace cxx_lab {
 
+namespace detail {
+
+/**
+ * @brief Selects a map from keys of Container to T that looks keys up the same way Container does.
+ *
+ * Ordered containers yield a std::map with the same comparator, hashed containers a
+ * std::unordered_map with the same hash and equality.
+ */
+template <typename Container, typename T, typename = void>
+struct KeyedBy {
+    using type = std::unordered_map<typename Container::key_type, T,
+                                    typename Container::hasher, typename Container::key_equal>;
+};
+
+template <typename Container, typename T>
+struct KeyedBy<Container, T, std::void_t<typename Container::key_compare>> {
+    using type = std::map<typename Container::key_type, T, typename Container::key_compare>;
+};
+
+/**
+ * @brief Whether references to mapped values survive insertion and erasure of other elements.
+ *
+ * False for flat maps (FlatMap, std::flat_map), which keep the mapped values in one vector.
+ */
+template <typename Container, typename = void>
+struct StableMappedReferences : std::true_type {};
+
+template <typename Container>
+struct StableMappedReferences<Container, std::void_t<typename Container::mapped_container_type>> : std::false_type {};
+
+} // namespace detail
+
 /**
  * @brief A thread-safe associative container supporting std::map.
  *
@@ -19,11 +62,18 @@ namespace cxx_lab {
  * providing synchronized access and modification methods. It supports both non-blocking
  * and blocking operations, with options for timeouts, ensuring safe concurrent usage.
  *
+ * Threads blocked in `at()` register under the key they wait for, so an insertion wakes only
+ * the threads waiting for the inserted key. `access()` may change any key and wakes every
+ * registered waiter. `async_at()` waits the same way without blocking a thread.
+ *
  * @tparam Key The type of keys in the associative container.
  * @tparam Mapped The type of mapped values in the associative container.
  * @tparam Container The type of the underlying associative container (e.g., std::map<Key, Mapped>).
+ * @tparam Stats The stats policy: NullContainerStats (no instrumentation) or ContainerStats.
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
  */
-template <typename Key, typename Mapped, typename Container = std::map<Key, Mapped>>
+template <typename Key, typename Mapped, typename Container = std::map<Key, Mapped>, typename Stats = NullContainerStats,
+          typename Wait = ConditionVariableWait>
 class SafeMap {
 public:
     using container = Container;
@@ -32,11 +82,12 @@ public:
     using value_type = typename Container::value_type;
     using size_type = typename Container::size_type;
     using iterator = typename Container::iterator;
+    using condition_type = typename Wait::template condition_type<std::shared_timed_mutex>;
 
     /**
      * @brief Constructs a SafeMap.
      */
-    SafeMap() : mutex_(), not_empty_(), container_() {}
+    SafeMap() : mutex_(), waiters_mutex_(), waiters_(), container_(), stats_() {}
 
     /**
      * @brief Attempts to insert an element without blocking.
@@ -46,12 +97,13 @@ public:
      */
     bool try_insert(const value_type& value) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         auto result = container_.insert(value);
+        stats_.record_size(container_.size());
         if (result.second) {
-            not_empty_.notify_one();
+            notify_key(result.first->first);
             return true;
         }
         return false; // Insertion failed (key exists)
@@ -67,12 +119,13 @@ public:
     template <typename... Args>
     bool try_emplace(Args&&... args) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         auto result = container_.emplace(std::forward<Args>(args)...);
+        stats_.record_size(container_.size());
         if (result.second) {
-            not_empty_.notify_one();
+            notify_key(result.first->first);
             return true;
         }
         return false; // Emplace failed (key exists)
@@ -87,12 +140,13 @@ public:
      */
     bool insert(const value_type& value, const std::chrono::milliseconds& timeout) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock_for(timeout)) {
+        if (!detail::try_lock_for_with_stats(stats_, lock, timeout)) {
             return false; // Timeout occurred
         }
         auto result = container_.insert(value);
+        stats_.record_size(container_.size());
         if (result.second) {
-            not_empty_.notify_one();
+            notify_key(result.first->first);
             return true;
         }
         return false; // Insertion failed (key exists)
@@ -105,10 +159,11 @@ public:
      * @return true if the insertion was successful, false otherwise.
      */
     bool insert(const value_type& value) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         auto result = container_.insert(value);
+        stats_.record_size(container_.size());
         if (result.second) {
-            not_empty_.notify_one();
+            notify_key(result.first->first);
             return true;
         }
         return false; // Insertion failed (key exists)
@@ -123,10 +178,11 @@ public:
      */
     template <typename... Args>
     bool emplace(Args&&... args) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         auto result = container_.emplace(std::forward<Args>(args)...);
+        stats_.record_size(container_.size());
         if (result.second) {
-            not_empty_.notify_one();
+            notify_key(result.first->first);
             return true;
         }
         return false; // Emplace failed (key exists)
@@ -141,7 +197,7 @@ public:
      */
     bool try_at(const key_type& key, mapped_type& value) const {
         std::shared_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         auto it = container_.find(key);
@@ -149,6 +205,7 @@ public:
             value = it->second;
             return true;
         }
+        stats_.record_try_empty();
         return false;
     }
 
@@ -161,14 +218,18 @@ public:
      * @return true if the element was found within the timeout, false otherwise.
      */
     bool at(const key_type& key, mapped_type& value, const std::chrono::milliseconds& timeout) const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-        auto deadline = std::chrono::steady_clock::now() + timeout;
-        while (container_.find(key) == container_.end()) {
-            if (not_empty_.wait_until(lock, deadline) == std::cv_status::timeout) {
-                return false; // Timeout expired
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
+        auto it = container_.find(key);
+        if (it == container_.end()) {
+            auto deadline = std::chrono::steady_clock::now() + timeout;
+            KeyWaitRegistration registration(*this, key);
+            while ((it = container_.find(key)) == container_.end()) {
+                if (registration.ready().wait_until(lock, deadline) == std::cv_status::timeout) {
+                    it = container_.find(key); // Timeout expired, one last look
+                    break;
+                }
             }
         }
-        auto it = container_.find(key);
         if (it != container_.end()) {
             value = it->second;
             return true;
@@ -179,20 +240,82 @@ public:
     /**
      * @brief Accesses an element by key, blocking until the element is available.
      *
+     * The reference outlives the lock, so this overload is not available for flat backends
+     * (FlatMap), where any concurrent insertion or erasure moves the values. Use the copying
+     * at() or visit() with those.
+     *
      * @param key The key of the element to access.
      * @return const mapped_type& Reference to the accessed value.
      * @throws std::out_of_range if the key is not found.
      */
     const mapped_type& at(const key_type& key) const {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-        not_empty_.wait(lock, [this, &key]() { return container_.find(key) != container_.end(); });
+        static_assert(detail::StableMappedReferences<Container>::value,
+                      "at(key) would return a reference that concurrent writes to a flat backend invalidate");
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         auto it = container_.find(key);
+        if (it == container_.end()) {
+            KeyWaitRegistration registration(*this, key);
+            while ((it = container_.find(key)) == container_.end()) {
+                registration.ready().wait(lock);
+            }
+        }
         if (it != container_.end()) {
             return it->second;
         }
         throw std::out_of_range("Key not found in SafeMap");
     }
 
+    /**
+     * @brief Runs func on the value of key in place, under a shared lock.
+     *
+     * Concurrent visits do not exclude each other. func must not call back into this map.
+     *
+     * @param key The key of the element to visit.
+     * @param func A callable taking a const mapped_type&.
+     * @return true if the key was found and its value visited, false otherwise.
+     */
+    template <typename F>
+    bool visit(const key_type& key, F&& func) const {
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
+        auto it = container_.find(key);
+        if (it == container_.end()) {
+            return false;
+        }
+        func(std::as_const(it->second));
+        return true;
+    }
+
+    /**
+     * @brief Runs func on every key-value pair in place, in the container's order, under a shared lock.
+     *
+     * @param func A callable taking a const value_type& (or, for FlatMap, its const pair proxy);
+     *             it must not call back into this map.
+     */
+    template <typename F>
+    void for_each_locked(F&& func) const {
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
+        for (auto&& entry : container_) {
+            func(entry);
+        }
+    }
+
+    /**
+     * @brief Asynchronously accesses an element by key, suspending until the key is inserted.
+     *
+     * The waiting operation occupies no thread: it is registered under the key and resumed on
+     * its handler's executor by the insertion of that key. The map must outlive the operation.
+     *
+     * @param key The key of the element to access.
+     * @param token The completion token for `void(boost::system::error_code, mapped_type)`,
+     *              e.g. boost::asio::use_awaitable.
+     * @return Whatever the completion token produces.
+     */
+    template <typename CompletionToken>
+    auto async_at(const key_type& key, CompletionToken&& token) const {
+        return boost::asio::async_compose<CompletionToken, void(boost::system::error_code, mapped_type)>(
+            detail::AsyncRetryOp<mapped_type, AtAttempt>(AtAttempt{this, key}), token);
+    }
+
     /**
      * @brief Provides thread-safe read or write access to the underlying associative container.
      *
@@ -204,18 +327,42 @@ public:
      *             For write operations, use a lambda that modifies data.
      */
     void access(const std::function<void(Container&)>& func) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         func(container_);
-        not_empty_.notify_all(); // Notify all waiting threads, if necessary
+        notify_all_keys(); // Any key may have been added
+    }
+
+    /**
+     * @brief Runs func on the underlying container under an exclusive lock, wakes the key waiters, and returns func's result.
+     */
+    template <typename Func>
+    decltype(auto) access(Func&& func) {
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
+        if constexpr (std::is_void_v<std::invoke_result_t<Func, Container&>>) {
+            std::forward<Func>(func)(container_);
+            notify_all_keys();
+        } else {
+            auto result = std::forward<Func>(func)(container_);
+            notify_all_keys();
+            return result;
+        }
+    }
+
+    /**
+     * @brief Runs func on the underlying container under a shared lock and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access_shared(Func&& func) const {
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
+        return std::forward<Func>(func)(std::as_const(container_));
     }
 
     /**
      * @brief Clears all elements from the container.
      */
     void clear() {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-        container_.clear();
-        not_empty_.notify_all(); // Notify all waiting threads
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
+        container_.clear(); // Nothing became available, so no waiter is woken
     }
 
     /**
@@ -225,7 +372,7 @@ public:
      * @return The number of elements erased.
      */
     size_type erase(const key_type& key) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         size_type erased = container_.erase(key);
         return erased;
     }
@@ -237,7 +384,7 @@ public:
      * @return The number of elements with the specified key.
      */
     size_type count(const key_type& key) const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.count(key);
     }
 
@@ -248,7 +395,7 @@ public:
      * @return true if the container contains the key, false otherwise.
      */
     bool contains(const key_type& key) const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.find(key) != container_.end();
     }
 
@@ -258,7 +405,7 @@ public:
      * @return true if empty, false otherwise.
      */
     bool empty() const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.empty();
     }
 
@@ -268,14 +415,154 @@ public:
      * @return The number of elements.
      */
     size_type size() const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.size();
     }
 
+    /**
+     * @brief Provides the stats policy, e.g. to take a periodic snapshot or reset it.
+     *
+     * @return The stats policy of this container.
+     */
+    Stats& stats() const {
+        return stats_;
+    }
+
 private:
+    /**
+     * @brief Locks mutex_ exclusively, recording the time spent waiting in stats_.
+     */
+    std::unique_lock<std::shared_timed_mutex> acquire() const {
+        std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
+    /**
+     * @brief Locks mutex_ shared, recording the time spent waiting in stats_.
+     */
+    std::shared_lock<std::shared_timed_mutex> acquire_shared() const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
+    /**
+     * @brief Threads blocked in at() for one key.
+     */
+    struct KeyWaiters {
+        condition_type ready;              ///< Signaled when the key is inserted
+        detail::AsyncWaitList async_ready; ///< async_at() operations waiting for the key
+        std::size_t count = 0;             ///< Number of registered threads
+
+        bool unused() const {
+            return count == 0 && async_ready.empty();
+        }
+    };
+
+    /**
+     * @brief Registers the calling thread as a waiter for a key for the registration's lifetime.
+     *
+     * Must be created and destroyed while holding mutex_ (shared or exclusive). Inserters hold
+     * mutex_ exclusively, so they can read waiters_ without waiters_mutex_.
+     *
+     * Holds a pointer to the entry rather than an iterator: registering another key may rehash an
+     * unordered waiters_, which invalidates iterators but not references to the elements.
+     */
+    class KeyWaitRegistration {
+    public:
+        KeyWaitRegistration(const SafeMap& map, const key_type& key) : map_(map), key_(key) {
+            std::lock_guard<std::mutex> guard(map_.waiters_mutex_);
+            waiters_ = &map_.waiters_.try_emplace(key).first->second;
+            ++waiters_->count;
+        }
+
+        ~KeyWaitRegistration() {
+            std::lock_guard<std::mutex> guard(map_.waiters_mutex_);
+            --waiters_->count;
+            if (waiters_->unused()) {
+                map_.waiters_.erase(key_);
+            }
+        }
+
+        KeyWaitRegistration(const KeyWaitRegistration&) = delete;
+        KeyWaitRegistration& operator=(const KeyWaitRegistration&) = delete;
+
+        condition_type& ready() {
+            return waiters_->ready;
+        }
+
+    private:
+        const SafeMap& map_;
+        const key_type& key_;      ///< The key waited for; outlives the registration
+        KeyWaiters* waiters_;      ///< The key's entry in waiters_, kept alive by count
+    };
+
+    /**
+     * @brief Copies the mapped value of key into result, or registers self under key. Used by async_at().
+     */
+    template <typename Self>
+    bool at_or_park(const key_type& key, std::optional<mapped_type>& result, Self& self) const {
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
+        auto it = container_.find(key);
+        if (it == container_.end()) {
+            std::lock_guard<std::mutex> guard(waiters_mutex_);
+            waiters_.try_emplace(key).first->second.async_ready.park(std::move(self));
+            return false;
+        }
+        result.emplace(it->second);
+        return true;
+    }
+
+    struct AtAttempt {
+        const SafeMap* map;
+        key_type key;
+
+        template <typename Self>
+        bool operator()(std::optional<mapped_type>& result, Self& self) const {
+            return map->at_or_park(key, result, self);
+        }
+    };
+
+    /**
+     * @brief Wakes the threads and operations waiting for key. Must be called with mutex_ held exclusively.
+     */
+    void notify_key(const key_type& key) {
+        if (waiters_.empty()) {
+            return; // Fast path: nobody is waiting
+        }
+        auto it = waiters_.find(key);
+        if (it != waiters_.end()) {
+            wake(it);
+        }
+    }
+
+    /**
+     * @brief Wakes every waiting thread and operation. Must be called with mutex_ held exclusively.
+     */
+    void notify_all_keys() {
+        for (auto it = waiters_.begin(); it != waiters_.end();) {
+            wake(it++);
+        }
+    }
+
+    /**
+     * @brief Wakes the waiters of one entry and drops the entry once only woken operations used it.
+     */
+    void wake(typename detail::KeyedBy<Container, KeyWaiters>::type::iterator it) {
+        stats_.record_notify_all();
+        it->second.ready.notify_all();
+        it->second.async_ready.wake_all();
+        if (it->second.unused()) {
+            waiters_.erase(it); // Woken operations re-register if the key is gone again
+        }
+    }
+
     mutable std::shared_timed_mutex mutex_;               ///< Shared mutex to protect container access
-    mutable std::condition_variable_any not_empty_;       ///< Condition variable to signal element availability
+    mutable std::mutex waiters_mutex_;                    ///< Serializes waiter registration under a shared lock
+    mutable typename detail::KeyedBy<Container, KeyWaiters>::type waiters_; ///< Per-key wait lists
     Container container_;                                 ///< Underlying associative container
+    [[no_unique_address]] mutable Stats stats_;           ///< Contention counters (empty for NullContainerStats)
 };
 
 } // namespace cxx_lab
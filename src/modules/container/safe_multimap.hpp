@@ -8,8 +8,12 @@
 #include <functional>
 #include <vector>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include <container/container_stats.hpp>
+#include <container/wait_policy.hpp>
+
 namespace cxx_lab {
 
 /**
@@ -22,8 +26,11 @@ namespace cxx_lab {
  * @tparam Key The type of keys in the associative container.
  * @tparam Mapped The type of mapped values in the associative container.
  * @tparam Container The type of the underlying associative container (e.g., std::multimap<Key, Mapped>).
+ * @tparam Stats The stats policy: NullContainerStats (no instrumentation) or ContainerStats.
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
  */
-template <typename Key, typename Mapped, typename Container = std::multimap<Key, Mapped>>
+template <typename Key, typename Mapped, typename Container = std::multimap<Key, Mapped>, typename Stats = NullContainerStats,
+          typename Wait = ConditionVariableWait>
 class SafeMultiMap {
 public:
     using container_type = Container;
@@ -32,11 +39,25 @@ public:
     using value_type = typename Container::value_type;
     using size_type = typename Container::size_type;
     using iterator = typename Container::iterator;
+    using condition_type = typename Wait::template condition_type<std::shared_timed_mutex>;
+    using node_type = typename Container::node_type;
+    using allocator_type = typename Container::allocator_type;
 
     /**
      * @brief Constructs a SafeMultiMap.
      */
-    SafeMultiMap() : mutex_(), not_empty_(), container_() {}
+    SafeMultiMap() : mutex_(), not_empty_(), container_(), stats_() {}
+
+    /**
+     * @brief Constructs a SafeMultiMap whose nodes come from the given allocator.
+     *
+     * With Container = std::pmr::multimap this places the nodes in a caller-provided arena,
+     * e.g. a std::pmr::unsynchronized_pool_resource that outlives the map (access to the map is
+     * already serialized by its mutex).
+     *
+     * @param alloc The allocator of the underlying container.
+     */
+    explicit SafeMultiMap(const allocator_type& alloc) : mutex_(), not_empty_(), container_(alloc), stats_() {}
 
     /**
      * @brief Attempts to insert an element without blocking.
@@ -47,10 +68,12 @@ public:
      */
     bool try_insert(const value_type& value) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         container_.insert(value);
+        stats_.record_size(container_.size());
+        stats_.record_notify_one();
         not_empty_.notify_one();
         return true;
     }
@@ -66,10 +89,12 @@ public:
     template <typename... Args>
     bool try_emplace(Args&&... args) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false;
         }
         container_.emplace(std::forward<Args>(args)...);
+        stats_.record_size(container_.size());
+        stats_.record_notify_one();
         not_empty_.notify_one();
         return true;
     }
@@ -83,10 +108,12 @@ public:
      */
     bool insert(const value_type& value, const std::chrono::milliseconds& timeout) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock_for(timeout)) {
+        if (!detail::try_lock_for_with_stats(stats_, lock, timeout)) {
             return false; // Timeout occurred
         }
         container_.insert(value);
+        stats_.record_size(container_.size());
+        stats_.record_notify_one();
         not_empty_.notify_one();
         return true;
     }
@@ -99,8 +126,10 @@ public:
      *         For std::multimap, insertion always succeeds unless memory allocation fails.
      */
     bool insert(const value_type& value) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         container_.insert(value);
+        stats_.record_size(container_.size());
+        stats_.record_notify_one();
         not_empty_.notify_one();
         return true;
     }
@@ -115,8 +144,10 @@ public:
      */
     template <typename... Args>
     bool emplace(Args&&... args) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         container_.emplace(std::forward<Args>(args)...);
+        stats_.record_size(container_.size());
+        stats_.record_notify_one();
         not_empty_.notify_one();
         return true;
     }
@@ -130,7 +161,7 @@ public:
      */
     size_t try_extract(const key_type& key, std::vector<mapped_type>& values) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return 0; // Unable to lock
         }
         size_t num = 0;
@@ -138,6 +169,9 @@ public:
             values.emplace_back(it->second);
             ++num;
         }
+        if (num == 0) {
+            stats_.record_try_empty();
+        }
         container_.erase(key);
         return num;
     }
@@ -151,7 +185,7 @@ public:
      * @return The number of elements extracted.
      */
     size_t extract(const key_type& key, std::vector<mapped_type>& values, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         if (!not_empty_.wait_for(lock, timeout, [this, &key]() { return container_.count(key) > 0; })) {
             return 0; // Timeout
         }
@@ -172,7 +206,7 @@ public:
      * @return The number of elements extracted.
      */
     size_t extract(const key_type& key, std::vector<mapped_type>& values) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         size_t num = 0;
         for (auto it = container_.equal_range(key).first; it != container_.equal_range(key).second; ++it) {
             values.emplace_back(it->second);
@@ -182,6 +216,84 @@ public:
         return num;
     }
 
+    /**
+     * @brief Inserts a node handle, e.g. one taken out by extract_many() or extract_range().
+     *
+     * The node keeps its allocation, so a consumer can change the node's key or mapped value
+     * and put it back without allocating.
+     *
+     * @param node The node to insert; it is left empty on success.
+     * @return true if a node was inserted, false if node was empty.
+     */
+    bool insert(node_type&& node) {
+        if (node.empty()) {
+            return false;
+        }
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
+        container_.insert(std::move(node));
+        stats_.record_size(container_.size());
+        stats_.record_notify_one();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Removes every element under any of the given keys, holding the lock once.
+     *
+     * Elements are spliced out as node handles rather than copied: the callback receives each
+     * node (in key order within a key) and may move the mapped value out, keep the node, or
+     * hand it back through insert(node_type&&). The callback runs under the exclusive lock and
+     * must not call back into this map.
+     *
+     * @tparam KeyRange A range of key_type.
+     * @tparam Callback Callable as callback(node_type&&).
+     * @param keys The keys to extract; repeated keys are harmless.
+     * @param callback Receives each extracted node.
+     * @return The number of elements extracted.
+     */
+    template <typename KeyRange, typename Callback>
+    size_type extract_many(const KeyRange& keys, Callback&& callback) {
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
+        size_type num = 0;
+        for (const auto& key : keys) {
+            auto [it, last] = container_.equal_range(key);
+            while (it != last) {
+                callback(container_.extract(it++));
+                ++num;
+            }
+        }
+        return num;
+    }
+
+    /**
+     * @brief Removes every element with a key in [lo, hi), holding the lock once.
+     *
+     * The elements are written to out as node handles, in key order, without copying the
+     * mapped values. Writing into a reserved std::vector<node_type> that the caller reuses
+     * across calls avoids per-call reallocation.
+     *
+     * @tparam OutputIt An output iterator accepting node_type.
+     * @param lo The first key of the range.
+     * @param hi The key past the end of the range.
+     * @param out The destination of the extracted nodes.
+     * @return The number of elements extracted; 0 if hi is not after lo.
+     */
+    template <typename OutputIt>
+    size_type extract_range(const key_type& lo, const key_type& hi, OutputIt out) {
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
+        size_type num = 0;
+        if (!container_.key_comp()(lo, hi)) {
+            return num;
+        }
+        auto it = container_.lower_bound(lo);
+        const auto last = container_.lower_bound(hi);
+        while (it != last) {
+            *out++ = container_.extract(it++);
+            ++num;
+        }
+        return num;
+    }
+
     /**
      * @brief Provides thread-safe write access to the underlying associative container.
      *
@@ -191,16 +303,44 @@ public:
      * @param func A function that takes a reference to the associative container.
      */
     void access(const std::function<void(Container&)>& func) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         func(container_);
+        stats_.record_notify_all();
         not_empty_.notify_all(); // Notify all waiting threads, if necessary
     }
 
+    /**
+     * @brief Runs func on the underlying container under an exclusive lock, wakes the waiters, and returns func's result.
+     */
+    template <typename Func>
+    decltype(auto) access(Func&& func) {
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
+        if constexpr (std::is_void_v<std::invoke_result_t<Func, Container&>>) {
+            std::forward<Func>(func)(container_);
+            stats_.record_notify_all();
+            not_empty_.notify_all();
+        } else {
+            auto result = std::forward<Func>(func)(container_);
+            stats_.record_notify_all();
+            not_empty_.notify_all();
+            return result;
+        }
+    }
+
+    /**
+     * @brief Runs func on the underlying container under a shared lock and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access_shared(Func&& func) const {
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
+        return std::forward<Func>(func)(std::as_const(container_));
+    }
+
     /**
      * @brief Clears all elements from the container.
      */
     void clear() {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         container_.clear();
     }
 
@@ -211,7 +351,7 @@ public:
      * @return The number of elements erased.
      */
     size_type erase(const key_type& key) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         size_type erased = container_.erase(key);
         return erased;
     }
@@ -223,7 +363,7 @@ public:
      * @return The number of elements with the specified key.
      */
     size_type count(const key_type& key) const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.count(key);
     }
 
@@ -234,7 +374,7 @@ public:
      * @return true if the container contains the key, false otherwise.
      */
     bool contains(const key_type& key) const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.find(key) != container_.end();
     }
 
@@ -244,7 +384,7 @@ public:
      * @return true if empty, false otherwise.
      */
     bool empty() const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.empty();
     }
 
@@ -254,14 +394,42 @@ public:
      * @return The number of elements.
      */
     size_type size() const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.size();
     }
 
+    /**
+     * @brief Provides the stats policy, e.g. to take a periodic snapshot or reset it.
+     *
+     * @return The stats policy of this container.
+     */
+    Stats& stats() const {
+        return stats_;
+    }
+
 private:
+    /**
+     * @brief Locks mutex_ exclusively, recording the time spent waiting in stats_.
+     */
+    std::unique_lock<std::shared_timed_mutex> acquire() const {
+        std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
+    /**
+     * @brief Locks mutex_ shared, recording the time spent waiting in stats_.
+     */
+    std::shared_lock<std::shared_timed_mutex> acquire_shared() const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
     mutable std::shared_timed_mutex mutex_;               ///< Shared mutex to protect container access
-    mutable std::condition_variable_any not_empty_;       ///< Condition variable to signal element availability
+    mutable condition_type not_empty_;                    ///< Condition variable to signal element availability
     Container container_;                                  ///< Underlying associative container
+    [[no_unique_address]] mutable Stats stats_;            ///< Contention counters (empty for NullContainerStats)
 };
 
 } // namespace cxx_lab
@@ -6,8 +6,12 @@
 #include <condition_variable>
 #include <chrono>
 #include <functional>
+#include <type_traits>
 #include <utility>
 
+#include <container/container_stats.hpp>
+#include <container/wait_policy.hpp>
+
 namespace cxx_lab {
 
 /**
@@ -19,8 +23,11 @@ namespace cxx_lab {
  *
  * @tparam Key The type of keys in the associative container.
  * @tparam Container The type of the underlying associative container (e.g., std::set<Key>).
+ * @tparam Stats The stats policy: NullContainerStats (no instrumentation) or ContainerStats.
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
  */
-template <typename Key, typename Container = std::set<Key>>
+template <typename Key, typename Container = std::set<Key>, typename Stats = NullContainerStats,
+          typename Wait = ConditionVariableWait>
 class SafeSet {
 public:
     using container_type = Container;
@@ -28,11 +35,12 @@ public:
     using value_type = typename Container::value_type;
     using size_type = typename Container::size_type;
     using iterator = typename Container::iterator;
+    using condition_type = typename Wait::template condition_type<std::shared_timed_mutex>;
 
     /**
      * @brief Constructs a SafeSet.
      */
-    SafeSet() : mutex_(), not_empty_(), container_() {}
+    SafeSet() : mutex_(), not_empty_(), container_(), stats_() {}
 
     /**
      * @brief Attempts to insert an element without blocking.
@@ -42,11 +50,13 @@ public:
      */
     bool try_insert(const value_type& value) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false; // Unable to acquire lock immediately
         }
         auto result = container_.insert(value);
+        stats_.record_size(container_.size());
         if (result.second) { // Insertion succeeded
+            stats_.record_notify_one();
             not_empty_.notify_one();
             return true;
         }
@@ -63,11 +73,13 @@ public:
     template <typename... Args>
     bool try_emplace(Args&&... args) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false; // Unable to acquire lock immediately
         }
         auto result = container_.emplace(std::forward<Args>(args)...);
+        stats_.record_size(container_.size());
         if (result.second) { // Emplacement succeeded
+            stats_.record_notify_one();
             not_empty_.notify_one();
             return true;
         }
@@ -83,11 +95,13 @@ public:
      */
     bool insert(const value_type& value, const std::chrono::milliseconds& timeout) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock_for(timeout)) {
+        if (!detail::try_lock_for_with_stats(stats_, lock, timeout)) {
             return false; // Timeout occurred
         }
         auto result = container_.insert(value);
+        stats_.record_size(container_.size());
         if (result.second) { // Insertion succeeded
+            stats_.record_notify_one();
             not_empty_.notify_one();
             return true;
         }
@@ -101,9 +115,11 @@ public:
      * @return true if the insertion was successful, false otherwise (e.g., key already exists in std::set).
      */
     bool insert(const value_type& value) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         auto result = container_.insert(value);
+        stats_.record_size(container_.size());
         if (result.second) { // Insertion succeeded
+            stats_.record_notify_one();
             not_empty_.notify_one();
             return true;
         }
@@ -119,9 +135,11 @@ public:
      */
     template <typename... Args>
     bool emplace(Args&&... args) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         auto result = container_.emplace(std::forward<Args>(args)...);
+        stats_.record_size(container_.size());
         if (result.second) { // Emplacement succeeded
+            stats_.record_notify_one();
             not_empty_.notify_one();
             return true;
         }
@@ -136,7 +154,7 @@ public:
      */
     bool try_extract(const value_type& value) {
         std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
-        if (!lock.try_lock()) {
+        if (!detail::try_lock_with_stats(stats_, lock)) {
             return false; // Unable to acquire lock immediately
         }
         auto it = container_.find(value);
@@ -144,6 +162,7 @@ public:
             container_.erase(it);
             return true;
         }
+        stats_.record_try_empty();
         return false; // Element not found
     }
 
@@ -155,7 +174,7 @@ public:
      * @return true if the extraction was successful within the timeout, false otherwise.
      */
     bool extract(const value_type& value, const std::chrono::milliseconds& timeout) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         auto deadline = std::chrono::steady_clock::now() + timeout;
         while (container_.find(value) == container_.end()) {
             if (not_empty_.wait_until(lock, deadline) == std::cv_status::timeout) {
@@ -177,7 +196,7 @@ public:
      * @return true if the extraction was successful, false otherwise.
      */
     bool extract(const value_type& value) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         not_empty_.wait(lock, [this, &value]() { return container_.find(value) != container_.end(); });
         auto it = container_.find(value);
         if (it != container_.end()) {
@@ -196,16 +215,44 @@ public:
      * @param func A function that takes a reference to the associative container.
      */
     void access(const std::function<void(Container&)>& func) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         func(container_);
+        stats_.record_notify_all();
         not_empty_.notify_all(); // Notify all waiting threads, if necessary
     }
 
+    /**
+     * @brief Runs func on the underlying container under an exclusive lock, wakes the waiters, and returns func's result.
+     */
+    template <typename Func>
+    decltype(auto) access(Func&& func) {
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
+        if constexpr (std::is_void_v<std::invoke_result_t<Func, Container&>>) {
+            std::forward<Func>(func)(container_);
+            stats_.record_notify_all();
+            not_empty_.notify_all();
+        } else {
+            auto result = std::forward<Func>(func)(container_);
+            stats_.record_notify_all();
+            not_empty_.notify_all();
+            return result;
+        }
+    }
+
+    /**
+     * @brief Runs func on the underlying container under a shared lock and returns its result.
+     */
+    template <typename Func>
+    decltype(auto) access_shared(Func&& func) const {
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
+        return std::forward<Func>(func)(std::as_const(container_));
+    }
+
     /**
      * @brief Clears all elements from the container.
      */
     void clear() {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         container_.clear();
     }
 
@@ -216,7 +263,7 @@ public:
      * @return The number of elements erased (0 or 1 for std::set).
      */
     size_type erase(const value_type& value) {
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        std::unique_lock<std::shared_timed_mutex> lock = acquire();
         size_type erased = container_.erase(value);
         return erased;
     }
@@ -228,7 +275,7 @@ public:
      * @return The number of elements with the specified key (0 or 1 for std::set).
      */
     size_type count(const key_type& key) const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.count(key);
     }
 
@@ -239,7 +286,7 @@ public:
      * @return true if the container contains the key, false otherwise.
      */
     bool contains(const key_type& key) const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.find(key) != container_.end();
     }
 
@@ -249,7 +296,7 @@ public:
      * @return true if empty, false otherwise.
      */
     bool empty() const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.empty();
     }
 
@@ -259,14 +306,42 @@ public:
      * @return The number of elements.
      */
     size_type size() const {
-        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        std::shared_lock<std::shared_timed_mutex> lock = acquire_shared();
         return container_.size();
     }
 
+    /**
+     * @brief Provides the stats policy, e.g. to take a periodic snapshot or reset it.
+     *
+     * @return The stats policy of this container.
+     */
+    Stats& stats() const {
+        return stats_;
+    }
+
 private:
+    /**
+     * @brief Locks mutex_ exclusively, recording the time spent waiting in stats_.
+     */
+    std::unique_lock<std::shared_timed_mutex> acquire() const {
+        std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
+    /**
+     * @brief Locks mutex_ shared, recording the time spent waiting in stats_.
+     */
+    std::shared_lock<std::shared_timed_mutex> acquire_shared() const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_, std::defer_lock);
+        detail::lock_with_stats(stats_, lock);
+        return lock;
+    }
+
     mutable std::shared_timed_mutex mutex_;               ///< Shared mutex to protect container access
-    mutable std::condition_variable_any not_empty_;       ///< Condition variable to signal element availability
+    mutable condition_type not_empty_;                    ///< Condition variable to signal element availability
     Container container_;                                  ///< Underlying associative container
+    [[no_unique_address]] mutable Stats stats_;            ///< Contention counters (empty for NullContainerStats)
 };
 
 } // namespace cxx_lab
@@ -0,0 +1,569 @@
+#ifndef CXX_LAB_SHARDED_SAFE_MAP_HPP
+#define CXX_LAB_SHARDED_SAFE_MAP_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <utility>
+
+#include <container/cache_line.hpp>
+#include <container/wait_policy.hpp>
+
+namespace cxx_lab {
+
+namespace detail {
+
+/**
+ * @brief Spreads the bits of a user hash so that both the low and the high bits are usable.
+ *
+ * std::hash for integers is the identity, which would put consecutive keys into the same
+ * shard and long runs of neighbouring slots. This is the 64-bit finalizer of MurmurHash3.
+ */
+inline std::size_t mix_hash(std::size_t hash) {
+    std::uint64_t h = hash;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+
+/**
+ * @brief An open-addressing hash table with linear probing and backward-shift deletion.
+ *
+ * Not thread-safe; ShardedSafeMap guards one instance per shard. A parallel array of control
+ * bytes (empty, or a 7-bit tag of the hash) is scanned first so most mismatching probes never
+ * touch the element storage. Erasure shifts the following entries back instead of leaving
+ * tombstones, so lookups never degrade after many insert/erase cycles.
+ *
+ * Callers pass the already mixed hash of the key; it is stored next to each element so that
+ * growing and erasing never call the user's hash function again.
+ */
+template <typename Key, typename Mapped, typename KeyEqual = std::equal_to<Key>>
+class FlatHashTable {
+public:
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using value_type = std::pair<Key, Mapped>;
+    using size_type = std::size_t;
+
+    FlatHashTable() = default;
+    FlatHashTable(const FlatHashTable&) = delete;
+    FlatHashTable& operator=(const FlatHashTable&) = delete;
+
+    ~FlatHashTable() {
+        clear();
+    }
+
+    /**
+     * @brief Finds the element with the given key.
+     *
+     * @return Pointer to the element, or nullptr if absent. Invalidated by any insertion or erasure.
+     */
+    value_type* find(const key_type& key, size_type hash) const {
+        const size_type pos = find_index(key, hash);
+        return pos == NPOS ? nullptr : slots_[pos].element();
+    }
+
+    /**
+     * @brief Inserts value unless its key is already present.
+     *
+     * @param hash The mixed hash of value.first.
+     * @param value The element to insert. Left untouched if the key exists.
+     * @return true if inserted, false if the key already exists.
+     */
+    template <typename V>
+    bool insert(size_type hash, V&& value) {
+        if (find(value.first, hash) != nullptr) {
+            return false;
+        }
+        if ((size_ + 1) * MAX_LOAD_DEN > capacity_ * MAX_LOAD_NUM) {
+            rehash(capacity_ == 0 ? MIN_CAPACITY : capacity_ * 2);
+        }
+        place(hash, std::forward<V>(value));
+        ++size_;
+        return true;
+    }
+
+    /**
+     * @brief Erases the element with the given key.
+     *
+     * @return The number of elements erased (0 or 1).
+     */
+    size_type erase(const key_type& key, size_type hash) {
+        size_type hole = find_index(key, hash);
+        if (hole == NPOS) {
+            return 0;
+        }
+        slots_[hole].element()->~value_type();
+
+        // Backward-shift: pull every following entry that may live in the hole closer to its home
+        for (size_type pos = (hole + 1) & mask_; ctrl_[pos] != EMPTY; pos = (pos + 1) & mask_) {
+            const size_type home = slots_[pos].hash & mask_;
+            if (((pos - home) & mask_) >= ((pos - hole) & mask_)) {
+                move_slot(pos, hole);
+                hole = pos;
+            }
+        }
+        ctrl_[hole] = EMPTY;
+        --size_;
+        return 1;
+    }
+
+    /**
+     * @brief Destroys all elements but keeps the allocated slots.
+     */
+    void clear() {
+        for (size_type pos = 0; pos < capacity_ && size_ > 0; ++pos) {
+            if (ctrl_[pos] != EMPTY) {
+                slots_[pos].element()->~value_type();
+                ctrl_[pos] = EMPTY;
+                --size_;
+            }
+        }
+    }
+
+    size_type size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+private:
+    static constexpr std::uint8_t EMPTY = 0;
+    static constexpr size_type NPOS = static_cast<size_type>(-1);
+    static constexpr size_type MIN_CAPACITY = 8;
+    static constexpr size_type MAX_LOAD_NUM = 3; ///< Grow beyond a 3/4 load factor
+    static constexpr size_type MAX_LOAD_DEN = 4;
+
+    /**
+     * @brief Element storage together with the element's mixed hash.
+     */
+    struct Slot {
+        size_type hash;
+        alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+        value_type* element() {
+            return std::launder(reinterpret_cast<value_type*>(storage));
+        }
+    };
+
+    static std::uint8_t tag_of(size_type hash) {
+        // High bit set marks the slot as full, the rest are the top hash bits
+        return static_cast<std::uint8_t>(0x80 | (hash >> (sizeof(size_type) * 8 - 7)));
+    }
+
+    size_type find_index(const key_type& key, size_type hash) const {
+        if (capacity_ == 0) {
+            return NPOS;
+        }
+        const std::uint8_t tag = tag_of(hash);
+        for (size_type pos = hash & mask_;; pos = (pos + 1) & mask_) {
+            const std::uint8_t ctrl = ctrl_[pos];
+            if (ctrl == EMPTY) {
+                return NPOS;
+            }
+            if (ctrl == tag && slots_[pos].hash == hash && equal_(slots_[pos].element()->first, key)) {
+                return pos;
+            }
+        }
+    }
+
+    template <typename V>
+    void place(size_type hash, V&& value) {
+        size_type pos = hash & mask_;
+        while (ctrl_[pos] != EMPTY) {
+            pos = (pos + 1) & mask_;
+        }
+        ::new (static_cast<void*>(slots_[pos].storage)) value_type(std::forward<V>(value));
+        slots_[pos].hash = hash;
+        ctrl_[pos] = tag_of(hash);
+    }
+
+    void move_slot(size_type from, size_type to) {
+        value_type* source = slots_[from].element();
+        ::new (static_cast<void*>(slots_[to].storage)) value_type(std::move(*source));
+        source->~value_type();
+        slots_[to].hash = slots_[from].hash;
+        ctrl_[to] = ctrl_[from];
+    }
+
+    void rehash(size_type new_capacity) {
+        auto old_ctrl = std::move(ctrl_);
+        auto old_slots = std::move(slots_);
+        const size_type old_capacity = capacity_;
+
+        ctrl_ = std::make_unique<std::uint8_t[]>(new_capacity); // Value-initialized to EMPTY
+        slots_.reset(new Slot[new_capacity]);       // Element storage stays uninitialized
+        capacity_ = new_capacity;
+        mask_ = new_capacity - 1;
+
+        for (size_type pos = 0; pos < old_capacity; ++pos) {
+            if (old_ctrl[pos] != EMPTY) {
+                value_type* element = old_slots[pos].element();
+                place(old_slots[pos].hash, std::move(*element));
+                element->~value_type();
+            }
+        }
+    }
+
+    std::unique_ptr<std::uint8_t[]> ctrl_; ///< EMPTY or the tag of the element in the same slot
+    std::unique_ptr<Slot[]> slots_;        ///< Element storage, parallel to ctrl_
+    size_type capacity_ = 0;               ///< Number of slots (zero or a power of two)
+    size_type mask_ = 0;                   ///< capacity_ - 1, used to wrap probe positions
+    size_type size_ = 0;                   ///< Number of elements
+    [[no_unique_address]] KeyEqual equal_;
+};
+
+} // namespace detail
+
+/**
+ * @brief A thread-safe hash map split into independently locked shards.
+ *
+ * SafeMap serializes every writer on one mutex and walks a tree on every lookup. This map hashes
+ * each key to one of Shards cache-line-aligned shards; each shard is an open-addressing flat
+ * table with its own shared mutex and condition variable, so operations on different shards
+ * never contend and a lookup is usually a single probe into contiguous memory.
+ *
+ * The interface mirrors SafeMap:
+ * - `try_insert()`, `try_emplace()`, `try_at()`: Non-blocking attempts (fail if the shard is locked).
+ * - `insert(value, timeout)`, `at(key, value, timeout)`: Blocking with timeout.
+ * - `insert()`, `emplace()`, `at(key)`: Blocking until done.
+ * - `erase()`, `count()`, `contains()`, `clear()`, `size()`, `empty()`.
+ *
+ * Elements move when a shard grows or erases, so `at(key)` returns the mapped value by copy
+ * rather than by reference, and there is no `access()` to the underlying container.
+ * `size()` and `empty()` lock the shards one after another and are only a snapshot under
+ * concurrent modification.
+ *
+ * @tparam Key The type of keys in the map.
+ * @tparam Mapped The type of mapped values in the map.
+ * @tparam Hash The hash function for keys.
+ * @tparam Shards The number of shards (a power of two).
+ * @tparam Wait The waiting policy: ConditionVariableWait (default) or AtomicWait.
+ */
+template <typename Key, typename Mapped, typename Hash = std::hash<Key>, std::size_t Shards = 16,
+          typename Wait = ConditionVariableWait>
+class ShardedSafeMap {
+    static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "Shards must be a power of two");
+
+public:
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using value_type = std::pair<const Key, Mapped>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using condition_type = typename Wait::template condition_type<std::shared_timed_mutex>;
+
+    /**
+     * @brief Constructs a ShardedSafeMap.
+     *
+     * @param hash The hash function object.
+     */
+    explicit ShardedSafeMap(const Hash& hash = Hash()) : hash_(hash), shards_() {}
+
+    ShardedSafeMap(const ShardedSafeMap&) = delete;
+    ShardedSafeMap& operator=(const ShardedSafeMap&) = delete;
+
+    /**
+     * @brief Attempts to insert an element without blocking.
+     *
+     * @param value The element to insert.
+     * @return true if the insertion was successful, false if the key exists or the shard is locked.
+     */
+    bool try_insert(const value_type& value) {
+        const size_type hash = hash_of(value.first);
+        Shard& shard = shard_of(hash);
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex, std::defer_lock);
+        if (!lock.try_lock()) {
+            return false;
+        }
+        return insert_locked(shard, hash, value);
+    }
+
+    /**
+     * @brief Attempts to emplace an element without blocking.
+     *
+     * The element is constructed before the shard is chosen, even if the insertion then fails.
+     *
+     * @tparam Args The types of the arguments to construct the element.
+     * @param args The arguments to pass to the element's constructor.
+     * @return true if the emplacement was successful, false if the key exists or the shard is locked.
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        entry_type entry(std::forward<Args>(args)...);
+        const size_type hash = hash_of(entry.first);
+        Shard& shard = shard_of(hash);
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex, std::defer_lock);
+        if (!lock.try_lock()) {
+            return false;
+        }
+        return insert_locked(shard, hash, std::move(entry));
+    }
+
+    /**
+     * @brief Inserts an element, blocking until the insertion is successful or timeout occurs.
+     *
+     * @param value The element to insert.
+     * @param timeout The maximum duration to wait for the shard lock.
+     * @return true if the insertion was successful within the timeout, false otherwise.
+     */
+    bool insert(const value_type& value, const std::chrono::milliseconds& timeout) {
+        const size_type hash = hash_of(value.first);
+        Shard& shard = shard_of(hash);
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex, std::defer_lock);
+        if (!lock.try_lock_for(timeout)) {
+            return false; // Timeout occurred
+        }
+        return insert_locked(shard, hash, value);
+    }
+
+    /**
+     * @brief Inserts an element, blocking until the insertion is successful.
+     *
+     * @param value The element to insert.
+     * @return true if the insertion was successful, false if the key already exists.
+     */
+    bool insert(const value_type& value) {
+        const size_type hash = hash_of(value.first);
+        Shard& shard = shard_of(hash);
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+        return insert_locked(shard, hash, value);
+    }
+
+    /**
+     * @brief Emplaces an element, blocking until the emplacement is successful.
+     *
+     * @tparam Args The types of the arguments to construct the element.
+     * @param args The arguments to pass to the element's constructor.
+     * @return true if the emplacement was successful, false if the key already exists.
+     */
+    template <typename... Args>
+    bool emplace(Args&&... args) {
+        entry_type entry(std::forward<Args>(args)...);
+        const size_type hash = hash_of(entry.first);
+        Shard& shard = shard_of(hash);
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+        return insert_locked(shard, hash, std::move(entry));
+    }
+
+    /**
+     * @brief Attempts to access an element by key without blocking.
+     *
+     * @param key The key of the element to access.
+     * @param value Reference to store the accessed value.
+     * @return true if the element was found, false if it is absent or the shard is locked.
+     */
+    bool try_at(const key_type& key, mapped_type& value) const {
+        const size_type hash = hash_of(key);
+        const Shard& shard = shard_of(hash);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex, std::defer_lock);
+        if (!lock.try_lock()) {
+            return false;
+        }
+        if (auto* entry = shard.table.find(key, hash)) {
+            value = entry->second;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Attempts to access an element by key, blocking up to the specified timeout.
+     *
+     * @param key The key of the element to access.
+     * @param value Reference to store the accessed value.
+     * @param timeout The maximum duration to wait for the element to become available.
+     * @return true if the element was found within the timeout, false otherwise.
+     */
+    bool at(const key_type& key, mapped_type& value, const std::chrono::milliseconds& timeout) const {
+        const size_type hash = hash_of(key);
+        const Shard& shard = shard_of(hash);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        const typename table_type::value_type* entry;
+        while ((entry = shard.table.find(key, hash)) == nullptr) {
+            if (!wait_until(shard, lock, deadline)) {
+                return false; // Timeout expired
+            }
+        }
+        value = entry->second;
+        return true;
+    }
+
+    /**
+     * @brief Accesses an element by key, blocking until the element is available.
+     *
+     * @param key The key of the element to access.
+     * @return A copy of the mapped value.
+     */
+    mapped_type at(const key_type& key) const {
+        const size_type hash = hash_of(key);
+        const Shard& shard = shard_of(hash);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        const typename table_type::value_type* entry;
+        while ((entry = shard.table.find(key, hash)) == nullptr) {
+            wait(shard, lock);
+        }
+        return entry->second;
+    }
+
+    /**
+     * @brief Clears all elements from the map.
+     */
+    void clear() {
+        for (auto& shard : shards_) {
+            std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+            shard.table.clear();
+        }
+    }
+
+    /**
+     * @brief Erases the element with the specified key.
+     *
+     * @param key The key of the element to erase.
+     * @return The number of elements erased.
+     */
+    size_type erase(const key_type& key) {
+        const size_type hash = hash_of(key);
+        Shard& shard = shard_of(hash);
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+        return shard.table.erase(key, hash);
+    }
+
+    /**
+     * @brief Returns the number of elements with the specified key.
+     *
+     * @param key The key to count.
+     * @return 1 if the key is present, 0 otherwise.
+     */
+    size_type count(const key_type& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Checks if the map contains the specified key.
+     *
+     * @param key The key to check.
+     * @return true if the map contains the key, false otherwise.
+     */
+    bool contains(const key_type& key) const {
+        const size_type hash = hash_of(key);
+        const Shard& shard = shard_of(hash);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        return shard.table.find(key, hash) != nullptr;
+    }
+
+    /**
+     * @brief Checks if the map is empty.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const {
+        for (const auto& shard : shards_) {
+            std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+            if (!shard.table.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Retrieves the current number of elements in the map.
+     *
+     * @return The number of elements.
+     */
+    size_type size() const {
+        size_type total = 0;
+        for (const auto& shard : shards_) {
+            std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+            total += shard.table.size();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Retrieves the number of shards.
+     *
+     * @return The Shards template argument.
+     */
+    static constexpr size_type shard_count() {
+        return Shards;
+    }
+
+private:
+    using entry_type = std::pair<Key, Mapped>; ///< Stored element; the key must stay movable for probing
+    using table_type = detail::FlatHashTable<Key, Mapped>;
+
+    /**
+     * @brief One independently locked part of the map, on its own cache lines.
+     */
+    struct alignas(cache_line_size) Shard {
+        mutable std::shared_timed_mutex mutex;           ///< Protects table
+        mutable condition_type not_empty;                ///< Signals insertions to at() waiters
+        mutable std::atomic<size_type> waiters{0};       ///< Threads blocked in at(); avoids needless notifies
+        table_type table;                                ///< Elements of this shard
+    };
+
+    size_type hash_of(const key_type& key) const {
+        return detail::mix_hash(hash_(key));
+    }
+
+    // The table indexes with the low bits, so pick the shard from the middle ones
+    static constexpr unsigned shard_shift = sizeof(size_type) * CHAR_BIT / 2;
+
+    Shard& shard_of(size_type hash) {
+        return shards_[(hash >> shard_shift) & (Shards - 1)];
+    }
+
+    const Shard& shard_of(size_type hash) const {
+        return shards_[(hash >> shard_shift) & (Shards - 1)];
+    }
+
+    template <typename V>
+    static bool insert_locked(Shard& shard, size_type hash, V&& value) {
+        if (!shard.table.insert(hash, std::forward<V>(value))) {
+            return false; // Insertion failed (key exists)
+        }
+        // Waiters register under the shared lock, which this exclusive lock excludes
+        if (shard.waiters.load(std::memory_order_relaxed) > 0) {
+            shard.not_empty.notify_all(); // Waiters may be looking for different keys
+        }
+        return true;
+    }
+
+    static void wait(const Shard& shard, std::shared_lock<std::shared_timed_mutex>& lock) {
+        shard.waiters.fetch_add(1, std::memory_order_relaxed);
+        shard.not_empty.wait(lock);
+        shard.waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    static bool wait_until(const Shard& shard, std::shared_lock<std::shared_timed_mutex>& lock,
+                           const std::chrono::steady_clock::time_point& deadline) {
+        shard.waiters.fetch_add(1, std::memory_order_relaxed);
+        auto status = shard.not_empty.wait_until(lock, deadline);
+        shard.waiters.fetch_sub(1, std::memory_order_relaxed);
+        return status == std::cv_status::no_timeout;
+    }
+
+    Hash hash_;                        ///< User hash function, mixed by detail::mix_hash()
+    std::array<Shard, Shards> shards_; ///< Independently locked shards
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_SHARDED_SAFE_MAP_HPP
@@ -0,0 +1,292 @@
+#ifndef CXX_LAB_SNAPSHOT_MAP_HPP
+#define CXX_LAB_SNAPSHOT_MAP_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <container/hazard_pointer.hpp>
+#include <container/wait_policy.hpp>
+
+namespace cxx_lab {
+
+/**
+ * @brief A read-mostly associative container with lock-free readers (read-copy-update).
+ *
+ * The map is an immutable snapshot published through an atomic pointer. Readers protect the
+ * current snapshot with a hazard pointer and look up in it without taking any lock and without
+ * writing to memory shared with other threads. Writers copy the current snapshot, apply their
+ * mutations to the copy and publish it as the next version; superseded snapshots are deleted as
+ * soon as no reader holds them.
+ *
+ * Every write copies the whole container, so group related mutations into one `update()`
+ * call. The single-mutation helpers (`insert()`, `emplace()`, `erase()`, `clear()`) each
+ * publish a version of their own.
+ *
+ * The lookup interface mirrors SafeMap:
+ * - `try_at()`: Non-blocking; never fails because of writers.
+ * - `at(key, value, timeout)`: Blocks until the key is published or the timeout expires.
+ * - `at(key)`: Blocks until the key is published.
+ * - `count()`, `contains()`, `empty()`, `size()`.
+ *
+ * Since a snapshot may be reclaimed once the call returns, `at(key)` returns the mapped value by
+ * copy; use `read()` to inspect a consistent snapshot without copying.
+ *
+ * @tparam Key The type of keys in the map.
+ * @tparam Mapped The type of mapped values in the map.
+ * @tparam Container The type of the underlying associative container (e.g., std::map<Key, Mapped>).
+ * @tparam Wait The waiting policy for blocked lookups: ConditionVariableWait (default) or AtomicWait.
+ */
+template <typename Key, typename Mapped, typename Container = std::map<Key, Mapped>,
+          typename Wait = ConditionVariableWait>
+class SnapshotMap {
+public:
+    using container = Container;
+    using key_type = typename Container::key_type;
+    using mapped_type = typename Container::mapped_type;
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+    using condition_type = typename Wait::template condition_type<std::mutex>;
+
+    /**
+     * @brief Constructs an empty SnapshotMap.
+     */
+    SnapshotMap() : current_(new Container()) {}
+
+    /**
+     * @brief Constructs a SnapshotMap whose first version is container.
+     *
+     * @param container The initial contents.
+     */
+    explicit SnapshotMap(Container container) : current_(new Container(std::move(container))) {}
+
+    SnapshotMap(const SnapshotMap&) = delete;
+    SnapshotMap& operator=(const SnapshotMap&) = delete;
+
+    /**
+     * @brief Destroys the map. No reader may still be inside a lookup.
+     */
+    ~SnapshotMap() {
+        delete current_.load(std::memory_order_relaxed);
+        for (const Container* snapshot : retired_) {
+            delete snapshot;
+        }
+    }
+
+    // =====================
+    // Lookups
+    // =====================
+
+    /**
+     * @brief Looks up an element by key without blocking.
+     *
+     * @param key The key of the element to access.
+     * @param value Reference to store the accessed value.
+     * @return true if the element was found, false otherwise.
+     */
+    bool try_at(const key_type& key, mapped_type& value) const {
+        return read([&](const Container& snapshot) {
+            auto it = snapshot.find(key);
+            if (it != snapshot.end()) {
+                value = it->second;
+                return true;
+            }
+            return false;
+        });
+    }
+
+    /**
+     * @brief Looks up an element by key, blocking up to the specified timeout for it to be published.
+     *
+     * @param key The key of the element to access.
+     * @param value Reference to store the accessed value.
+     * @param timeout The maximum duration to wait for the element to become available.
+     * @return true if the element was found within the timeout, false otherwise.
+     */
+    bool at(const key_type& key, mapped_type& value, const std::chrono::milliseconds& timeout) const {
+        if (try_at(key, value)) {
+            return true; // Fast path: no lock
+        }
+        std::unique_lock<std::mutex> lock(write_mutex_);
+        return published_.wait_for(lock, timeout, [&]() { return try_at(key, value); });
+    }
+
+    /**
+     * @brief Looks up an element by key, blocking until it is published.
+     *
+     * @param key The key of the element to access.
+     * @return A copy of the mapped value.
+     */
+    mapped_type at(const key_type& key) const {
+        mapped_type value;
+        if (!try_at(key, value)) {
+            std::unique_lock<std::mutex> lock(write_mutex_);
+            published_.wait(lock, [&]() { return try_at(key, value); });
+        }
+        return value;
+    }
+
+    /**
+     * @brief Returns the number of elements with the specified key.
+     *
+     * @param key The key to count.
+     * @return The number of elements with the specified key.
+     */
+    size_type count(const key_type& key) const {
+        return read([&](const Container& snapshot) { return snapshot.count(key); });
+    }
+
+    /**
+     * @brief Checks if the map contains the specified key.
+     *
+     * @param key The key to check.
+     * @return true if the map contains the key, false otherwise.
+     */
+    bool contains(const key_type& key) const {
+        return read([&](const Container& snapshot) { return snapshot.find(key) != snapshot.end(); });
+    }
+
+    /**
+     * @brief Checks if the map is empty.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const {
+        return read([](const Container& snapshot) { return snapshot.empty(); });
+    }
+
+    /**
+     * @brief Retrieves the number of elements in the current version.
+     *
+     * @return The number of elements.
+     */
+    size_type size() const {
+        return read([](const Container& snapshot) { return snapshot.size(); });
+    }
+
+    /**
+     * @brief Runs func on the current snapshot and returns its result.
+     *
+     * The snapshot is immutable and stays alive for the duration of the call, so several
+     * lookups inside func see one consistent version. func must not keep references into the
+     * snapshot after it returns.
+     *
+     * @param func A callable taking `const Container&`.
+     * @return Whatever func returns.
+     */
+    template <typename Func>
+    decltype(auto) read(Func&& func) const {
+        HazardGuard guard;
+        return std::forward<Func>(func)(*guard.protect(current_));
+    }
+
+    // =====================
+    // Updates
+    // =====================
+
+    /**
+     * @brief Applies a batch of mutations and publishes the result as one new version.
+     *
+     * func receives a private copy of the current version; readers keep seeing the old version
+     * until func returns. Writers are serialized. If func throws, nothing is published.
+     *
+     * @param func A callable taking `Container&`.
+     * @return Whatever func returns.
+     */
+    template <typename Func>
+    decltype(auto) update(Func&& func) {
+        std::unique_lock<std::mutex> lock(write_mutex_);
+        auto next = std::make_unique<Container>(*current_.load(std::memory_order_relaxed));
+        if constexpr (std::is_void_v<std::invoke_result_t<Func, Container&>>) {
+            std::forward<Func>(func)(*next);
+            publish(std::move(next));
+        } else {
+            auto result = std::forward<Func>(func)(*next);
+            publish(std::move(next));
+            return result;
+        }
+    }
+
+    /**
+     * @brief Inserts an element as a new version.
+     *
+     * @param value The element to insert.
+     * @return true if the insertion was successful, false if the key already exists.
+     */
+    bool insert(const value_type& value) {
+        return update([&](Container& next) { return next.insert(value).second; });
+    }
+
+    /**
+     * @brief Emplaces an element as a new version.
+     *
+     * @tparam Args The types of the arguments to construct the element.
+     * @param args The arguments to pass to the element's constructor.
+     * @return true if the emplacement was successful, false if the key already exists.
+     */
+    template <typename... Args>
+    bool emplace(Args&&... args) {
+        return update([&](Container& next) { return next.emplace(std::forward<Args>(args)...).second; });
+    }
+
+    /**
+     * @brief Erases the elements with the specified key as a new version.
+     *
+     * @param key The key of the elements to erase.
+     * @return The number of elements erased.
+     */
+    size_type erase(const key_type& key) {
+        return update([&](Container& next) { return next.erase(key); });
+    }
+
+    /**
+     * @brief Publishes an empty version.
+     */
+    void clear() {
+        std::unique_lock<std::mutex> lock(write_mutex_);
+        publish(std::make_unique<Container>());
+    }
+
+private:
+    /**
+     * @brief Swaps in next, retires the previous version and wakes blocked lookups.
+     *
+     * Must be called with write_mutex_ held.
+     */
+    void publish(std::unique_ptr<Container> next) {
+        retired_.push_back(current_.exchange(next.release(), std::memory_order_seq_cst));
+        reclaim();
+        published_.notify_all();
+    }
+
+    /**
+     * @brief Deletes every retired version that no reader is protecting.
+     */
+    void reclaim() {
+        const auto hazards = HazardDomain::instance().protected_pointers();
+        auto still_used = std::remove_if(retired_.begin(), retired_.end(), [&](const Container* snapshot) {
+            if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(snapshot))) {
+                return false;
+            }
+            delete snapshot;
+            return true;
+        });
+        retired_.erase(still_used, retired_.end());
+    }
+
+    std::atomic<const Container*> current_;          ///< Published immutable version
+    mutable std::mutex write_mutex_;                 ///< Serializes writers and blocked lookups
+    mutable condition_type published_;               ///< Signals a new version to blocked lookups
+    std::vector<const Container*> retired_;          ///< Superseded versions still protected by readers
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_SNAPSHOT_MAP_HPP
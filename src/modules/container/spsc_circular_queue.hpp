@@ -0,0 +1,348 @@
+#ifndef CXX_LAB_SPSC_CIRCULAR_QUEUE_HPP
+#define CXX_LAB_SPSC_CIRCULAR_QUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <container/cache_line.hpp>
+
+namespace cxx_lab {
+
+namespace detail {
+
+/**
+ * @brief Spin-then-yield-then-sleep back-off used by the lock-free queues while waiting.
+ */
+class SpinBackoff {
+public:
+    /**
+     * @brief Waits a little longer on every call: CPU pause, then yield, then a short sleep.
+     */
+    void pause() {
+        if (spins_ < SPIN_LIMIT) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#endif
+        } else if (spins_ < YIELD_LIMIT) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        ++spins_;
+    }
+
+    /**
+     * @brief Restarts the back-off sequence from the cheapest step.
+     */
+    void reset() {
+        spins_ = 0;
+    }
+
+private:
+    static constexpr unsigned SPIN_LIMIT = 64;   ///< Number of pause iterations before yielding
+    static constexpr unsigned YIELD_LIMIT = 128; ///< Number of iterations before sleeping
+
+    unsigned spins_ = 0; ///< Number of pause() calls since the last reset
+};
+
+} // namespace detail
+
+/**
+ * @brief A wait-free single-producer/single-consumer ring buffer.
+ *
+ * This queue is a drop-in alternative to SafeCircularQueue for pipelines with exactly one
+ * producer thread and one consumer thread. It keeps the same try_/timed/blocking naming for
+ * push_back() and pop_front(), so code that is templated on the queue type can switch between
+ * the two with a template parameter:
+ *
+ * @code
+ * template <typename Queue>
+ * void consume(Queue& queue) {
+ *     int value;
+ *     while (queue.pop_front(value, std::chrono::milliseconds(100))) { ... }
+ * }
+ * consume(spsc_queue);   // SpscCircularQueue<int>
+ * consume(mutex_queue);  // SafeCircularQueue<int>
+ * @endcode
+ *
+ * Differences from SafeCircularQueue:
+ * - Only push_back() (producer) and pop_front() (consumer) are provided.
+ * - The capacity is rounded up to the next power of two.
+ * - A full queue never overwrites: blocking pushes wait for the consumer instead.
+ * - Blocking operations spin, yield and then sleep; there is no mutex or condition variable.
+ *
+ * The head and tail indices live on separate cache lines, and each side caches the last
+ * observed index of the other side so that the common case touches only its own line.
+ *
+ * @tparam T The type of elements stored in the queue.
+ */
+template <typename T>
+class SpscCircularQueue {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an SpscCircularQueue with at least the specified capacity.
+     *
+     * @param capacity The minimum number of elements the queue can hold (rounded up to a power of two).
+     * @throws std::invalid_argument if capacity is zero.
+     */
+    explicit SpscCircularQueue(size_type capacity)
+        : capacity_(round_up_pow2(capacity)), mask_(capacity_ - 1), slots_(new Slot[capacity_])
+    {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than zero.");
+        }
+    }
+
+    SpscCircularQueue(const SpscCircularQueue&) = delete;
+    SpscCircularQueue& operator=(const SpscCircularQueue&) = delete;
+
+    ~SpscCircularQueue() {
+        // Destroy the remaining elements
+        const size_type tail = tail_.load(std::memory_order_acquire);
+        for (size_type head = head_.load(std::memory_order_acquire); head != tail; ++head) {
+            std::launder(reinterpret_cast<T*>(slots_[head & mask_].storage))->~T();
+        }
+    }
+
+    // =====================
+    // Producer Operations
+    // =====================
+
+    /**
+     * @brief Attempts to push an element to the back without blocking.
+     *
+     * @param item The element to push.
+     * @return true if the push was successful, false if the queue is full.
+     */
+    bool try_push_back(const T& item) {
+        return try_emplace_back(item);
+    }
+
+    /**
+     * @brief Attempts to move an element to the back without blocking.
+     *
+     * @param item The element to push.
+     * @return true if the push was successful, false if the queue is full.
+     */
+    bool try_push_back(T&& item) {
+        return try_emplace_back(std::move(item));
+    }
+
+    /**
+     * @brief Attempts to construct an element in place at the back without blocking.
+     *
+     * @param args The arguments to pass to the element's constructor.
+     * @return true if the element was constructed, false if the queue is full.
+     */
+    template <typename... Args>
+    bool try_emplace_back(Args&&... args) {
+        const size_type tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ == capacity_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ == capacity_) {
+                return false; // Queue is full
+            }
+        }
+        ::new (static_cast<void*>(slots_[tail & mask_].storage)) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Attempts to push an element to the back, blocking up to the specified timeout.
+     *
+     * @param item The element to push.
+     * @param timeout The maximum duration to wait for space to become available.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push_back(const T& item, const std::chrono::milliseconds& timeout) {
+        return wait_for(timeout, [&]() { return try_emplace_back(item); });
+    }
+
+    /**
+     * @brief Attempts to move an element to the back, blocking up to the specified timeout.
+     *
+     * The element is left untouched if the timeout expires.
+     *
+     * @param item The element to push.
+     * @param timeout The maximum duration to wait for space to become available.
+     * @return true if the push was successful within the timeout, false otherwise.
+     */
+    bool push_back(T&& item, const std::chrono::milliseconds& timeout) {
+        return wait_for(timeout, [&]() { return try_emplace_back(std::move(item)); });
+    }
+
+    /**
+     * @brief Pushes an element to the back, blocking until space is available.
+     *
+     * @param item The element to push.
+     */
+    void push_back(const T& item) {
+        wait([&]() { return try_emplace_back(item); });
+    }
+
+    /**
+     * @brief Moves an element to the back, blocking until space is available.
+     *
+     * @param item The element to push.
+     */
+    void push_back(T&& item) {
+        wait([&]() { return try_emplace_back(std::move(item)); });
+    }
+
+    // =====================
+    // Consumer Operations
+    // =====================
+
+    /**
+     * @brief Attempts to pop an element from the front without blocking.
+     *
+     * @param item Reference to store the popped element.
+     * @return true if the pop was successful, false if the queue is empty.
+     */
+    bool try_pop_front(T& item) {
+        const size_type head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) {
+                return false; // Queue is empty
+            }
+        }
+        T* slot = std::launder(reinterpret_cast<T*>(slots_[head & mask_].storage));
+        item = std::move(*slot);
+        slot->~T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Attempts to pop an element from the front, blocking up to the specified timeout.
+     *
+     * @param item Reference to store the popped element.
+     * @param timeout The maximum duration to wait for an element to become available.
+     * @return true if the pop was successful within the timeout, false otherwise.
+     */
+    bool pop_front(T& item, const std::chrono::milliseconds& timeout) {
+        return wait_for(timeout, [&]() { return try_pop_front(item); });
+    }
+
+    /**
+     * @brief Pops an element from the front, blocking until an element is available.
+     *
+     * @param item Reference to store the popped element.
+     */
+    void pop_front(T& item) {
+        wait([&]() { return try_pop_front(item); });
+    }
+
+    // =====================
+    // Utility Functions
+    // =====================
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * The result is exact when called by the producer or consumer thread and a snapshot otherwise.
+     *
+     * @return true if empty, false otherwise.
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Checks if the queue is full.
+     *
+     * @return true if full, false otherwise.
+     */
+    bool full() const {
+        return size() == capacity_;
+    }
+
+    /**
+     * @brief Retrieves the current number of elements in the queue.
+     *
+     * @return The number of elements.
+     */
+    size_type size() const {
+        // Load head first: tail only grows, so tail - head can never underflow.
+        const size_type head = head_.load(std::memory_order_acquire);
+        const size_type tail = tail_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    /**
+     * @brief Retrieves the capacity of the queue.
+     *
+     * @return The capacity (a power of two).
+     */
+    size_type capacity() const {
+        return capacity_;
+    }
+
+private:
+    /**
+     * @brief Uninitialized storage for one element.
+     */
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static size_type round_up_pow2(size_type value) {
+        size_type result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    template <typename Op>
+    static void wait(Op&& op) {
+        detail::SpinBackoff backoff;
+        while (!op()) {
+            backoff.pause();
+        }
+    }
+
+    template <typename Op>
+    static bool wait_for(const std::chrono::milliseconds& timeout, Op&& op) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        detail::SpinBackoff backoff;
+        while (!op()) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false; // Timeout occurred
+            }
+            backoff.pause();
+        }
+        return true;
+    }
+
+    // Producer-owned cache line
+    alignas(cache_line_size) std::atomic<size_type> tail_{0}; ///< Next slot to write
+    size_type head_cache_ = 0;                                ///< Producer's last observed head
+
+    // Consumer-owned cache line
+    alignas(cache_line_size) std::atomic<size_type> head_{0}; ///< Next slot to read
+    size_type tail_cache_ = 0;                                ///< Consumer's last observed tail
+
+    // Read-only after construction
+    alignas(cache_line_size) const size_type capacity_;      ///< Number of slots (power of two)
+    const size_type mask_;                                    ///< capacity_ - 1, used to wrap indices
+    std::unique_ptr<Slot[]> slots_;                           ///< Element storage
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_SPSC_CIRCULAR_QUEUE_HPP
@@ -0,0 +1,168 @@
+#ifndef CXX_LAB_WAIT_POLICY_HPP
+#define CXX_LAB_WAIT_POLICY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <container/event_count.hpp>
+
+namespace cxx_lab {
+
+/**
+ * @brief A condition variable built on EventCount: spin briefly, then park on a futex.
+ *
+ * It has the interface of std::condition_variable_any and works with any lock (unique or
+ * shared), but unlike std::condition_variable_any in libstdc++ it neither allocates nor takes an
+ * internal mutex per wait: a wait is an atomic increment, a short spin on the epoch word and,
+ * only if nothing arrived during the spin, a futex wait (std::atomic::wait off Linux). A notify
+ * with no waiter costs a fence and a load.
+ *
+ * The spin length adapts: it doubles (up to MAX_SPINS) whenever a notification arrived while
+ * spinning and halves (down to MIN_SPINS) whenever the waiter had to park, so a condition that
+ * is signalled quickly stays off the futex, while one that is idle for long stops burning CPU.
+ * On a single CPU there is no spinning at all.
+ *
+ * As with std::condition_variable, callers must change the waited-for state while holding the
+ * lock the waiter passes to wait(); spurious wakeups are possible, so wait in a predicate loop.
+ */
+class AtomicCondition {
+public:
+    AtomicCondition() = default;
+    AtomicCondition(const AtomicCondition&) = delete;
+    AtomicCondition& operator=(const AtomicCondition&) = delete;
+
+    void notify_one() noexcept {
+        event_.notify_one();
+    }
+
+    void notify_all() noexcept {
+        event_.notify_all();
+    }
+
+    /**
+     * @brief Releases lock, waits for a notification (or a spurious wakeup), and reacquires lock.
+     */
+    template <typename Lock>
+    void wait(Lock& lock) {
+        // The epoch is read while the lock is held, so a notification for any state change made
+        // after the caller checked its predicate moves the epoch past key
+        const auto key = event_.prepare_wait();
+        lock.unlock();
+        if (spin(key)) {
+            event_.cancel_wait();
+        } else {
+            event_.wait(key);
+        }
+        lock.lock();
+    }
+
+    template <typename Lock, typename Predicate>
+    void wait(Lock& lock, Predicate predicate) {
+        while (!predicate()) {
+            wait(lock);
+        }
+    }
+
+    template <typename Lock, typename Clock, typename Duration>
+    std::cv_status wait_until(Lock& lock, const std::chrono::time_point<Clock, Duration>& deadline) {
+        const auto steady_deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(deadline - Clock::now());
+        const auto key = event_.prepare_wait();
+        lock.unlock();
+        bool notified = true;
+        if (spin(key)) {
+            event_.cancel_wait();
+        } else {
+            notified = event_.wait_until(key, steady_deadline);
+        }
+        lock.lock();
+        return notified ? std::cv_status::no_timeout : std::cv_status::timeout;
+    }
+
+    template <typename Lock, typename Clock, typename Duration, typename Predicate>
+    bool wait_until(Lock& lock, const std::chrono::time_point<Clock, Duration>& deadline, Predicate predicate) {
+        while (!predicate()) {
+            if (wait_until(lock, deadline) == std::cv_status::timeout) {
+                return predicate();
+            }
+        }
+        return true;
+    }
+
+    template <typename Lock, typename Rep, typename Period>
+    std::cv_status wait_for(Lock& lock, const std::chrono::duration<Rep, Period>& timeout) {
+        return wait_until(lock, std::chrono::steady_clock::now() + timeout);
+    }
+
+    template <typename Lock, typename Rep, typename Period, typename Predicate>
+    bool wait_for(Lock& lock, const std::chrono::duration<Rep, Period>& timeout, Predicate predicate) {
+        return wait_until(lock, std::chrono::steady_clock::now() + timeout, std::move(predicate));
+    }
+
+private:
+    static constexpr int MIN_SPINS = 16;   ///< Spin length after repeated parking
+    static constexpr int MAX_SPINS = 4096; ///< Spin length after repeated quick notifications
+
+    /**
+     * @brief Polls the epoch for the current spin length; adapts the length to the outcome.
+     *
+     * @return true if notified while spinning.
+     */
+    bool spin(EventCount::key_type key) {
+        // Spinning only helps when the notifier can make progress on another CPU
+        static const bool multi_core = std::thread::hardware_concurrency() > 1;
+        if (!multi_core) {
+            return false;
+        }
+        const int limit = spins_.load(std::memory_order_relaxed);
+        for (int i = 0; i < limit; ++i) {
+            if (event_.notified(key)) {
+                spins_.store(std::min(limit * 2, MAX_SPINS), std::memory_order_relaxed);
+                return true;
+            }
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#endif
+        }
+        spins_.store(std::max(limit / 2, MIN_SPINS), std::memory_order_relaxed);
+        return false;
+    }
+
+    EventCount event_;                  ///< Epoch and waiter count; parks on a futex
+    std::atomic<int> spins_{MIN_SPINS}; ///< Current adaptive spin length
+};
+
+/**
+ * @brief Waiting policy that blocks in the standard condition variables (the default).
+ *
+ * std::condition_variable for std::mutex, std::condition_variable_any for the timed and shared
+ * mutexes.
+ */
+struct ConditionVariableWait {
+    template <typename Mutex>
+    using condition_type = std::conditional_t<std::is_same_v<Mutex, std::mutex>, std::condition_variable,
+                                              std::condition_variable_any>;
+};
+
+/**
+ * @brief Waiting policy that blocks in AtomicCondition: adaptive spin, then futex.
+ *
+ * Select it through the Wait parameter of a container, e.g.
+ * `SafeDeque<int, std::deque<int>, NullContainerStats, AtomicWait>`.
+ */
+struct AtomicWait {
+    template <typename Mutex>
+    using condition_type = AtomicCondition;
+};
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_WAIT_POLICY_HPP
@@ -0,0 +1,409 @@
+#ifndef CXX_LAB_WORK_STEALING_POOL_HPP
+#define CXX_LAB_WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/execution.hpp>
+#include <boost/asio/execution_context.hpp>
+
+#include <container/cache_line.hpp>
+#include <container/chase_lev_deque.hpp>
+#include <container/event_count.hpp>
+
+namespace cxx_lab {
+
+namespace detail {
+
+/**
+ * @brief A type-erased task; complete() runs it (or just destroys it) and frees it.
+ */
+struct PoolTask {
+    void (*complete)(PoolTask* task, bool invoke);
+};
+
+template <typename F>
+struct PoolTaskImpl : PoolTask {
+    explicit PoolTaskImpl(F&& f) : PoolTask{&PoolTaskImpl::complete_impl}, function(std::move(f)) {}
+
+    static void complete_impl(PoolTask* task, bool invoke) {
+        std::unique_ptr<PoolTaskImpl> self(static_cast<PoolTaskImpl*>(task));
+        if (invoke) {
+            self->function();
+        }
+    }
+
+    F function;
+};
+
+} // namespace detail
+
+/**
+ * @brief A fixed-size thread pool with a work-stealing deque per worker.
+ *
+ * Work submitted from one of the pool's own threads goes to that worker's ChaseLevDeque, which
+ * the worker drains LIFO without contending with anybody; idle workers steal the oldest tasks
+ * from the others. Only work submitted from outside the pool passes through a shared (mutex
+ * protected) injection queue. This suits fork/join workloads, where tasks spawn subtasks, far
+ * better than one shared queue.
+ *
+ * Idle workers spin through a few steal rounds and then park on an EventCount, so submitting
+ * work costs a fence and a load unless a worker is actually parked.
+ *
+ * get_executor() returns an Asio standard executor (execute / query / require), so Asio
+ * algorithms can target the pool like an asio::thread_pool. join() also waits for the
+ * executors that track outstanding work, which Asio requests for pending timers and coroutines:
+ * @code
+ * cxx_lab::WorkStealingPool pool(4);
+ * asio::post(pool, [] { ... });
+ * asio::co_spawn(pool.get_executor(), coroutine(), asio::detached);
+ * pool.join();
+ * @endcode
+ *
+ * Tasks must not throw; as with std::thread, an escaping exception terminates the program.
+ */
+class WorkStealingPool : public boost::asio::execution_context {
+public:
+    class executor_type;
+
+    /**
+     * @brief Starts the pool's threads.
+     *
+     * @param threads The number of worker threads (default is the hardware concurrency).
+     * @throws std::invalid_argument if threads is zero.
+     */
+    explicit WorkStealingPool(std::size_t threads = default_thread_count()) {
+        if (threads == 0) {
+            throw std::invalid_argument("A pool needs at least one thread.");
+        }
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.push_back(std::make_unique<Worker>());
+        }
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_[i]->thread = std::thread([this, i]() { run(i); });
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Stops the threads and destroys the tasks that did not run.
+     */
+    ~WorkStealingPool() {
+        stop();
+        join_threads();
+        shutdown();
+        detail::PoolTask* task = nullptr;
+        for (auto& worker : workers_) {
+            while (worker->tasks.pop(task)) {
+                task->complete(task, false);
+            }
+        }
+        for (detail::PoolTask* injected : injected_) {
+            injected->complete(injected, false);
+        }
+        destroy();
+    }
+
+    /**
+     * @brief Returns an executor that submits work to this pool.
+     */
+    executor_type get_executor() noexcept;
+
+    /**
+     * @brief Submits a function object to run on one of the pool's threads.
+     *
+     * From a pool thread the task goes to that thread's own deque; otherwise to the injection queue.
+     *
+     * @param function A callable taking no arguments.
+     */
+    template <typename F>
+    void submit(F&& function) {
+        using Task = detail::PoolTaskImpl<std::decay_t<F>>;
+        detail::PoolTask* task = new Task(std::decay_t<F>(std::forward<F>(function)));
+        work_started();
+        if (current_pool_ == this) {
+            workers_[current_index_]->tasks.push(task);
+        } else {
+            std::lock_guard<std::mutex> lock(injected_mutex_);
+            injected_.push_back(task);
+            injected_size_.store(injected_.size(), std::memory_order_relaxed);
+        }
+        idle_.notify_one();
+    }
+
+    /**
+     * @brief Waits until all submitted work, including the work it submits, has run, then stops the threads.
+     *
+     * Work counts as pending while an executor with outstanding_work.tracked exists, as it does
+     * for asio::thread_pool. Must not be called from a pool thread.
+     */
+    void join() {
+        joining_.store(true, std::memory_order_seq_cst);
+        idle_.notify_all();
+        join_threads();
+    }
+
+    /**
+     * @brief Makes the threads exit as soon as their current task returns; pending tasks are not run.
+     */
+    void stop() {
+        stopped_.store(true, std::memory_order_seq_cst);
+        idle_.notify_all();
+    }
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    std::size_t size() const noexcept {
+        return workers_.size();
+    }
+
+    /**
+     * @brief Checks whether the calling thread is one of this pool's workers.
+     */
+    bool running_in_this_thread() const noexcept {
+        return current_pool_ == this;
+    }
+
+private:
+    static constexpr int STEAL_ROUNDS = 64; ///< Steal attempts over all victims before parking
+
+    static std::size_t default_thread_count() {
+        const unsigned n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+    struct alignas(cache_line_size) Worker {
+        ChaseLevDeque<detail::PoolTask*> tasks; ///< Owned by the worker, stolen from by the others
+        std::thread thread;
+    };
+
+    void run(std::size_t index) {
+        current_pool_ = this;
+        current_index_ = index;
+        std::uint64_t seed = 0x9E3779B97F4A7C15ull * (index + 1);
+        for (;;) {
+            detail::PoolTask* task = find_task(index, seed);
+            if (task == nullptr) {
+                auto key = idle_.prepare_wait();
+                task = find_task(index, seed);
+                if (task == nullptr) {
+                    if (done()) {
+                        idle_.cancel_wait();
+                        break;
+                    }
+                    idle_.wait(key);
+                    continue;
+                }
+                idle_.cancel_wait();
+            }
+            task->complete(task, true);
+            work_finished();
+        }
+        current_pool_ = nullptr;
+    }
+
+    void work_started() noexcept {
+        outstanding_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void work_finished() noexcept {
+        if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1 && joining_.load(std::memory_order_seq_cst)) {
+            idle_.notify_all(); // The last work is done: let the parked workers exit
+        }
+    }
+
+    bool done() const {
+        return stopped_.load(std::memory_order_seq_cst) ||
+               (joining_.load(std::memory_order_seq_cst) && outstanding_.load(std::memory_order_seq_cst) == 0);
+    }
+
+    /**
+     * @brief Finds work for worker index: its own deque, then the injection queue, then the others' deques.
+     */
+    detail::PoolTask* find_task(std::size_t index, std::uint64_t& seed) {
+        if (stopped_.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        detail::PoolTask* task = nullptr;
+        if (workers_[index]->tasks.pop(task)) {
+            return task;
+        }
+        for (int round = 0; round < STEAL_ROUNDS; ++round) {
+            if (injected_size_.load(std::memory_order_relaxed) > 0) {
+                std::lock_guard<std::mutex> lock(injected_mutex_);
+                if (!injected_.empty()) {
+                    task = injected_.front();
+                    injected_.pop_front();
+                    injected_size_.store(injected_.size(), std::memory_order_relaxed);
+                    return task;
+                }
+            }
+            // Start at a random victim so that thieves spread out
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            const std::size_t count = workers_.size();
+            const std::size_t first = static_cast<std::size_t>(seed % count);
+            bool any = false;
+            for (std::size_t i = 0; i < count; ++i) {
+                Worker& victim = *workers_[(first + i) % count];
+                if (&victim == workers_[index].get() || victim.tasks.empty()) {
+                    continue;
+                }
+                any = true;
+                if (victim.tasks.steal(task)) {
+                    return task;
+                }
+            }
+            if (!any && injected_size_.load(std::memory_order_relaxed) == 0) {
+                return nullptr; // Nothing visible anywhere: park instead of spinning
+            }
+            std::this_thread::yield();
+        }
+        return nullptr;
+    }
+
+    void join_threads() {
+        for (auto& worker : workers_) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers_;      ///< One deque and thread per worker
+    std::mutex injected_mutex_;                         ///< Protects injected_
+    std::deque<detail::PoolTask*> injected_;            ///< Tasks submitted from outside the pool
+    std::atomic<std::size_t> injected_size_{0};         ///< Lock-free emptiness hint for injected_
+    std::atomic<std::size_t> outstanding_{0};           ///< Tasks not yet completed plus tracking executors
+    std::atomic<bool> joining_{false};                  ///< join() was called
+    std::atomic<bool> stopped_{false};                  ///< stop() was called
+    EventCount idle_;                                   ///< Parks workers that found no work
+
+    static inline thread_local WorkStealingPool* current_pool_ = nullptr; ///< Pool of the calling worker thread
+    static inline thread_local std::size_t current_index_ = 0;            ///< Index of the calling worker thread
+};
+
+/**
+ * @brief Submits work to a WorkStealingPool; satisfies Asio's standard executor concept.
+ *
+ * execute() never blocks and never runs the function inline (blocking.never), and the executor
+ * converts to asio::any_io_executor, so it works with asio::post, asio::co_spawn, strands and
+ * timers' completion handlers. An executor with outstanding_work.tracked counts as pending work
+ * for join() until it is destroyed.
+ */
+class WorkStealingPool::executor_type {
+public:
+    executor_type(const executor_type& other) noexcept : pool_(other.pool_), tracked_(other.tracked_) {
+        if (tracked_) {
+            pool_->work_started();
+        }
+    }
+
+    executor_type(executor_type&& other) noexcept : pool_(other.pool_), tracked_(other.tracked_) {
+        other.tracked_ = false;
+    }
+
+    executor_type& operator=(const executor_type& other) noexcept {
+        if (this != &other) {
+            executor_type copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    executor_type& operator=(executor_type&& other) noexcept {
+        if (this != &other) {
+            release();
+            pool_ = other.pool_;
+            tracked_ = std::exchange(other.tracked_, false);
+        }
+        return *this;
+    }
+
+    ~executor_type() {
+        release();
+    }
+
+    template <typename F>
+    void execute(F&& function) const {
+        pool_->submit(std::forward<F>(function));
+    }
+
+    WorkStealingPool& query(boost::asio::execution::context_t) const noexcept {
+        return *pool_;
+    }
+
+    static constexpr boost::asio::execution::blocking_t query(boost::asio::execution::blocking_t) noexcept {
+        return boost::asio::execution::blocking.never;
+    }
+
+    executor_type require(boost::asio::execution::blocking_t::never_t) const noexcept {
+        return *this;
+    }
+
+    boost::asio::execution::outstanding_work_t query(boost::asio::execution::outstanding_work_t) const noexcept {
+        return tracked_ ? boost::asio::execution::outstanding_work_t(boost::asio::execution::outstanding_work.tracked)
+                        : boost::asio::execution::outstanding_work_t(boost::asio::execution::outstanding_work.untracked);
+    }
+
+    executor_type require(boost::asio::execution::outstanding_work_t::tracked_t) const noexcept {
+        return executor_type(*pool_, true);
+    }
+
+    executor_type require(boost::asio::execution::outstanding_work_t::untracked_t) const noexcept {
+        return executor_type(*pool_, false);
+    }
+
+    bool running_in_this_thread() const noexcept {
+        return pool_->running_in_this_thread();
+    }
+
+    friend bool operator==(const executor_type& a, const executor_type& b) noexcept {
+        return a.pool_ == b.pool_ && a.tracked_ == b.tracked_;
+    }
+
+    friend bool operator!=(const executor_type& a, const executor_type& b) noexcept {
+        return !(a == b);
+    }
+
+private:
+    friend class WorkStealingPool;
+
+    explicit executor_type(WorkStealingPool& pool, bool tracked = false) noexcept : pool_(&pool), tracked_(tracked) {
+        if (tracked_) {
+            pool_->work_started();
+        }
+    }
+
+    void release() noexcept {
+        if (tracked_) {
+            tracked_ = false;
+            pool_->work_finished();
+        }
+    }
+
+    WorkStealingPool* pool_;
+    bool tracked_ = false; ///< Whether this executor counts as outstanding work
+};
+
+inline WorkStealingPool::executor_type WorkStealingPool::get_executor() noexcept {
+    return executor_type(*this);
+}
+
+} // namespace cxx_lab
+
+#endif // CXX_LAB_WORK_STEALING_POOL_HPP
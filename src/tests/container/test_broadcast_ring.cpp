@@ -0,0 +1,112 @@
+// test_broadcast_ring.cpp
+
+#define BOOST_TEST_MODULE BroadcastRingTest
+#include <boost/test/included/unit_test.hpp>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <container/broadcast_ring.hpp>
+
+using namespace std::chrono_literals;
+
+BOOST_AUTO_TEST_SUITE(BroadcastRingSuite)
+
+// Test Case 1: Every reader sees every element, independently of the others
+BOOST_AUTO_TEST_CASE(ReadersHaveOwnCursors) {
+    BOOST_CHECK_THROW(cxx_lab::BroadcastRing<int>(0), std::invalid_argument);
+
+    cxx_lab::BroadcastRing<int> ring(8);
+    auto first = ring.subscribe();
+    auto second = ring.subscribe();
+
+    int item = 0;
+    BOOST_CHECK(!first.try_pop(item));
+    for (int i = 1; i <= 3; ++i) {
+        ring.push(i);
+    }
+    BOOST_CHECK_EQUAL(ring.sequence(), 3);
+    BOOST_CHECK_EQUAL(ring.size(), 3);
+    BOOST_CHECK_EQUAL(first.lag(), 3);
+
+    for (int expected = 1; expected <= 3; ++expected) {
+        BOOST_CHECK(first.try_pop(item));
+        BOOST_CHECK_EQUAL(item, expected);
+    }
+    BOOST_CHECK_EQUAL(first.lag(), 0);
+    BOOST_CHECK_EQUAL(second.lag(), 3);
+    BOOST_CHECK(second.try_pop(item));
+    BOOST_CHECK_EQUAL(item, 1);
+
+    // A late subscriber starts after the newest element, or at the oldest one
+    auto late = ring.subscribe();
+    BOOST_CHECK(!late.try_pop(item));
+    auto replay = ring.subscribe_from_oldest();
+    BOOST_CHECK_EQUAL(replay.position(), 0);
+    BOOST_CHECK_EQUAL(replay.lag(), 3);
+}
+
+// Test Case 2: A slow reader skips the overwritten elements and counts them
+BOOST_AUTO_TEST_CASE(SlowReaderSkipsAhead) {
+    cxx_lab::BroadcastRing<int> ring(4);
+    auto reader = ring.subscribe();
+    for (int i = 1; i <= 10; ++i) {
+        ring.push(i);
+    }
+    BOOST_CHECK_EQUAL(ring.size(), 4);
+    BOOST_CHECK_EQUAL(reader.lag(), 10);
+
+    int item = 0;
+    BOOST_CHECK(reader.try_pop(item));
+    BOOST_CHECK_EQUAL(item, 7);
+    BOOST_CHECK_EQUAL(reader.missed(), 6);
+    BOOST_CHECK_EQUAL(reader.lag(), 3);
+}
+
+// Test Case 3: try_read passes the element in place
+BOOST_AUTO_TEST_CASE(ReadInPlace) {
+    cxx_lab::BroadcastRing<std::string> ring(2);
+    auto reader = ring.subscribe();
+    ring.push(std::string("payload"));
+
+    const std::string* seen = nullptr;
+    BOOST_CHECK(reader.try_read([&](const std::string& value) { seen = &value; }));
+    auto other = ring.subscribe_from_oldest();
+    BOOST_CHECK(other.try_read([&](const std::string& value) { BOOST_CHECK_EQUAL(&value, seen); }));
+    BOOST_CHECK(!reader.read(10ms, [](const std::string&) {}));
+}
+
+// Test Case 4: Blocked readers all wake for each push
+BOOST_AUTO_TEST_CASE(ConcurrentReaders) {
+    constexpr int COUNT = 1000;
+    cxx_lab::BroadcastRing<int> ring(COUNT);
+
+    std::vector<long long> sums(3, 0);
+    std::vector<std::thread> readers;
+    for (std::size_t r = 0; r < sums.size(); ++r) {
+        readers.emplace_back([&, r, reader = ring.subscribe_from_oldest()]() mutable {
+            int item = 0;
+            for (int i = 0; i < COUNT; ++i) {
+                if (i % 2 == 0) {
+                    reader.pop(item);
+                } else if (!reader.pop(item, 5s)) {
+                    break; // Shows up as a wrong sum
+                }
+                sums[r] += item;
+            }
+        });
+    }
+    for (int i = 1; i <= COUNT; ++i) {
+        ring.push(i);
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    for (long long sum : sums) {
+        BOOST_CHECK_EQUAL(sum, COUNT * (COUNT + 1LL) / 2);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
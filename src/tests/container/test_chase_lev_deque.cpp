@@ -0,0 +1,99 @@
+// test_chase_lev_deque.cpp
+
+#define BOOST_TEST_MODULE ChaseLevDequeTest
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <container/chase_lev_deque.hpp>
+
+BOOST_AUTO_TEST_SUITE(ChaseLevDequeSuite)
+
+// Test Case 1: The owner pops LIFO, thieves steal FIFO
+BOOST_AUTO_TEST_CASE(OwnerLifoThiefFifo) {
+    cxx_lab::ChaseLevDeque<int> deque(4);
+    BOOST_CHECK_THROW(cxx_lab::ChaseLevDeque<int>(0), std::invalid_argument);
+
+    int value = 0;
+    BOOST_CHECK(!deque.pop(value));
+    BOOST_CHECK(!deque.steal(value));
+
+    for (int i = 1; i <= 4; ++i) {
+        deque.push(i);
+    }
+    BOOST_CHECK_EQUAL(deque.size(), 4);
+    BOOST_CHECK(deque.steal(value));
+    BOOST_CHECK_EQUAL(value, 1);
+    BOOST_CHECK(deque.pop(value));
+    BOOST_CHECK_EQUAL(value, 4);
+    BOOST_CHECK(deque.pop(value));
+    BOOST_CHECK_EQUAL(value, 3);
+    BOOST_CHECK(deque.steal(value));
+    BOOST_CHECK_EQUAL(value, 2);
+    BOOST_CHECK(deque.empty());
+}
+
+// Test Case 2: The ring grows and keeps the elements in order
+BOOST_AUTO_TEST_CASE(Growth) {
+    cxx_lab::ChaseLevDeque<int> deque(2);
+    for (int i = 0; i < 1000; ++i) {
+        deque.push(i);
+    }
+    BOOST_CHECK_GE(deque.capacity(), 1000);
+    int value = 0;
+    for (int i = 0; i < 500; ++i) {
+        BOOST_REQUIRE(deque.steal(value));
+        BOOST_REQUIRE_EQUAL(value, i);
+    }
+    for (int i = 999; i >= 500; --i) {
+        BOOST_REQUIRE(deque.pop(value));
+        BOOST_REQUIRE_EQUAL(value, i);
+    }
+    BOOST_CHECK(!deque.pop(value));
+}
+
+// Test Case 3: Every element is taken exactly once by the owner or one of the thieves
+BOOST_AUTO_TEST_CASE(ConcurrentStealing) {
+    constexpr int count = 200000;
+    constexpr int thieves = 3;
+    cxx_lab::ChaseLevDeque<std::intptr_t> deque(16);
+    std::vector<std::atomic<int>> taken(count);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t) {
+        threads.emplace_back([&]() {
+            std::intptr_t value = 0;
+            while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+                if (deque.steal(value)) {
+                    taken[value].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    std::intptr_t value = 0;
+    for (int i = 0; i < count; ++i) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.pop(value)) {
+            taken[value].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    while (deque.pop(value)) {
+        taken[value].fetch_add(1, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    int wrong = 0;
+    for (auto& slot : taken) {
+        wrong += slot.load() != 1;
+    }
+    BOOST_CHECK_EQUAL(wrong, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,196 @@
+// test_fixed_ring.cpp
+
+#define BOOST_TEST_MODULE FixedRingTest
+#include <boost/test/included/unit_test.hpp>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <container/fixed_ring.hpp>
+#include <container/safe_bounded_queue.hpp>
+
+namespace {
+
+// Counts the allocations of every container using it
+size_t allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>&) const { return true; }
+};
+
+struct Tracked {
+    static inline int alive = 0;
+
+    explicit Tracked(int v = 0) : value(v) { ++alive; }
+    Tracked(const Tracked& other) : value(other.value) { ++alive; }
+    ~Tracked() { --alive; }
+
+    int value;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FixedRingSuite)
+
+// Test Case 1: Push and pop at both ends across the wrap-around point
+BOOST_AUTO_TEST_CASE(WrapAround) {
+    cxx_lab::FixedRing<int> ring(3);
+    BOOST_CHECK(ring.empty());
+    BOOST_CHECK_EQUAL(ring.capacity(), 3);
+
+    ring.push_back(1);
+    ring.push_back(2);
+    ring.pop_front();
+    ring.push_back(3);
+    ring.push_back(4); // Wraps to slot 0
+    BOOST_CHECK(ring.full());
+    BOOST_CHECK_THROW(ring.push_back(5), std::length_error);
+
+    std::vector<int> contents(ring.begin(), ring.end());
+    BOOST_CHECK((contents == std::vector<int>{2, 3, 4}));
+    BOOST_CHECK_EQUAL(ring.at(2), 4);
+    BOOST_CHECK_THROW(ring.at(3), std::out_of_range);
+
+    ring.pop_back();
+    ring.pop_front();
+    ring.push_front(7);
+    BOOST_CHECK_EQUAL(ring.front(), 7);
+    BOOST_CHECK_EQUAL(ring.back(), 3);
+    BOOST_CHECK_EQUAL(ring.size(), 2);
+}
+
+// Test Case 2: erase(), resize() and set_capacity() keep the front elements
+BOOST_AUTO_TEST_CASE(EraseResizeAndSetCapacity) {
+    cxx_lab::FixedRing<std::string> ring(4);
+    for (const char* s : {"a", "b", "c", "d"}) {
+        ring.push_back(s);
+    }
+    ring.erase(ring.begin(), ring.begin() + 1); // Prefix: advances the head
+    ring.erase(ring.begin() + 1);               // Middle: shifts the tail
+    BOOST_CHECK((std::vector<std::string>(ring.begin(), ring.end()) == std::vector<std::string>{"b", "d"}));
+
+    ring.resize(3);
+    BOOST_CHECK_EQUAL(ring.back(), "");
+    BOOST_CHECK_THROW(ring.resize(5), std::length_error);
+
+    ring.set_capacity(8);
+    BOOST_CHECK_EQUAL(ring.capacity(), 8);
+    BOOST_CHECK_EQUAL(ring.front(), "b");
+
+    ring.set_capacity(1);
+    BOOST_CHECK_EQUAL(ring.size(), 1);
+    BOOST_CHECK_EQUAL(ring.front(), "b");
+}
+
+// Test Case 3: Elements are constructed and destroyed in place
+BOOST_AUTO_TEST_CASE(ElementLifetime) {
+    {
+        cxx_lab::FixedRing<Tracked> ring(4);
+        BOOST_CHECK_EQUAL(Tracked::alive, 0);
+        ring.emplace_back(1);
+        ring.emplace_front(2);
+        BOOST_CHECK_EQUAL(Tracked::alive, 2);
+        ring.pop_front();
+        BOOST_CHECK_EQUAL(Tracked::alive, 1);
+
+        cxx_lab::FixedRing<Tracked> copy = ring;
+        BOOST_CHECK_EQUAL(Tracked::alive, 2);
+        BOOST_CHECK_EQUAL(copy.front().value, 1);
+    }
+    BOOST_CHECK_EQUAL(Tracked::alive, 0);
+}
+
+// Test Case 4: Unlike std::deque, a FixedRing does not allocate once the queue is constructed
+BOOST_AUTO_TEST_CASE(QueueSteadyStateDoesNotAllocate) {
+    using Item = std::unique_ptr<int>;
+    cxx_lab::SafeBoundedQueue<Item, cxx_lab::FixedRing<Item, CountingAllocator<Item>>> ring_queue(64);
+    cxx_lab::SafeBoundedQueue<Item, std::deque<Item, CountingAllocator<Item>>> deque_queue(64);
+
+    auto breathe = [](auto& queue) {
+        std::vector<Item> items;
+        for (int i = 0; i < 64; ++i) {
+            items.push_back(std::make_unique<int>(i));
+        }
+        const size_t before = allocations;
+        for (int round = 0; round < 100; ++round) {
+            for (auto& item : items) {
+                queue.push_back(std::move(item));
+            }
+            for (auto& item : items) {
+                queue.pop_front(item);
+            }
+        }
+        BOOST_CHECK_EQUAL(*items.back(), 63);
+        return allocations - before;
+    };
+
+    BOOST_CHECK_EQUAL(breathe(ring_queue), 0);
+    BOOST_CHECK_GT(breathe(deque_queue), 0);
+}
+
+// Test Case 5: Queue capacity changes reallocate the ring and truncate it
+BOOST_AUTO_TEST_CASE(QueueSetCapacity) {
+    cxx_lab::SafeBoundedQueue<int, cxx_lab::FixedRing<int>> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        BOOST_CHECK(queue.try_push_back(i));
+    }
+    BOOST_CHECK(!queue.try_push_back(4));
+
+    queue.set_capacity(2);
+    BOOST_CHECK_EQUAL(queue.size(), 2);
+    queue.access([](cxx_lab::FixedRing<int>& ring) { BOOST_CHECK_EQUAL(ring.capacity(), 2); });
+
+    queue.set_capacity(3);
+    BOOST_CHECK(queue.try_push_back(9));
+    std::vector<int> drained;
+    queue.drain_into(drained);
+    BOOST_CHECK((drained == std::vector<int>{0, 1, 9}));
+}
+
+// Test Case 6: Concurrent producers and consumers through the ring
+BOOST_AUTO_TEST_CASE(QueueProducerConsumer) {
+    cxx_lab::SafeBoundedQueue<int, cxx_lab::FixedRing<int>> queue(8);
+    const int count = 10000;
+    long sum = 0;
+
+    std::thread producer([&]() {
+        for (int i = 1; i <= count; ++i) {
+            queue.push_back(i);
+        }
+    });
+    std::vector<int> batch;
+    int received = 0;
+    while (received < count) {
+        batch.clear();
+        received += static_cast<int>(queue.pop_front_bulk(std::back_inserter(batch), 4, std::chrono::milliseconds(1000)));
+        for (int value : batch) {
+            sum += value;
+        }
+    }
+    producer.join();
+
+    BOOST_CHECK_EQUAL(sum, static_cast<long>(count) * (count + 1) / 2);
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,83 @@
+// test_flat_map.cpp
+
+#define BOOST_TEST_MODULE FlatMapTest
+#include <boost/test/included/unit_test.hpp>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <container/flat_map.hpp>
+
+BOOST_AUTO_TEST_SUITE(FlatMapSuite)
+
+// Test Case 1: Single inserts, lookups and erasures behave like std::map
+BOOST_AUTO_TEST_CASE(MatchesStdMap) {
+    cxx_lab::FlatMap<int, int> flat;
+    std::map<int, int> reference;
+    std::mt19937 rng(3);
+    for (int i = 0; i < 5000; ++i) {
+        int key = static_cast<int>(rng() % 300);
+        switch (rng() % 4) {
+        case 0:
+            BOOST_REQUIRE_EQUAL(flat.erase(key), reference.erase(key));
+            break;
+        case 1:
+            flat.insert_or_assign(key, i);
+            reference.insert_or_assign(key, i);
+            break;
+        default:
+            BOOST_REQUIRE_EQUAL(flat.try_emplace(key, i).second, reference.try_emplace(key, i).second);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(flat.size(), reference.size());
+    auto expected = reference.begin();
+    for (auto [key, value] : flat) {
+        BOOST_REQUIRE_EQUAL(key, expected->first);
+        BOOST_REQUIRE_EQUAL(value, expected->second);
+        ++expected;
+    }
+}
+
+// Test Case 2: Element access through iterators, at() and operator[]
+BOOST_AUTO_TEST_CASE(ElementAccess) {
+    cxx_lab::FlatMap<std::string, int> flat{{"b", 2}, {"a", 1}};
+    BOOST_CHECK_EQUAL(flat.begin()->first, "a");
+
+    flat.find("b")->second = 20;
+    flat["c"] += 3;
+    BOOST_CHECK_EQUAL(flat.at("b"), 20);
+    BOOST_CHECK_EQUAL(flat.at("c"), 3);
+    BOOST_CHECK_THROW(flat.at("d"), std::out_of_range);
+
+    const auto& const_flat = flat;
+    BOOST_CHECK(const_flat.find("d") == const_flat.end());
+    BOOST_CHECK_EQUAL(const_flat.lower_bound("bb")->first, "c");
+    BOOST_CHECK_EQUAL(const_flat.end() - const_flat.begin(), 3);
+
+    auto next = flat.erase(flat.find("a"));
+    BOOST_CHECK_EQUAL(next->first, "b");
+    BOOST_CHECK((flat.keys() == std::vector<std::string>{"b", "c"}));
+    BOOST_CHECK((flat.values() == std::vector<int>{20, 3}));
+}
+
+// Test Case 3: Batched inserts keep existing keys and the first of repeated batch keys
+BOOST_AUTO_TEST_CASE(BatchedInsert) {
+    cxx_lab::FlatMap<int, std::string> flat{{5, "five"}, {1, "one"}};
+    std::vector<std::pair<int, std::string>> batch{{3, "three"}, {5, "FIVE"}, {3, "THREE"}, {0, "zero"}};
+    flat.insert(batch.begin(), batch.end());
+
+    BOOST_CHECK((flat.keys() == std::vector<int>{0, 1, 3, 5}));
+    BOOST_CHECK((flat.values() == std::vector<std::string>{"zero", "one", "three", "five"}));
+
+    std::vector<std::pair<int, std::string>> sorted{{2, "two"}, {9, "nine"}};
+    flat.insert(cxx_lab::sorted_unique, sorted.begin(), sorted.end());
+    BOOST_CHECK_EQUAL(flat.size(), 6);
+    BOOST_CHECK_EQUAL(flat.at(9), "nine");
+
+    BOOST_CHECK_THROW((cxx_lab::FlatMap<int, int>(cxx_lab::sorted_unique, {1, 2}, {1})), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+// test_flat_set.cpp
+
+#define BOOST_TEST_MODULE FlatSetTest
+#include <boost/test/included/unit_test.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <container/flat_set.hpp>
+
+namespace {
+
+// Compares the vectorized lower_bound with std::lower_bound on sorted vectors of every size
+// around the block boundaries, probing present keys, gaps and both ends
+template <typename Key>
+void check_lower_bound() {
+    std::mt19937_64 rng(7);
+    for (std::size_t size : {0, 1, 5, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 1000, 4097}) {
+        std::vector<Key> keys;
+        for (std::size_t i = 0; i < size; ++i) {
+            keys.push_back(static_cast<Key>(rng()));
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        std::vector<Key> probes{std::numeric_limits<Key>::min(), std::numeric_limits<Key>::max()};
+        for (Key key : keys) {
+            probes.push_back(key);
+            probes.push_back(static_cast<Key>(key + 1));
+            probes.push_back(static_cast<Key>(key - 1));
+        }
+        for (Key probe : probes) {
+            auto expected = std::lower_bound(keys.begin(), keys.end(), probe);
+            auto actual = cxx_lab::detail::flat_lower_bound(keys.begin(), keys.end(), probe, std::less<Key>());
+            BOOST_REQUIRE_EQUAL(actual - keys.begin(), expected - keys.begin());
+        }
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FlatSetSuite)
+
+// Test Case 1: The vectorized lower_bound agrees with std::lower_bound
+BOOST_AUTO_TEST_CASE(VectorizedLowerBound) {
+    check_lower_bound<std::int8_t>();
+    check_lower_bound<std::uint16_t>();
+    check_lower_bound<std::int32_t>();
+    check_lower_bound<std::uint32_t>();
+    check_lower_bound<std::int64_t>();
+    check_lower_bound<std::uint64_t>();
+}
+
+// Test Case 2: Single inserts and erasures behave like std::set
+BOOST_AUTO_TEST_CASE(MatchesStdSet) {
+    cxx_lab::FlatSet<int> flat;
+    std::set<int> reference;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 5000; ++i) {
+        int key = static_cast<int>(rng() % 500);
+        if (rng() % 3 == 0) {
+            BOOST_REQUIRE_EQUAL(flat.erase(key), reference.erase(key));
+        } else {
+            BOOST_REQUIRE_EQUAL(flat.insert(key).second, reference.insert(key).second);
+        }
+    }
+    BOOST_CHECK(std::equal(flat.begin(), flat.end(), reference.begin(), reference.end()));
+    BOOST_CHECK(flat.upper_bound(499) == flat.end());
+    BOOST_CHECK(flat.equal_range(-1).first == flat.begin());
+}
+
+// Test Case 3: Batched inserts sort, merge and drop duplicates
+BOOST_AUTO_TEST_CASE(BatchedInsert) {
+    cxx_lab::FlatSet<std::string> flat{"m", "c", "x", "c"};
+    BOOST_CHECK_EQUAL(flat.size(), 3);
+
+    std::vector<std::string> batch{"z", "a", "m", "d", "a"};
+    flat.insert(batch.begin(), batch.end());
+    BOOST_CHECK((flat.keys() == std::vector<std::string>{"a", "c", "d", "m", "x", "z"}));
+
+    std::vector<std::string> sorted{"b", "e"};
+    flat.insert(cxx_lab::sorted_unique, sorted.begin(), sorted.end());
+    BOOST_CHECK_EQUAL(flat.size(), 8);
+    BOOST_CHECK(std::is_sorted(flat.begin(), flat.end()));
+
+    auto keys = std::move(flat).extract();
+    BOOST_CHECK(flat.empty());
+    keys.pop_back();
+    flat.replace(std::move(keys));
+    BOOST_CHECK(!flat.contains("z"));
+    BOOST_CHECK(flat.contains("x"));
+}
+
+// Test Case 4: A custom order is honored (and bypasses the vectorized search)
+BOOST_AUTO_TEST_CASE(CustomCompare) {
+    cxx_lab::FlatSet<int, std::greater<int>> flat{1, 5, 3};
+    BOOST_CHECK_EQUAL(*flat.begin(), 5);
+    BOOST_CHECK(flat.contains(3));
+    BOOST_CHECK_EQUAL(*flat.lower_bound(4), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,183 @@
+// test_mpmc_bounded_queue.cpp
+
+#define BOOST_TEST_MODULE MpmcBoundedQueueTest
+#include <boost/test/included/unit_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <container/mpmc_bounded_queue.hpp>
+
+// An element whose copy or value construction can throw; moving it cannot
+struct ThrowingCopy {
+    static inline bool fail = false;
+
+    int value = 0;
+
+    explicit ThrowingCopy(int v) : value(v) {
+        if (fail) throw std::runtime_error("construction failed");
+    }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+        if (fail) throw std::runtime_error("copy failed");
+    }
+    ThrowingCopy(ThrowingCopy&&) noexcept = default;
+    ThrowingCopy& operator=(ThrowingCopy&&) noexcept = default;
+};
+
+BOOST_AUTO_TEST_SUITE(MpmcBoundedQueueSuite)
+
+BOOST_AUTO_TEST_CASE(TryPushBackTest) {
+    cxx_lab::MpmcBoundedQueue<int> queue(4);
+    BOOST_CHECK_EQUAL(queue.capacity(), 4);
+
+    BOOST_CHECK(queue.try_push_back(1));
+    BOOST_CHECK(queue.try_push_back(2));
+    BOOST_CHECK(queue.try_push_back(3));
+    BOOST_CHECK(queue.try_push_back(4));
+
+    // Queue should be full now
+    BOOST_CHECK(!queue.try_push_back(5));
+    BOOST_CHECK_EQUAL(queue.size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(TryPopFrontTest) {
+    cxx_lab::MpmcBoundedQueue<std::string> queue(8);
+    std::string value;
+    BOOST_CHECK(!queue.try_pop_front(value));
+
+    queue.push_back("alpha");
+    queue.push_back(std::string("beta"));
+
+    BOOST_CHECK(queue.try_pop_front(value));
+    BOOST_CHECK_EQUAL(value, "alpha");
+    BOOST_CHECK(queue.try_pop_front(value));
+    BOOST_CHECK_EQUAL(value, "beta");
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(TimeoutTest) {
+    cxx_lab::MpmcBoundedQueue<int> queue(2);
+    BOOST_CHECK(queue.push_back(10, std::chrono::milliseconds(100)));
+    BOOST_CHECK(queue.push_back(20, std::chrono::milliseconds(100)));
+
+    // Full: push with timeout should fail
+    BOOST_CHECK(!queue.push_back(30, std::chrono::milliseconds(50)));
+
+    int value;
+    BOOST_CHECK(queue.pop_front(value, std::chrono::milliseconds(100)));
+    BOOST_CHECK_EQUAL(value, 10);
+    BOOST_CHECK(queue.pop_front(value, std::chrono::milliseconds(100)));
+    BOOST_CHECK_EQUAL(value, 20);
+
+    // Empty: pop with timeout should fail
+    BOOST_CHECK(!queue.pop_front(value, std::chrono::milliseconds(50)));
+}
+
+BOOST_AUTO_TEST_CASE(BlockingWakeUpTest) {
+    cxx_lab::MpmcBoundedQueue<int> queue(1);
+    BOOST_CHECK_EQUAL(queue.capacity(), 2);
+
+    std::thread pusher([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        queue.push_back(500);
+        queue.push_back(600);
+        // Blocks until the consumer makes room
+        queue.push_back(700);
+    });
+
+    int value;
+    queue.pop_front(value);
+    BOOST_CHECK_EQUAL(value, 500);
+    queue.pop_front(value);
+    BOOST_CHECK_EQUAL(value, 600);
+    queue.pop_front(value);
+    BOOST_CHECK_EQUAL(value, 700);
+
+    pusher.join();
+}
+
+BOOST_AUTO_TEST_CASE(MoveOnlyElementsTest) {
+    auto tracker = std::make_shared<int>(1);
+    {
+        cxx_lab::MpmcBoundedQueue<std::unique_ptr<std::shared_ptr<int>>> queue(4);
+        BOOST_CHECK(queue.try_push_back(std::make_unique<std::shared_ptr<int>>(tracker)));
+        BOOST_CHECK(queue.try_emplace_back(new std::shared_ptr<int>(tracker)));
+        BOOST_CHECK_EQUAL(tracker.use_count(), 3);
+    }
+    // Remaining elements are destroyed with the queue
+    BOOST_CHECK_EQUAL(tracker.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentPushAndPopTest) {
+    cxx_lab::MpmcBoundedQueue<int> queue(64);
+    const int producers = 4;
+    const int consumers = 4;
+    const int per_producer = 20000;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p]() {
+            for (int i = 0; i < per_producer; ++i) {
+                queue.push_back(p * per_producer + i);
+            }
+        });
+    }
+
+    std::vector<std::vector<int>> popped(consumers);
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&queue, &popped, c]() {
+            int value;
+            for (int i = 0; i < per_producer * producers / consumers; ++i) {
+                queue.pop_front(value);
+                popped[c].push_back(value);
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    // Every element is delivered exactly once
+    std::vector<int> all;
+    for (auto& v : popped) {
+        all.insert(all.end(), v.begin(), v.end());
+    }
+    std::sort(all.begin(), all.end());
+    std::vector<int> expected(producers * per_producer);
+    std::iota(expected.begin(), expected.end(), 0);
+    BOOST_CHECK(all == expected);
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ThrowingConstructionTest) {
+    cxx_lab::MpmcBoundedQueue<ThrowingCopy> queue(2);
+    const ThrowingCopy first(1);
+
+    ThrowingCopy::fail = true;
+    BOOST_CHECK_THROW(queue.try_push_back(first), std::runtime_error);
+    BOOST_CHECK_THROW(queue.push_back(first), std::runtime_error);
+    BOOST_CHECK_THROW(queue.try_emplace_back(2), std::runtime_error);
+    ThrowingCopy::fail = false;
+
+    // No slot was claimed by the failed pushes, so the queue still works
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK(queue.try_push_back(first));
+    BOOST_CHECK(queue.try_emplace_back(2));
+    BOOST_CHECK(!queue.try_emplace_back(3));
+
+    ThrowingCopy popped(0);
+    BOOST_CHECK(queue.pop_front(popped, std::chrono::milliseconds(100)));
+    BOOST_CHECK_EQUAL(popped.value, 1);
+    BOOST_CHECK(queue.pop_front(popped, std::chrono::milliseconds(100)));
+    BOOST_CHECK_EQUAL(popped.value, 2);
+    BOOST_CHECK(!queue.try_pop_front(popped));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+// test_numa_queue.cpp
+
+#define BOOST_TEST_MODULE NumaQueueTest
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <container/numa_queue.hpp>
+
+using namespace std::chrono_literals;
+
+BOOST_AUTO_TEST_SUITE(NumaQueueSuite)
+
+// Test Case 1: Consumers take their own node's elements first, in order
+BOOST_AUTO_TEST_CASE(LocalFirst) {
+    BOOST_CHECK_THROW(cxx_lab::NumaQueue<int>(0), std::invalid_argument);
+
+    cxx_lab::NumaQueue<int> queue(8, cxx_lab::NumaTopology::simulated(2));
+    BOOST_CHECK_EQUAL(queue.node_count(), 2);
+    BOOST_CHECK(queue.empty());
+
+    queue.push_at(0, 1);
+    queue.push_at(1, 10);
+    queue.push_at(0, 2);
+    BOOST_CHECK_EQUAL(queue.size(), 3);
+    BOOST_CHECK_EQUAL(queue.node_queue(0).size(), 2);
+
+    int item = 0;
+    BOOST_CHECK(queue.try_pop_at(0, item));
+    BOOST_CHECK_EQUAL(item, 1);
+    BOOST_CHECK(queue.try_pop_at(0, item));
+    BOOST_CHECK_EQUAL(item, 2);
+    BOOST_CHECK_EQUAL(queue.stolen_count(0), 0);
+}
+
+// Test Case 2: An empty node steals from the nearest node that has work
+BOOST_AUTO_TEST_CASE(StealNearestFirst) {
+    cxx_lab::NumaTopology topology({{0}, {0}, {0}}, {});
+    cxx_lab::NumaQueue<int> queue(4, std::move(topology));
+
+    queue.push_at(2, 30);
+    queue.push_at(1, 20);
+    int item = 0;
+    BOOST_CHECK(queue.try_pop_at(0, item));
+    BOOST_CHECK_EQUAL(item, 20); // Equal distances: the lower node number is nearer
+    BOOST_CHECK(queue.pop_at(0, item, 10ms));
+    BOOST_CHECK_EQUAL(item, 30);
+    BOOST_CHECK_EQUAL(queue.stolen_count(0), 2);
+    BOOST_CHECK(!queue.try_pop_at(0, item));
+    BOOST_CHECK(!queue.pop_at(1, item, 10ms));
+}
+
+// Test Case 3: A full node spills to its neighbours before failing or blocking
+BOOST_AUTO_TEST_CASE(SpillWhenFull) {
+    cxx_lab::NumaQueue<std::unique_ptr<int>> queue(2, cxx_lab::NumaTopology::simulated(2));
+    for (int i = 0; i < 4; ++i) {
+        BOOST_CHECK(queue.try_push_at(0, std::make_unique<int>(i)));
+    }
+    BOOST_CHECK_EQUAL(queue.node_queue(1).size(), 2);
+
+    auto rejected = std::make_unique<int>(4);
+    BOOST_CHECK(!queue.try_push_at(0, std::move(rejected)));
+    BOOST_REQUIRE(rejected); // A failed push leaves the element with the caller
+
+    std::thread producer([&]() { queue.push_at(0, std::move(rejected)); });
+    std::unique_ptr<int> item;
+    std::this_thread::sleep_for(20ms);
+    queue.pop_at(0, item);
+    BOOST_CHECK_EQUAL(*item, 0);
+    producer.join();
+    BOOST_CHECK_EQUAL(queue.size(), 4);
+}
+
+// Test Case 4: Blocked consumers wake for a push on any node
+BOOST_AUTO_TEST_CASE(BlockedPopWakes) {
+    cxx_lab::NumaQueue<int> queue(4, cxx_lab::NumaTopology::simulated(2));
+    std::atomic<int> received{0};
+    std::thread consumer([&]() {
+        int item = 0;
+        queue.pop_at(0, item);
+        received = item;
+    });
+    std::this_thread::sleep_for(20ms);
+    queue.push_at(1, 7);
+    consumer.join();
+    BOOST_CHECK_EQUAL(received.load(), 7);
+}
+
+// Test Case 5: Producers and consumers on every node, no element lost or duplicated
+BOOST_AUTO_TEST_CASE(ConcurrentProducersConsumers) {
+    constexpr int NODES = 3;
+    constexpr int PER_PRODUCER = 5000;
+    cxx_lab::NumaQueue<int, cxx_lab::AtomicWait> queue(64, cxx_lab::NumaTopology::simulated(NODES));
+
+    std::atomic<long long> sum{0};
+    std::vector<std::thread> threads;
+    for (int node = 0; node < NODES; ++node) {
+        threads.emplace_back([&, node]() {
+            for (int i = 1; i <= PER_PRODUCER; ++i) {
+                queue.push_at(node, i);
+            }
+        });
+        threads.emplace_back([&, node]() {
+            int item = 0;
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                if (!queue.pop_at(node, item, 5s)) {
+                    break; // Shows up as a wrong sum
+                }
+                sum += item;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(sum.load(), NODES * (PER_PRODUCER * (PER_PRODUCER + 1LL) / 2));
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
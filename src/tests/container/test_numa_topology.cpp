@@ -0,0 +1,77 @@
+// test_numa_topology.cpp
+
+#define BOOST_TEST_MODULE NumaTopologyTest
+#include <boost/test/included/unit_test.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <container/fixed_ring.hpp>
+#include <container/numa_topology.hpp>
+
+BOOST_AUTO_TEST_SUITE(NumaTopologySuite)
+
+// Test Case 1: Kernel CPU lists are expanded, malformed parts skipped
+BOOST_AUTO_TEST_CASE(ParseCpuList) {
+    BOOST_CHECK(cxx_lab::detail::parse_cpu_list("").empty());
+    BOOST_CHECK(cxx_lab::detail::parse_cpu_list("0") == std::vector<int>({0}));
+    BOOST_CHECK(cxx_lab::detail::parse_cpu_list("0-3,8,10-11\n") == std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+    BOOST_CHECK(cxx_lab::detail::parse_cpu_list("x,2,4-,5") == std::vector<int>({2, 5}));
+}
+
+// Test Case 2: The detected topology covers the CPU the test runs on
+BOOST_AUTO_TEST_CASE(DetectCurrentMachine) {
+    const auto topology = cxx_lab::NumaTopology::detect();
+    BOOST_REQUIRE_GE(topology.node_count(), 1);
+    for (std::size_t node = 0; node < topology.node_count(); ++node) {
+        BOOST_CHECK(!topology.cpus(node).empty());
+        BOOST_CHECK_EQUAL(topology.distance(node, node), 10);
+    }
+    BOOST_CHECK_LT(topology.current_node(), topology.node_count());
+    BOOST_CHECK(topology.bind_current_thread(topology.current_node()));
+}
+
+// Test Case 3: Simulated and explicit topologies, distances and neighbour order
+BOOST_AUTO_TEST_CASE(SimulatedAndExplicit) {
+    BOOST_CHECK_THROW(cxx_lab::NumaTopology::simulated(0), std::invalid_argument);
+    BOOST_CHECK_THROW(cxx_lab::NumaTopology({}), std::invalid_argument);
+    BOOST_CHECK_THROW(cxx_lab::NumaTopology({{0}, {1}}, {0}), std::invalid_argument);
+
+    // More nodes than CPUs: every node still gets one, shared CPUs map to the first node
+    const std::size_t cpus = std::max(1u, std::thread::hardware_concurrency());
+    const auto simulated = cxx_lab::NumaTopology::simulated(cpus + 2);
+    BOOST_CHECK(simulated.is_simulated());
+    BOOST_CHECK_EQUAL(simulated.node_count(), cpus + 2);
+    BOOST_CHECK_EQUAL(simulated.os_node(0), -1);
+    BOOST_CHECK_EQUAL(simulated.cpus(cpus).front(), 0);
+    BOOST_CHECK_EQUAL(simulated.node_of_cpu(0), 0);
+
+    const cxx_lab::NumaTopology topology({{0, 1}, {2, 3}, {4, 5}}, {0, 1, 3});
+    BOOST_CHECK(!topology.is_simulated());
+    BOOST_CHECK_EQUAL(topology.os_node(2), 3);
+    BOOST_CHECK_EQUAL(topology.node_of_cpu(3), 1);
+    BOOST_CHECK_EQUAL(topology.node_of_cpu(99), 0);
+    BOOST_CHECK_EQUAL(topology.distance(0, 2), 20);
+    BOOST_CHECK(topology.neighbours(1) == std::vector<std::size_t>({0, 2}));
+}
+
+// Test Case 4: NodeLocalAllocator works as the slot allocator of a FixedRing
+BOOST_AUTO_TEST_CASE(NodeLocalAllocation) {
+    const auto topology = cxx_lab::NumaTopology::detect();
+    for (int os_node : {-1, topology.os_node(0)}) {
+        cxx_lab::NodeLocalAllocator<std::string> alloc(os_node);
+        BOOST_CHECK_EQUAL(alloc.os_node(), os_node);
+        BOOST_CHECK(cxx_lab::NodeLocalAllocator<int>(alloc) == cxx_lab::NodeLocalAllocator<int>(os_node));
+
+        cxx_lab::FixedRing<std::string, cxx_lab::NodeLocalAllocator<std::string>> ring(100, alloc);
+        for (int i = 0; i < 100; ++i) {
+            ring.push_back(std::to_string(i));
+        }
+        BOOST_CHECK_EQUAL(ring.front(), "0");
+        BOOST_CHECK_EQUAL(ring.back(), "99");
+        BOOST_CHECK_EQUAL(ring.get_allocator().os_node(), os_node);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
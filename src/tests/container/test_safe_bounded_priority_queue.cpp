@@ -0,0 +1,213 @@
+// test_safe_bounded_priority_queue.cpp
+
+#define BOOST_TEST_MODULE SafeBoundedPriorityQueueTest
+#include <boost/test/included/unit_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <container/safe_bounded_priority_queue.hpp>
+
+using namespace std::chrono_literals;
+
+BOOST_AUTO_TEST_SUITE(SafeBoundedPriorityQueueSuite)
+
+// Test Case 1: Pops come out in priority order for several arities
+template <std::size_t Arity>
+void check_heap_order() {
+    cxx_lab::SafeBoundedPriorityQueue<int, std::less<int>, Arity> queue(500);
+    std::vector<int> values(500);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    for (int value : values) {
+        BOOST_REQUIRE(queue.try_push(value));
+    }
+    BOOST_CHECK(!queue.try_push(1000));
+
+    for (int expected = 499; expected >= 0; --expected) {
+        int value = -1;
+        BOOST_REQUIRE(queue.try_pop(value));
+        BOOST_REQUIRE_EQUAL(value, expected);
+    }
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(PriorityOrder) {
+    check_heap_order<2>();
+    check_heap_order<3>();
+    check_heap_order<4>();
+    check_heap_order<8>();
+
+    cxx_lab::SafeBoundedPriorityQueue<std::string, std::greater<std::string>> queue(4);
+    queue.emplace(3, 'b');
+    queue.push(std::string("a"));
+    queue.push("c", 10ms);
+    std::string value;
+    queue.pop(value);
+    BOOST_CHECK_EQUAL(value, "a");
+    queue.pop(value);
+    BOOST_CHECK_EQUAL(value, "bbb");
+}
+
+// Test Case 2: Constructor and set_capacity() validation
+BOOST_AUTO_TEST_CASE(InvalidArguments) {
+    using IntQueue = cxx_lab::SafeBoundedPriorityQueue<int>;
+    BOOST_CHECK_THROW(IntQueue(0), std::invalid_argument);
+    BOOST_CHECK_THROW(IntQueue(4, cxx_lab::ExpiryPolicy::Drop), std::invalid_argument);
+
+    IntQueue queue(2);
+    BOOST_CHECK_THROW(queue.set_capacity(0), std::invalid_argument);
+}
+
+// Test Case 3: Timed operations give up when the queue stays full or empty
+BOOST_AUTO_TEST_CASE(Timeouts) {
+    cxx_lab::SafeBoundedPriorityQueue<int> queue(1);
+    int value = 0;
+    BOOST_CHECK(!queue.try_pop(value));
+    BOOST_CHECK(!queue.pop(value, 20ms));
+
+    BOOST_CHECK(queue.push(1, 20ms));
+    auto start = std::chrono::steady_clock::now();
+    BOOST_CHECK(!queue.push(2, 20ms));
+    BOOST_CHECK(std::chrono::steady_clock::now() - start >= 20ms);
+
+    queue.set_capacity(2);
+    BOOST_CHECK(queue.try_push(2));
+    queue.set_capacity(1); // Keeps both elements
+    BOOST_CHECK_EQUAL(queue.size(), 2);
+    BOOST_CHECK(!queue.try_push(3));
+    queue.clear();
+    BOOST_CHECK(queue.try_push(3));
+}
+
+// Test Case 4: A blocked push resumes once a pop frees room
+BOOST_AUTO_TEST_CASE(BlockingPushAndPop) {
+    cxx_lab::SafeBoundedPriorityQueue<int> queue(2);
+    queue.push(1);
+    queue.push(2);
+
+    std::thread producer([&]() { queue.push(10); });
+    std::this_thread::sleep_for(20ms);
+    int value = 0;
+    queue.pop(value);
+    BOOST_CHECK_EQUAL(value, 2);
+    producer.join();
+
+    queue.pop(value);
+    BOOST_CHECK_EQUAL(value, 10);
+    queue.pop(value);
+    BOOST_CHECK_EQUAL(value, 1);
+}
+
+// Test Case 5: Earliest deadline first, dropping expired elements
+BOOST_AUTO_TEST_CASE(EarliestDeadlineFirstDrop) {
+    using Task = cxx_lab::Deadlined<int>;
+    cxx_lab::SafeBoundedPriorityQueue<Task, cxx_lab::EarliestDeadlineFirst> queue(8, cxx_lab::ExpiryPolicy::Drop);
+    const auto now = std::chrono::steady_clock::now();
+    queue.push({1, now + 500ms});
+    queue.push({2, now - 1ms});
+    queue.push({3, now + 200ms});
+    queue.push({4, now - 2ms});
+
+    Task task;
+    BOOST_CHECK(queue.try_pop(task));
+    BOOST_CHECK_EQUAL(task.value, 3);
+    BOOST_CHECK(!task.expired);
+    BOOST_CHECK_EQUAL(queue.dropped_count(), 2);
+    BOOST_CHECK(queue.pop(task, 10ms));
+    BOOST_CHECK_EQUAL(task.value, 1);
+
+    // Only expired elements left: a blocking pop waits for a live one
+    queue.push({5, now - 1ms});
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(20ms);
+        queue.push({6, std::chrono::steady_clock::now() + 1s});
+    });
+    queue.pop(task);
+    BOOST_CHECK_EQUAL(task.value, 6);
+    BOOST_CHECK_EQUAL(queue.dropped_count(), 3);
+    producer.join();
+}
+
+// Test Case 6: Earliest deadline first, flagging expired elements
+BOOST_AUTO_TEST_CASE(EarliestDeadlineFirstFlag) {
+    using Task = cxx_lab::Deadlined<std::string>;
+    cxx_lab::SafeBoundedPriorityQueue<Task, cxx_lab::EarliestDeadlineFirst> queue(4, cxx_lab::ExpiryPolicy::Flag);
+    const auto now = std::chrono::steady_clock::now();
+    queue.push({"late", now - 1ms});
+    queue.push({"on time", now + 1s});
+
+    Task task;
+    queue.pop(task);
+    BOOST_CHECK_EQUAL(task.value, "late");
+    BOOST_CHECK(task.expired);
+    queue.pop(task);
+    BOOST_CHECK_EQUAL(task.value, "on time");
+    BOOST_CHECK(!task.expired);
+    BOOST_CHECK_EQUAL(queue.dropped_count(), 0);
+}
+
+// Test Case 7: Concurrent producers and consumers lose nothing
+BOOST_AUTO_TEST_CASE(ConcurrentProducersConsumers) {
+    cxx_lab::SafeBoundedPriorityQueue<int> queue(16);
+    const int producers = 4;
+    const int per_producer = 2000;
+    std::atomic<long> sum{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 1; i <= per_producer; ++i) {
+                queue.push(p * per_producer + i);
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            for (int i = 0; i < producers * per_producer / 2; ++i) {
+                queue.pop(value);
+                sum += value;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const long n = producers * per_producer;
+    BOOST_CHECK_EQUAL(sum.load(), n * (n + 1) / 2);
+    BOOST_CHECK(queue.empty());
+}
+
+// Test Case 8: An element with an expired member but no deadline still works under Keep
+struct Job {
+    int priority;
+    bool expired = false;
+
+    bool operator<(const Job& other) const {
+        return priority < other.priority;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(ExpiredFlagWithoutDeadline) {
+    cxx_lab::SafeBoundedPriorityQueue<Job> queue(4);
+    BOOST_CHECK(queue.try_push(Job{1}));
+    BOOST_CHECK(queue.try_push(Job{3}));
+
+    Job job{0};
+    BOOST_CHECK(queue.try_pop(job));
+    BOOST_CHECK_EQUAL(job.priority, 3);
+    BOOST_CHECK(!job.expired);
+
+    BOOST_CHECK_THROW(cxx_lab::SafeBoundedPriorityQueue<Job>(4, cxx_lab::ExpiryPolicy::Flag), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
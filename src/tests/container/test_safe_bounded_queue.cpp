@@ -8,6 +8,13 @@
 #include <vector>
 #include <thread>
 #include <chrono>
+#include <atomic>
+#include <type_traits>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_awaitable.hpp>
 
 #include <container/safe_bounded_queue.hpp>
 
@@ -323,6 +330,215 @@ BOOST_AUTO_TEST_CASE(ConcurrentPushAndPopTest) {
     BOOST_CHECK_EQUAL(consumer2_out.size(), 500);
 }
 
+BOOST_AUTO_TEST_CASE(BulkPushPopTest) {
+    cxx_lab::SafeBoundedQueue<int> queue(5);
+    std::vector<int> input = {1, 2, 3, 4};
+
+    // Whole range fits: one lock, one notification
+    BOOST_CHECK_EQUAL(queue.push_back_bulk(input.begin(), input.end()), 4);
+    BOOST_CHECK_EQUAL(queue.size(), 4);
+
+    std::vector<int> popped;
+    BOOST_CHECK_EQUAL(queue.pop_front_bulk(std::back_inserter(popped), 3, std::chrono::milliseconds(100)), 3);
+    BOOST_CHECK((popped == std::vector<int>{1, 2, 3}));
+
+    std::vector<int> drained;
+    BOOST_CHECK_EQUAL(queue.drain_into(drained), 1);
+    BOOST_CHECK_EQUAL(drained.at(0), 4);
+    BOOST_CHECK(queue.empty());
+
+    // Empty queue: bulk pop times out, drain returns nothing
+    BOOST_CHECK_EQUAL(queue.pop_front_bulk(std::back_inserter(popped), 3, std::chrono::milliseconds(50)), 0);
+    BOOST_CHECK_EQUAL(queue.drain_into(drained), 0);
+}
+
+BOOST_AUTO_TEST_CASE(BulkPushBlocksWhenFullTest) {
+    cxx_lab::SafeBoundedQueue<int> queue(4);
+    std::vector<int> input(10);
+    for (int i = 0; i < 10; ++i) {
+        input[i] = i;
+    }
+
+    // The range is larger than the capacity, so the producer waits for the consumer mid-range
+    std::thread producer([&]() {
+        BOOST_CHECK_EQUAL(queue.push_back_bulk(input.begin(), input.end()), 10);
+    });
+
+    std::vector<int> received;
+    while (received.size() < input.size()) {
+        queue.pop_front_bulk(std::back_inserter(received), 3, std::chrono::milliseconds(1000));
+    }
+    producer.join();
+
+    BOOST_CHECK(received == input);
+}
+
+BOOST_AUTO_TEST_CASE(MoveAndEmplaceTest) {
+    cxx_lab::SafeBoundedQueue<std::unique_ptr<cxx_lab::Item>> queue(3);
+
+    queue.push_back(std::make_unique<cxx_lab::Item>(1, "Moved"));
+    queue.emplace_back(new cxx_lab::Item(2, "Emplaced"));
+    queue.emplace_front(new cxx_lab::Item(0, "Emplaced Front"));
+
+    // Full: the rejected element must not be consumed
+    auto rejected = std::make_unique<cxx_lab::Item>(3, "Rejected");
+    BOOST_CHECK(!queue.try_push_back(std::move(rejected)));
+    BOOST_CHECK(!queue.push_back(std::move(rejected), std::chrono::milliseconds(10)));
+    BOOST_CHECK(rejected != nullptr);
+
+    std::unique_ptr<cxx_lab::Item> item;
+    queue.pop_front(item);
+    BOOST_CHECK_EQUAL(item->id, 0);
+    BOOST_CHECK(queue.try_pop_back(item));
+    BOOST_CHECK_EQUAL(item->name, "Emplaced");
+    BOOST_CHECK(queue.pop_front(item, std::chrono::milliseconds(10)));
+    BOOST_CHECK_EQUAL(item->name, "Moved");
+}
+
+BOOST_AUTO_TEST_CASE(AsyncPopAndPushTest) {
+    namespace asio = boost::asio;
+    cxx_lab::SafeBoundedQueue<int> queue(4);
+    asio::io_context ioc;
+    const int num_consumers = 2000;
+    std::atomic<long> sum{0};
+    std::atomic<int> received{0};
+
+    // Far more waiting consumers than threads running the io_context
+    for (int i = 0; i < num_consumers; ++i) {
+        asio::co_spawn(ioc, [&]() -> asio::awaitable<void> {
+            int value = co_await queue.async_pop_front(asio::use_awaitable);
+            sum += value;
+            ++received;
+        }, asio::detached);
+    }
+
+    // Half the elements come from a coroutine that has to wait for room, half from a thread
+    asio::co_spawn(ioc, [&]() -> asio::awaitable<void> {
+        for (int i = 1; i <= num_consumers / 2; ++i) {
+            co_await queue.async_push_back(i, asio::use_awaitable);
+        }
+    }, asio::detached);
+    std::thread producer([&]() {
+        for (int i = num_consumers / 2 + 1; i <= num_consumers; ++i) {
+            queue.push_back(i);
+        }
+    });
+
+    std::thread runner([&]() { ioc.run(); });
+    ioc.run();
+    runner.join();
+    producer.join();
+
+    BOOST_CHECK_EQUAL(received.load(), num_consumers);
+    BOOST_CHECK_EQUAL(sum.load(), static_cast<long>(num_consumers) * (num_consumers + 1) / 2);
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(AsyncPushWakesOnBlockingPopTest) {
+    namespace asio = boost::asio;
+    cxx_lab::SafeBoundedQueue<std::unique_ptr<int>> queue(1);
+    asio::io_context ioc;
+    bool pushed = false;
+
+    queue.push_back(std::make_unique<int>(1));
+    asio::co_spawn(ioc, [&]() -> asio::awaitable<void> {
+        co_await queue.async_push_back(std::make_unique<int>(2), asio::use_awaitable);
+        pushed = true;
+    }, asio::detached);
+
+    std::thread consumer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        std::unique_ptr<int> value;
+        queue.pop_front(value); // Frees the slot the coroutine is waiting for
+        BOOST_CHECK_EQUAL(*value, 1);
+    });
+    ioc.run();
+    consumer.join();
+
+    BOOST_CHECK(pushed);
+    std::unique_ptr<int> value;
+    BOOST_CHECK(queue.try_pop_front(value));
+    BOOST_CHECK_EQUAL(*value, 2);
+}
+
+BOOST_AUTO_TEST_CASE(StatsPolicyTest) {
+    static_assert(std::is_empty_v<cxx_lab::NullContainerStats>, "The default stats policy must add no storage");
+    BOOST_CHECK_EQUAL(cxx_lab::SafeBoundedQueue<int>(1).stats().snapshot().lock_acquisitions, 0);
+
+    cxx_lab::SafeBoundedQueue<int, std::deque<int>, cxx_lab::ContainerStats> queue(2);
+    int value = 0;
+    BOOST_CHECK(!queue.try_pop_front(value));
+    BOOST_CHECK(queue.try_push_back(1));
+    BOOST_CHECK(queue.try_push_back(2));
+    BOOST_CHECK(!queue.try_push_back(3));
+
+    auto snap = queue.stats().snapshot();
+    BOOST_CHECK_EQUAL(snap.try_empty, 1);
+    BOOST_CHECK_EQUAL(snap.try_full, 1);
+    BOOST_CHECK_EQUAL(snap.try_busy, 0);
+    BOOST_CHECK_EQUAL(snap.high_water, 2);
+    BOOST_CHECK_EQUAL(snap.notify_one, 2);
+    BOOST_CHECK_EQUAL(snap.lock_acquisitions, 4);
+
+    // Hold the lock in one thread so the other one fails fast, then waits
+    std::atomic<bool> locked{false};
+    std::thread holder([&]() {
+        queue.access([&](std::deque<int>&) {
+            locked = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        });
+    });
+    while (!locked) {
+        std::this_thread::yield();
+    }
+    BOOST_CHECK(!queue.try_pop_front(value));
+    BOOST_CHECK_EQUAL(queue.size(), 2);
+    holder.join();
+
+    snap = queue.stats().snapshot();
+    BOOST_CHECK_EQUAL(snap.try_busy, 1);
+    BOOST_CHECK(snap.lock_wait_percentile(1.0) >= std::chrono::milliseconds(1));
+
+    queue.stats().reset();
+    BOOST_CHECK_EQUAL(queue.stats().snapshot().lock_acquisitions, 0);
+    BOOST_CHECK_EQUAL(queue.stats().snapshot().high_water, 0);
+}
+
+BOOST_AUTO_TEST_CASE(AccessReturnsResultTest) {
+    cxx_lab::SafeBoundedQueue<int> queue(4);
+    queue.push_back(5);
+    int doubled = queue.access([](std::deque<int>& items) {
+        items.front() *= 2;
+        return items.front();
+    });
+    BOOST_CHECK_EQUAL(doubled, 10);
+    BOOST_CHECK(!queue.access_shared([](const std::deque<int>& items) { return items.empty(); }));
+}
+
+BOOST_AUTO_TEST_CASE(VisitInPlaceTest) {
+    cxx_lab::SafeBoundedQueue<std::string> queue(4);
+    queue.push_back("first");
+    queue.push_back("second");
+
+    const std::string* front = nullptr;
+    BOOST_CHECK(queue.visit_at(0, [&](const std::string& value) { front = &value; }));
+    queue.access([&](std::deque<std::string>& items) { BOOST_CHECK_EQUAL(front, &items.front()); });
+    std::size_t length = 0;
+    BOOST_CHECK(queue.visit_at(1, [&](const std::string& value) { length = value.size(); }));
+    BOOST_CHECK_EQUAL(length, 6);
+    BOOST_CHECK(!queue.visit_at(2, [](const std::string&) { BOOST_ERROR("visited out of bounds"); }));
+
+    std::string joined;
+    queue.for_each_locked([&](const std::string& value) { joined += value; });
+    BOOST_CHECK_EQUAL(joined, "firstsecond");
+
+    cxx_lab::SafeBoundedQueue<int, cxx_lab::FixedRing<int>> ring(2);
+    ring.push_back(7);
+    int seen = 0;
+    BOOST_CHECK(ring.visit_at(0, [&](const int& value) { seen = value; }));
+    BOOST_CHECK_EQUAL(seen, 7);
+}
+
 // ---------------------------
 // Test Cases for SafeBoundedQueue<std::shared_ptr<Item>>
 // ---------------------------
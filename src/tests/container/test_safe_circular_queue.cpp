@@ -300,4 +300,81 @@ BOOST_AUTO_TEST_CASE(AccessMethodModification) {
 
 // Additional test cases can be added here...
 
+// Test Case 9: Move-only elements, emplace and move-out pops
+BOOST_AUTO_TEST_CASE(MoveAndEmplace) {
+    cxx_lab::SafeCircularQueue<std::unique_ptr<std::string>> buffer(2);
+
+    buffer.push_back(std::make_unique<std::string>("moved"));
+    buffer.emplace_front(new std::string("emplaced"));
+    BOOST_CHECK(buffer.full());
+
+    // Full: the rejected element must not be consumed
+    auto rejected = std::make_unique<std::string>("rejected");
+    BOOST_CHECK(!buffer.try_push_back(std::move(rejected)));
+    BOOST_CHECK(rejected != nullptr);
+
+    std::unique_ptr<std::string> item;
+    buffer.pop_front(item);
+    BOOST_CHECK_EQUAL(*item, "emplaced");
+    BOOST_CHECK(buffer.try_pop_front(item));
+    BOOST_CHECK_EQUAL(*item, "moved");
+    BOOST_CHECK(buffer.empty());
+}
+
+// Test Case 10: Overwrite-oldest mode keeps the newest elements and counts the dropped ones
+BOOST_AUTO_TEST_CASE(OverwriteOldest) {
+    cxx_lab::SafeCircularQueue<int> rejecting(3);
+    BOOST_CHECK(rejecting.overflow_policy() == cxx_lab::OverflowPolicy::Reject);
+    cxx_lab::SafeCircularQueue<int> buffer(3, cxx_lab::OverflowPolicy::OverwriteOldest);
+    BOOST_CHECK(buffer.overflow_policy() == cxx_lab::OverflowPolicy::OverwriteOldest);
+
+    for (int i = 1; i <= 5; ++i) {
+        BOOST_CHECK(rejecting.try_push_back(i) == (i <= 3));
+        BOOST_CHECK(buffer.try_push_back(i));
+    }
+    BOOST_CHECK_EQUAL(rejecting.dropped_count(), 0);
+    BOOST_CHECK_EQUAL(buffer.dropped_count(), 2);
+
+    int item = 0;
+    for (int expected : {3, 4, 5}) {
+        BOOST_CHECK(buffer.try_pop_front(item));
+        BOOST_CHECK_EQUAL(item, expected);
+    }
+
+    // The blocking pushes overwrite in both modes, and are counted too
+    for (int i = 1; i <= 4; ++i) {
+        rejecting.push_back(i);
+    }
+    BOOST_CHECK_EQUAL(rejecting.dropped_count(), 4);
+    BOOST_CHECK(rejecting.try_pop_front(item));
+    BOOST_CHECK_EQUAL(item, 2);
+}
+
+// Test Case 11: visit_at and for_each_locked read elements in place
+BOOST_AUTO_TEST_CASE(VisitInPlace) {
+    cxx_lab::SafeCircularQueue<std::string> buffer(3);
+    buffer.push_back("a");
+    buffer.push_back("bb");
+
+    std::size_t length = 0;
+    BOOST_CHECK(buffer.visit_at(1, [&](const std::string& item) { length = item.size(); }));
+    BOOST_CHECK_EQUAL(length, 2);
+    BOOST_CHECK(!buffer.visit_at(2, [](const std::string&) { BOOST_ERROR("visited out of bounds"); }));
+
+    std::string joined;
+    buffer.for_each_locked([&](const std::string& item) { joined += item; });
+    BOOST_CHECK_EQUAL(joined, "abb");
+}
+
+// Test Case 12: The template access() and access_shared() return the callable's result
+BOOST_AUTO_TEST_CASE(AccessReturnsResult) {
+    cxx_lab::SafeCircularQueue<int> buffer(3);
+    bool full = buffer.access([](boost::circular_buffer<int>& items) {
+        items.assign(3, 9);
+        return items.full();
+    });
+    BOOST_CHECK(full);
+    BOOST_CHECK_EQUAL(buffer.access_shared([](const boost::circular_buffer<int>& items) { return items.back(); }), 9);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -9,6 +9,12 @@
 #include <algorithm>
 #include <mutex>
 #include <iostream>
+#include <atomic>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_awaitable.hpp>
 
 #include <container/safe_deque.hpp>
 
@@ -889,3 +895,158 @@ BOOST_FIXTURE_TEST_CASE(TestPopFirstPushLater, SafeDequeFixture) {
     consumer_thread.join();
     producer_thread.join();
 }
+
+/**
+ * @brief Test case 24: Test push_back_bulk(), pop_front_bulk() and drain_into().
+ */
+BOOST_FIXTURE_TEST_CASE(TestBulkOperations, SafeDequeFixture) {
+    SafeDeque<std::string> queue;
+    std::vector<std::string> input = {"a", "b", "c", "d", "e"};
+
+    // Push the whole range at once, moving the strings in
+    BOOST_CHECK_EQUAL(queue.push_back_bulk(std::make_move_iterator(input.begin()),
+                                           std::make_move_iterator(input.end())), 5);
+    BOOST_CHECK_EQUAL(queue.size(), 5);
+
+    // Pop at most three
+    std::vector<std::string> popped;
+    BOOST_CHECK_EQUAL(queue.pop_front_bulk(std::back_inserter(popped), 3, std::chrono::milliseconds(10)), 3);
+    std::vector<std::string> expected = {"a", "b", "c"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), expected.begin(), expected.end());
+
+    // Drain the rest
+    std::vector<std::string> drained;
+    BOOST_CHECK_EQUAL(queue.drain_into(drained), 2);
+    BOOST_CHECK_EQUAL(drained.front(), "d");
+    BOOST_CHECK_EQUAL(drained.back(), "e");
+    BOOST_CHECK(queue.empty());
+
+    // Nothing left: the bulk pop times out
+    BOOST_CHECK_EQUAL(queue.pop_front_bulk(std::back_inserter(popped), 3, std::chrono::milliseconds(10)), 0);
+}
+
+/**
+ * @brief Test case 25: Test move-only items, emplace_back()/emplace_front() and move-out pops.
+ */
+BOOST_FIXTURE_TEST_CASE(TestMoveAndEmplace, SafeDequeFixture) {
+    SafeDeque<std::unique_ptr<Task>> container;
+
+    container.push_back(std::make_unique<Task>(1, "Moved"));
+    BOOST_CHECK(container.try_push_front(std::make_unique<Task>(0, "Moved Front")));
+    container.emplace_back(new Task(2, "Emplaced"));
+    container.emplace_front(new Task(-1, "Emplaced Front"));
+    BOOST_CHECK_EQUAL(container.size(), 4);
+
+    std::unique_ptr<Task> task;
+    container.pop_front(task);
+    BOOST_CHECK_EQUAL(task->getId(), -1);
+    BOOST_CHECK(container.pop_back(task, std::chrono::milliseconds(10)));
+    BOOST_CHECK_EQUAL(task->getDescription(), "Emplaced");
+
+    // A failed timed push must leave the argument intact
+    std::string payload(64, 'x');
+    SafeDeque<std::string> strings;
+    BOOST_CHECK(strings.push_back(std::move(payload), std::chrono::milliseconds(10)));
+    BOOST_CHECK(payload.empty());
+    std::string out;
+    BOOST_CHECK(strings.try_pop_front(out));
+    BOOST_CHECK_EQUAL(out.size(), 64);
+}
+
+/**
+ * @brief Test case 26: Test async_pop_front() and async_push_back() from coroutines.
+ */
+BOOST_FIXTURE_TEST_CASE(TestAsyncOperations, SafeDequeFixture) {
+    namespace asio = boost::asio;
+    SafeDeque<int> queue;
+    asio::io_context ioc;
+    const int num_consumers = 1000;
+    std::atomic<long> sum{0};
+
+    for (int i = 0; i < num_consumers; ++i) {
+        asio::co_spawn(ioc, [&]() -> asio::awaitable<void> {
+            sum += co_await queue.async_pop_front(asio::use_awaitable);
+        }, asio::detached);
+    }
+    asio::co_spawn(ioc, [&]() -> asio::awaitable<void> {
+        for (int i = 1; i <= num_consumers / 2; ++i) {
+            co_await queue.async_push_back(i, asio::use_awaitable);
+        }
+    }, asio::detached);
+    std::thread producer([&]() {
+        std::vector<int> rest;
+        for (int i = num_consumers / 2 + 1; i <= num_consumers; ++i) {
+            rest.push_back(i);
+        }
+        queue.push_back_bulk(rest.begin(), rest.end());
+    });
+
+    ioc.run();
+    producer.join();
+
+    BOOST_CHECK_EQUAL(sum.load(), static_cast<long>(num_consumers) * (num_consumers + 1) / 2);
+    BOOST_CHECK(queue.empty());
+}
+
+/**
+ * @brief Test case 27: Test the ContainerStats policy (failures, notifications, high-water mark).
+ */
+BOOST_AUTO_TEST_CASE(TestStatsPolicy) {
+    SafeDeque<int, std::deque<int>, ContainerStats> queue;
+    int item = 0;
+    BOOST_CHECK(!queue.try_pop_front(item));
+    BOOST_CHECK(!queue.try_at(0, item));
+
+    std::vector<int> items = {1, 2, 3, 4};
+    queue.push_back_bulk(items.begin(), items.end());
+    queue.push_back(5);
+    BOOST_CHECK(queue.try_pop_back(item));
+
+    ContainerStatsSnapshot snap = queue.stats().snapshot();
+    BOOST_CHECK_EQUAL(snap.try_empty, 2);
+    BOOST_CHECK_EQUAL(snap.try_busy, 0);
+    BOOST_CHECK_EQUAL(snap.high_water, 5);
+    BOOST_CHECK_EQUAL(snap.notify_all, 1); // The bulk push
+    BOOST_CHECK_EQUAL(snap.notify_one, 2); // The single push and the pop
+    BOOST_CHECK_EQUAL(snap.lock_acquisitions, 5);
+    BOOST_CHECK_EQUAL(snap.lock_wait_percentile(0.99).count(), 0); // Nothing contended
+
+    queue.stats().reset();
+    BOOST_CHECK_EQUAL(queue.stats().snapshot().high_water, 0);
+}
+
+/**
+ * @brief Test case 28: Test visit_at and for_each_locked, which read items in place.
+ */
+BOOST_AUTO_TEST_CASE(TestVisitInPlace) {
+    SafeDeque<std::string> queue;
+    queue.push_back("first");
+    queue.push_back("second");
+
+    const std::string* back = nullptr;
+    BOOST_CHECK(queue.visit_at(1, [&](const std::string& item) { back = &item; }));
+    queue.access([&](const std::deque<std::string>& items) { BOOST_CHECK_EQUAL(back, &items.back()); });
+    BOOST_CHECK(!queue.visit_at(2, [](const std::string&) { BOOST_ERROR("visited out of bounds"); }));
+
+    std::size_t total = 0;
+    queue.for_each_locked([&](const std::string& item) { total += item.size(); });
+    BOOST_CHECK_EQUAL(total, 11);
+}
+
+/**
+ * @brief Test case 29: Test that the template access() and access_shared() return the callable's result.
+ */
+BOOST_AUTO_TEST_CASE(TestAccessReturnsResult) {
+    SafeDeque<int> queue;
+    std::size_t size = queue.access([](std::deque<int>& items) {
+        items.assign({3, 1, 2});
+        return items.size();
+    });
+    BOOST_CHECK_EQUAL(size, 3);
+
+    const auto& const_queue = queue;
+    int largest = const_queue.access_shared([](const std::deque<int>& items) {
+        return *std::max_element(items.begin(), items.end());
+    });
+    BOOST_CHECK_EQUAL(largest, 3);
+}
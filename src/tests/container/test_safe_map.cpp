@@ -1,10 +1,18 @@
 #define BOOST_TEST_MODULE SafeMapTest
 #include <boost/test/included/unit_test.hpp>
+#include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 #include <atomic>
 
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_awaitable.hpp>
+
+#include <container/flat_map.hpp>
 #include <container/safe_map.hpp>
 
 using namespace cxx_lab;
@@ -373,4 +381,220 @@ BOOST_AUTO_TEST_CASE(MultiThreaded_Retrievals) {
     BOOST_CHECK_EQUAL(successful_retrievals.load(), num_threads * num_elements);
 }
 
+// Test Case 14: Waiters on Distinct and Shared Keys
+BOOST_AUTO_TEST_CASE(Blocking_At_Per_Key_Waiters) {
+    SafeMap<int, std::string> safe_map;
+    const int num_keys = 50;
+    std::vector<std::thread> waiters;
+    std::atomic<int> satisfied{0};
+
+    // Two waiters per key, so one insertion has to wake several threads
+    for (int key = 0; key < num_keys; ++key) {
+        for (int copy = 0; copy < 2; ++copy) {
+            waiters.emplace_back([&, key]() {
+                std::string value;
+                if (safe_map.at(key, value, std::chrono::seconds(10)) && value == "Value_" + std::to_string(key)) {
+                    satisfied++;
+                }
+            });
+        }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // Insert in reverse order of registration
+    for (int key = num_keys - 1; key >= 0; --key) {
+        safe_map.insert({key, "Value_" + std::to_string(key)});
+    }
+    for (auto& th : waiters) {
+        th.join();
+    }
+    BOOST_CHECK_EQUAL(satisfied.load(), 2 * num_keys);
+
+    // A key added through access() also wakes its waiter
+    std::thread late_waiter([&]() {
+        BOOST_CHECK_EQUAL(safe_map.at(1000), "Thousand");
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    safe_map.access([](std::map<int, std::string>& map) { map[1000] = "Thousand"; });
+    late_waiter.join();
+
+    // Waiting for a key that never arrives times out
+    std::string value;
+    BOOST_CHECK(!safe_map.at(2000, value, std::chrono::milliseconds(20)));
+}
+
+// Test Case 15: Asynchronous Wait for Keys
+BOOST_AUTO_TEST_CASE(Async_At_Waits_For_Key) {
+    namespace asio = boost::asio;
+    SafeMap<int, std::string> safe_map;
+    safe_map.insert({0, "Value_0"});
+    asio::io_context ioc;
+    const int num_keys = 500;
+    std::atomic<int> satisfied{0};
+
+    // Key 0 is already present; the others arrive later from another thread
+    for (int key = 0; key < num_keys; ++key) {
+        asio::co_spawn(ioc, [&, key]() -> asio::awaitable<void> {
+            std::string value = co_await safe_map.async_at(key, asio::use_awaitable);
+            if (value == "Value_" + std::to_string(key)) {
+                satisfied++;
+            }
+        }, asio::detached);
+    }
+
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        for (int key = num_keys - 1; key > 1; --key) {
+            safe_map.insert({key, "Value_" + std::to_string(key)});
+        }
+        safe_map.access([](std::map<int, std::string>& map) { map[1] = "Value_1"; });
+    });
+
+    ioc.run();
+    producer.join();
+    BOOST_CHECK_EQUAL(satisfied.load(), num_keys);
+}
+
+// Test Case 16: In-Place Visiting Under a Shared Lock
+BOOST_AUTO_TEST_CASE(Visit_In_Place) {
+    SafeMap<int, std::string> safe_map;
+    safe_map.insert({1, "one"});
+    safe_map.insert({2, "two"});
+
+    const std::string* seen = nullptr;
+    BOOST_CHECK(safe_map.visit(1, [&](const std::string& value) { seen = &value; }));
+    BOOST_REQUIRE(seen != nullptr);
+    BOOST_CHECK_EQUAL(*seen, "one");
+    BOOST_CHECK(!safe_map.visit(3, [](const std::string&) { BOOST_ERROR("visited a missing key"); }));
+
+    // Visits share the lock, so a visit may run inside another one's functor on another thread
+    BOOST_CHECK(safe_map.visit(2, [&](const std::string&) {
+        std::thread nested([&]() { BOOST_CHECK(safe_map.visit(1, [](const std::string&) {})); });
+        nested.join();
+    }));
+
+    int key_sum = 0;
+    std::string values;
+    safe_map.for_each_locked([&](const auto& entry) {
+        key_sum += entry.first;
+        values += entry.second;
+    });
+    BOOST_CHECK_EQUAL(key_sum, 3);
+    BOOST_CHECK_EQUAL(values, "onetwo");
+}
+
+// Test Case 17: Template access() and access_shared() Return the Functor's Result
+BOOST_AUTO_TEST_CASE(Access_Returns_Result) {
+    SafeMap<int, std::string> safe_map;
+    std::thread waiter([&]() {
+        std::string value;
+        BOOST_CHECK(safe_map.at(7, value, std::chrono::milliseconds(5000)));
+        BOOST_CHECK_EQUAL(value, "seven");
+    });
+
+    bool inserted = safe_map.access([](std::map<int, std::string>& map) {
+        return map.insert({7, "seven"}).second;
+    });
+    BOOST_CHECK(inserted);
+    waiter.join();
+
+    std::size_t length = safe_map.access_shared([](const std::map<int, std::string>& map) {
+        return map.find(7)->second.size();
+    });
+    BOOST_CHECK_EQUAL(length, 5);
+}
+
+// Test Case 18: Many Waiters on Distinct Keys of a Hashed SafeMap
+BOOST_AUTO_TEST_CASE(Blocking_At_Many_Keys_Unordered) {
+    SafeMap<int, int, std::unordered_map<int, int>> safe_map;
+    const int num_keys = 100;
+    std::vector<std::thread> waiters;
+    std::atomic<int> satisfied{0};
+
+    // Each registration may rehash the waiter table while the earlier waiters are blocked
+    for (int key = 0; key < num_keys; ++key) {
+        waiters.emplace_back([&, key]() {
+            int value = 0;
+            if (safe_map.at(key, value, std::chrono::seconds(10)) && value == key * 10) {
+                satisfied++;
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    for (int key = 0; key < num_keys; ++key) {
+        safe_map.insert({key, key * 10});
+    }
+    for (auto& th : waiters) {
+        th.join();
+    }
+    BOOST_CHECK_EQUAL(satisfied.load(), num_keys);
+}
+
+// Test Case 19: FlatMap Backend: Insert, Lookup, Erase and Access
+BOOST_AUTO_TEST_CASE(FlatMap_Backend_Single_Threaded) {
+    using FlatSafeMap = SafeMap<int, std::string, FlatMap<int, std::string>>;
+    FlatSafeMap safe_map;
+
+    BOOST_CHECK(safe_map.insert({2, "Two"}));
+    BOOST_CHECK(!safe_map.insert({2, "Deux"}));
+    BOOST_CHECK(safe_map.emplace(1, "One"));
+    BOOST_CHECK(safe_map.insert({3, "Three"}, std::chrono::milliseconds(100)));
+
+    std::string value;
+    BOOST_CHECK(safe_map.try_at(2, value));
+    BOOST_CHECK_EQUAL(value, "Two");
+    BOOST_CHECK(safe_map.at(3, value, std::chrono::milliseconds(10)));
+    BOOST_CHECK_EQUAL(value, "Three");
+    BOOST_CHECK(safe_map.contains(1));
+    BOOST_CHECK_EQUAL(safe_map.count(4), 0);
+
+    safe_map.access([](FlatMap<int, std::string>& map) { map[1] = "One_Modified"; });
+    BOOST_CHECK(safe_map.visit(1, [](const std::string& one) { BOOST_CHECK_EQUAL(one, "One_Modified"); }));
+
+    // Keys come back in order from the sorted key vector
+    std::vector<int> keys;
+    safe_map.for_each_locked([&](const auto& entry) { keys.push_back(entry.first); });
+    BOOST_CHECK((keys == std::vector<int>{1, 2, 3}));
+
+    BOOST_CHECK(safe_map.erase(2));
+    BOOST_CHECK(!safe_map.contains(2));
+    BOOST_CHECK_EQUAL(safe_map.access_shared([](const FlatMap<int, std::string>& map) { return map.size(); }), 2);
+    safe_map.clear();
+    BOOST_CHECK(safe_map.empty());
+}
+
+// Test Case 20: FlatMap Backend: Concurrent Inserts Wake Waiters
+BOOST_AUTO_TEST_CASE(FlatMap_Backend_Multi_Threaded) {
+    SafeMap<int, std::string, FlatMap<int, std::string>> safe_map;
+    const int num_threads = 4;
+    const int items_per_thread = 50;
+    std::vector<std::thread> threads;
+    std::atomic<int> satisfied{0};
+
+    // Waiters copy the value out, since insertions move the values of a flat map
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::string value;
+            const int key = t * items_per_thread + items_per_thread - 1;
+            if (safe_map.at(key, value, std::chrono::seconds(10)) && value == "Value_" + std::to_string(key)) {
+                satisfied++;
+            }
+        });
+    }
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < items_per_thread; ++i) {
+                const int key = t * items_per_thread + i;
+                safe_map.insert({key, "Value_" + std::to_string(key)});
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    BOOST_CHECK_EQUAL(satisfied.load(), num_threads);
+    BOOST_CHECK_EQUAL(safe_map.size(), num_threads * items_per_thread);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
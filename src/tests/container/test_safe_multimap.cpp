@@ -4,6 +4,9 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <iterator>
+#include <memory_resource>
+#include <string>
 
 #include <container/safe_multimap.hpp>
 
@@ -436,4 +439,94 @@ BOOST_AUTO_TEST_CASE(MultiThreaded_Retrievals) {
     BOOST_CHECK_EQUAL(successful_retrievals.load(), num_elements);
 }
 
+// Test Case 14: Extract Many Keys Under One Lock
+BOOST_AUTO_TEST_CASE(ExtractMany) {
+    SafeMultiMap<int, std::string> safe_multimap;
+    for (int i = 0; i < 10; ++i) {
+        safe_multimap.insert({i % 5, "Value_" + std::to_string(i)});
+    }
+
+    std::vector<std::string> values;
+    std::vector<int> keys{1, 3, 3, 7};
+    size_t extracted = safe_multimap.extract_many(keys, [&](auto&& node) {
+        values.push_back(std::move(node.mapped()));
+    });
+    BOOST_CHECK_EQUAL(extracted, 4);
+    BOOST_CHECK((values == std::vector<std::string>{"Value_1", "Value_6", "Value_3", "Value_8"}));
+    BOOST_CHECK_EQUAL(safe_multimap.size(), 6);
+    BOOST_CHECK(!safe_multimap.contains(1));
+    BOOST_CHECK(!safe_multimap.contains(3));
+}
+
+// Test Case 15: Extract a Key Range as Node Handles and Reinsert Them
+BOOST_AUTO_TEST_CASE(ExtractRangeAndReinsertNodes) {
+    using Map = SafeMultiMap<int, std::string>;
+    Map safe_multimap;
+    for (int i = 0; i < 10; ++i) {
+        safe_multimap.insert({i, "Value_" + std::to_string(i)});
+    }
+
+    std::vector<Map::node_type> nodes;
+    nodes.reserve(16);
+    BOOST_CHECK_EQUAL(safe_multimap.extract_range(2, 5, std::back_inserter(nodes)), 3);
+    BOOST_CHECK_EQUAL(nodes.size(), 3);
+    BOOST_CHECK_EQUAL(nodes.front().key(), 2);
+    BOOST_CHECK_EQUAL(nodes.back().mapped(), "Value_4");
+    BOOST_CHECK_EQUAL(safe_multimap.size(), 7);
+    BOOST_CHECK_EQUAL(safe_multimap.extract_range(20, 30, std::back_inserter(nodes)), 0);
+
+    // Re-key the node and put it back without reallocating it
+    const std::string* address = &nodes.front().mapped();
+    nodes.front().key() = 42;
+    BOOST_CHECK(safe_multimap.insert(std::move(nodes.front())));
+    BOOST_CHECK(!safe_multimap.insert(std::move(nodes.front()))); // Now empty
+    safe_multimap.access([&](std::multimap<int, std::string>& container) {
+        BOOST_CHECK_EQUAL(&container.find(42)->second, address);
+    });
+}
+
+// Test Case 16: Nodes Allocated From a Caller-Provided Arena
+BOOST_AUTO_TEST_CASE(CallerProvidedArena) {
+    using Map = SafeMultiMap<int, int, std::pmr::multimap<int, int>>;
+    std::pmr::unsynchronized_pool_resource arena;
+    Map safe_multimap{Map::allocator_type(&arena)};
+
+    for (int i = 0; i < 100; ++i) {
+        safe_multimap.emplace(i % 10, i);
+    }
+    std::vector<Map::node_type> nodes;
+    safe_multimap.extract_range(0, 10, std::back_inserter(nodes));
+    BOOST_CHECK_EQUAL(nodes.size(), 100);
+    BOOST_CHECK(nodes.front().get_allocator().resource() == &arena);
+    BOOST_CHECK(safe_multimap.empty());
+}
+
+// Test Case 17: Template access() Returns the Functor's Result
+BOOST_AUTO_TEST_CASE(AccessReturnsResult) {
+    SafeMultiMap<int, int> safe_multimap;
+    std::size_t inserted = safe_multimap.access([](std::multimap<int, int>& map) {
+        map.emplace(1, 10);
+        map.emplace(1, 11);
+        return map.size();
+    });
+    BOOST_CHECK_EQUAL(inserted, 2);
+    BOOST_CHECK_EQUAL(safe_multimap.access_shared([](const std::multimap<int, int>& map) { return map.count(1); }), 2);
+}
+
+// Test Case 18: Extract an Empty or Reversed Key Range
+BOOST_AUTO_TEST_CASE(ExtractEmptyOrReversedRange) {
+    using Map = SafeMultiMap<int, int>;
+    Map safe_multimap;
+    for (int i = 0; i < 10; ++i) {
+        safe_multimap.emplace(i, i);
+    }
+
+    std::vector<Map::node_type> nodes;
+    BOOST_CHECK_EQUAL(safe_multimap.extract_range(4, 4, std::back_inserter(nodes)), 0);
+    BOOST_CHECK_EQUAL(safe_multimap.extract_range(7, 2, std::back_inserter(nodes)), 0);
+    BOOST_CHECK_EQUAL(safe_multimap.extract_range(9, 0, std::back_inserter(nodes)), 0);
+    BOOST_CHECK(nodes.empty());
+    BOOST_CHECK_EQUAL(safe_multimap.size(), 10);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,7 @@
 #include <thread>
 #include <chrono>
 
+#include <container/flat_set.hpp>
 #include <container/safe_set.hpp>
 
 using namespace cxx_lab;
@@ -116,6 +117,24 @@ BOOST_AUTO_TEST_CASE(AccessFunctionTest) {
     });
 }
 
+BOOST_AUTO_TEST_CASE(AccessReturnsResultTest) {
+    SafeSet<int> safe_set;
+    std::thread waiter([&]() { BOOST_CHECK(safe_set.extract(20, std::chrono::milliseconds(5000))); });
+
+    // A batch mutation through the template access() wakes the waiter, like the std::function one
+    std::size_t size = safe_set.access([](auto& container) {
+        for (int i = 16; i <= 20; ++i) {
+            container.insert(i);
+        }
+        return container.size();
+    });
+    BOOST_CHECK_EQUAL(size, 5);
+    waiter.join();
+
+    BOOST_CHECK(safe_set.access_shared([](const auto& container) { return container.count(16) == 1; }));
+    BOOST_CHECK_EQUAL(safe_set.access_shared([](const auto& container) { return container.size(); }), 4);
+}
+
 BOOST_AUTO_TEST_CASE(ClearTest) {
     SafeSet<int> safe_set;
     safe_set.insert(16);
@@ -262,4 +281,42 @@ BOOST_AUTO_TEST_CASE(TryEmplaceWithSharedPtrTest) {
     BOOST_CHECK_EQUAL(safe_set.size(), 3);
 }
 
+BOOST_AUTO_TEST_CASE(FlatBackendTest) {
+    SafeSet<int, FlatSet<int>> safe_set;
+
+    BOOST_CHECK(safe_set.try_insert(3));
+    BOOST_CHECK(safe_set.try_emplace(1));
+    BOOST_CHECK(!safe_set.try_insert(3));
+    BOOST_CHECK(safe_set.insert(2, std::chrono::milliseconds(100)));
+    BOOST_CHECK_EQUAL(safe_set.size(), 3);
+    BOOST_CHECK(safe_set.contains(2));
+    BOOST_CHECK_EQUAL(safe_set.count(4), 0);
+
+    // Keys are kept sorted in one vector
+    std::vector<int> keys;
+    safe_set.access([&](const FlatSet<int>& container) { keys.assign(container.begin(), container.end()); });
+    BOOST_CHECK((keys == std::vector<int>{1, 2, 3}));
+
+    BOOST_CHECK(safe_set.erase(2));
+    BOOST_CHECK(!safe_set.contains(2));
+    safe_set.clear();
+    BOOST_CHECK(safe_set.empty());
+}
+
+BOOST_AUTO_TEST_CASE(FlatBackendConcurrentTest) {
+    SafeSet<int, FlatSet<int>> safe_set;
+    std::thread waiter([&]() { BOOST_CHECK(safe_set.extract(49, std::chrono::milliseconds(5000))); });
+
+    std::thread t1([&]() { for (int i = 30; i <= 39; ++i) safe_set.insert(i); });
+    std::thread t2([&]() { for (int i = 35; i <= 44; ++i) safe_set.insert(i); }); // Overlapping range
+    std::thread t3([&]() { for (int i = 40; i <= 49; ++i) safe_set.insert(i); });
+    t1.join();
+    t2.join();
+    t3.join();
+    waiter.join();
+
+    BOOST_CHECK_EQUAL(safe_set.size(), 19); // 30 to 48; 49 was extracted
+    BOOST_CHECK(!safe_set.contains(49));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
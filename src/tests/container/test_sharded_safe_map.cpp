@@ -0,0 +1,163 @@
+// test_sharded_safe_map.cpp
+
+#define BOOST_TEST_MODULE ShardedSafeMapTest
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <container/sharded_safe_map.hpp>
+
+using namespace cxx_lab;
+
+BOOST_AUTO_TEST_SUITE(ShardedSafeMapSuite)
+
+BOOST_AUTO_TEST_CASE(InsertEmplaceAndLookupTest) {
+    ShardedSafeMap<int, std::string> map;
+    BOOST_CHECK(map.empty());
+
+    BOOST_CHECK(map.insert({1, "One"}));
+    BOOST_CHECK(map.try_insert({2, "Two"}));
+    BOOST_CHECK(map.emplace(3, "Three"));
+    BOOST_CHECK(map.try_emplace(4, "Four"));
+    BOOST_CHECK(map.insert({5, "Five"}, std::chrono::milliseconds(100)));
+
+    // Duplicate keys are rejected and keep the original value
+    BOOST_CHECK(!map.insert({1, "Un"}));
+    BOOST_CHECK(!map.emplace(3, "Trois"));
+
+    std::string value;
+    BOOST_CHECK(map.try_at(1, value));
+    BOOST_CHECK_EQUAL(value, "One");
+    BOOST_CHECK(map.at(3, value, std::chrono::milliseconds(100)));
+    BOOST_CHECK_EQUAL(value, "Three");
+    BOOST_CHECK_EQUAL(map.at(4), "Four");
+    BOOST_CHECK(!map.try_at(42, value));
+
+    BOOST_CHECK_EQUAL(map.size(), 5);
+    BOOST_CHECK(map.contains(2));
+    BOOST_CHECK_EQUAL(map.count(5), 1);
+    BOOST_CHECK_EQUAL(map.count(6), 0);
+}
+
+BOOST_AUTO_TEST_CASE(EraseAndClearTest) {
+    ShardedSafeMap<int, int, std::hash<int>, 4> map;
+    for (int i = 0; i < 100; ++i) {
+        BOOST_CHECK(map.insert({i, i * 10}));
+    }
+    BOOST_CHECK_EQUAL(map.size(), 100);
+
+    for (int i = 0; i < 100; i += 2) {
+        BOOST_CHECK_EQUAL(map.erase(i), 1);
+    }
+    BOOST_CHECK_EQUAL(map.erase(0), 0);
+    BOOST_CHECK_EQUAL(map.size(), 50);
+
+    // Entries shifted back by erasure must still be found
+    int value;
+    for (int i = 1; i < 100; i += 2) {
+        BOOST_CHECK(map.try_at(i, value));
+        BOOST_CHECK_EQUAL(value, i * 10);
+    }
+
+    map.clear();
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(!map.contains(1));
+}
+
+BOOST_AUTO_TEST_CASE(MatchesStdMapUnderRandomOperationsTest) {
+    // A single shard with a poor hash forces long probe sequences and many backward shifts
+    struct PoorHash {
+        std::size_t operator()(int key) const { return static_cast<std::size_t>(key % 7); }
+    };
+    ShardedSafeMap<int, int, PoorHash, 1> map;
+    std::map<int, int> reference;
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> key_dist(0, 500);
+    for (int i = 0; i < 20000; ++i) {
+        int key = key_dist(rng);
+        if (rng() % 3 == 0) {
+            BOOST_REQUIRE_EQUAL(map.erase(key), reference.erase(key));
+        } else {
+            BOOST_REQUIRE_EQUAL(map.insert({key, i}), reference.insert({key, i}).second);
+        }
+    }
+
+    BOOST_CHECK_EQUAL(map.size(), reference.size());
+    int value;
+    for (int key = 0; key <= 500; ++key) {
+        auto it = reference.find(key);
+        BOOST_REQUIRE_EQUAL(map.try_at(key, value), it != reference.end());
+        if (it != reference.end()) {
+            BOOST_CHECK_EQUAL(value, it->second);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ElementLifetimeTest) {
+    auto tracker = std::make_shared<int>(7);
+    {
+        ShardedSafeMap<int, std::shared_ptr<int>> map;
+        for (int i = 0; i < 64; ++i) {
+            map.emplace(i, tracker); // Grows the shards several times
+        }
+        BOOST_CHECK_EQUAL(tracker.use_count(), 65);
+        map.erase(0);
+        BOOST_CHECK_EQUAL(tracker.use_count(), 64);
+    }
+    // Remaining elements are destroyed with the map
+    BOOST_CHECK_EQUAL(tracker.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(BlockingAtWakesOnInsertTest) {
+    ShardedSafeMap<int, std::string, std::hash<int>, 1> map;
+
+    std::thread producer([&map]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        map.insert({1, "other key in the same shard"});
+        map.insert({2, "Two"});
+    });
+
+    // Waiters for one key are not lost when another key of the shard is inserted first
+    BOOST_CHECK_EQUAL(map.at(2), "Two");
+
+    std::string value;
+    BOOST_CHECK(!map.at(3, value, std::chrono::milliseconds(50)));
+    producer.join();
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentInsertEraseTest) {
+    ShardedSafeMap<int, int> map;
+    const int num_threads = 8;
+    const int per_thread = 5000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&map, t]() {
+            for (int i = 0; i < per_thread; ++i) {
+                const int key = t * per_thread + i;
+                map.insert({key, key});
+                if (i % 2 == 1) {
+                    map.erase(key);
+                }
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    BOOST_CHECK_EQUAL(map.size(), num_threads * per_thread / 2);
+    int value;
+    for (int key = 0; key < num_threads * per_thread; ++key) {
+        BOOST_REQUIRE_EQUAL(map.try_at(key, value), key % 2 == 0);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,140 @@
+// test_snapshot_map.cpp
+
+#define BOOST_TEST_MODULE SnapshotMapTest
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <container/snapshot_map.hpp>
+
+using namespace cxx_lab;
+
+BOOST_AUTO_TEST_SUITE(SnapshotMapSuite)
+
+BOOST_AUTO_TEST_CASE(LookupApiTest) {
+    SnapshotMap<int, std::string> map;
+    BOOST_CHECK(map.empty());
+
+    BOOST_CHECK(map.insert({1, "One"}));
+    BOOST_CHECK(map.emplace(2, "Two"));
+    BOOST_CHECK(!map.insert({1, "Un"}));
+
+    std::string value;
+    BOOST_CHECK(map.try_at(1, value));
+    BOOST_CHECK_EQUAL(value, "One");
+    BOOST_CHECK(map.at(2, value, std::chrono::milliseconds(10)));
+    BOOST_CHECK_EQUAL(value, "Two");
+    BOOST_CHECK_EQUAL(map.at(1), "One");
+    BOOST_CHECK(!map.try_at(3, value));
+    BOOST_CHECK(!map.at(3, value, std::chrono::milliseconds(50)));
+
+    BOOST_CHECK(map.contains(2));
+    BOOST_CHECK_EQUAL(map.count(2), 1);
+    BOOST_CHECK_EQUAL(map.size(), 2);
+
+    BOOST_CHECK_EQUAL(map.erase(1), 1);
+    BOOST_CHECK(!map.contains(1));
+    map.clear();
+    BOOST_CHECK(map.empty());
+}
+
+BOOST_AUTO_TEST_CASE(BatchedUpdateTest) {
+    SnapshotMap<std::string, int, std::unordered_map<std::string, int>> map(
+        std::unordered_map<std::string, int>{{"timeout_ms", 100}});
+
+    auto replaced = map.update([](auto& next) {
+        next["timeout_ms"] = 250;
+        next["retries"] = 3;
+        return next.size();
+    });
+    BOOST_CHECK_EQUAL(replaced, 2);
+
+    // A reader sees one version: both keys or neither
+    map.read([](const auto& snapshot) {
+        BOOST_CHECK_EQUAL(snapshot.at("timeout_ms"), 250);
+        BOOST_CHECK_EQUAL(snapshot.at("retries"), 3);
+    });
+
+    // A throwing update publishes nothing
+    BOOST_CHECK_THROW(map.update([](auto& next) {
+        next.clear();
+        throw std::runtime_error("abort");
+    }), std::runtime_error);
+    BOOST_CHECK_EQUAL(map.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(BlockingAtWakesOnPublishTest) {
+    SnapshotMap<int, int> map;
+
+    std::thread writer([&map]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        map.insert({1, 10});
+        map.insert({2, 20});
+    });
+
+    BOOST_CHECK_EQUAL(map.at(2), 20);
+    writer.join();
+}
+
+BOOST_AUTO_TEST_CASE(SnapshotOutlivesUpdateTest) {
+    auto tracker = std::make_shared<int>(0);
+    SnapshotMap<int, std::shared_ptr<int>> map;
+    map.insert({1, tracker});
+
+    map.read([&](const auto& snapshot) {
+        // Replacing the element while this snapshot is protected must not destroy it
+        map.update([](auto& next) { next.clear(); });
+        map.insert({2, nullptr});
+        BOOST_CHECK_EQUAL(snapshot.at(1).get(), tracker.get());
+        BOOST_CHECK(map.contains(2)); // Nested lookup on the same thread
+    });
+
+    // The protected version is reclaimed by the next write once the reader is gone
+    map.insert({3, nullptr});
+    BOOST_CHECK_EQUAL(tracker.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentReadersAndWriterTest) {
+    SnapshotMap<int, int> map;
+    const int num_readers = 6;
+    const int num_versions = 2000;
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistent{0};
+
+    // Every version holds keys 0 and 1 with the same value
+    map.update([](auto& next) { next[0] = 0; next[1] = 0; });
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < num_readers; ++t) {
+        readers.emplace_back([&]() {
+            int last = 0;
+            while (!done.load()) {
+                map.read([&](const auto& snapshot) {
+                    const int first = snapshot.at(0);
+                    if (first != snapshot.at(1) || first < last) {
+                        ++inconsistent;
+                    }
+                    last = first;
+                });
+            }
+        });
+    }
+
+    for (int version = 1; version <= num_versions; ++version) {
+        map.update([version](auto& next) { next[0] = version; next[1] = version; });
+    }
+    done = true;
+    for (auto& th : readers) {
+        th.join();
+    }
+
+    BOOST_CHECK_EQUAL(inconsistent.load(), 0);
+    BOOST_CHECK_EQUAL(map.at(0), num_versions);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+// test_spsc_circular_queue.cpp
+
+#define BOOST_TEST_MODULE SpscCircularQueueTest
+#include <boost/test/included/unit_test.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <string>
+
+#include <container/spsc_circular_queue.hpp>
+#include <container/safe_circular_queue.hpp>
+
+namespace cxx_lab {
+
+// Generic consumer used to check that both queues can be swapped by a template parameter
+template <typename Queue>
+std::vector<int> drain(Queue& queue, size_t count) {
+    std::vector<int> out;
+    int value;
+    for (size_t i = 0; i < count; ++i) {
+        if (queue.pop_front(value, std::chrono::milliseconds(1000))) {
+            out.push_back(value);
+        }
+    }
+    return out;
+}
+
+} // namespace cxx_lab
+
+BOOST_AUTO_TEST_SUITE(SpscCircularQueueSuite)
+
+// Test Case 1: Basic Push and Pop Operations
+BOOST_AUTO_TEST_CASE(BasicPushPop) {
+    cxx_lab::SpscCircularQueue<int> queue(4);
+
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK(queue.try_push_back(1));
+    BOOST_CHECK(queue.try_push_back(2));
+    BOOST_CHECK_NO_THROW(queue.push_back(3));
+    BOOST_CHECK_EQUAL(queue.size(), 3);
+
+    int item;
+    BOOST_CHECK(queue.try_pop_front(item));
+    BOOST_CHECK_EQUAL(item, 1);
+    BOOST_CHECK(queue.pop_front(item, std::chrono::milliseconds(10)));
+    BOOST_CHECK_EQUAL(item, 2);
+    BOOST_CHECK_NO_THROW(queue.pop_front(item));
+    BOOST_CHECK_EQUAL(item, 3);
+
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK(!queue.try_pop_front(item));
+}
+
+// Test Case 2: Capacity is rounded up to a power of two and never overwritten
+BOOST_AUTO_TEST_CASE(CapacityManagement) {
+    cxx_lab::SpscCircularQueue<int> queue(3);
+    BOOST_CHECK_EQUAL(queue.capacity(), 4);
+
+    for (int i = 0; i < 4; ++i) {
+        BOOST_CHECK(queue.try_push_back(i));
+    }
+    BOOST_CHECK(queue.full());
+    BOOST_CHECK(!queue.try_push_back(4));
+    BOOST_CHECK(!queue.push_back(4, std::chrono::milliseconds(20)));
+
+    int item;
+    BOOST_CHECK(queue.try_pop_front(item));
+    BOOST_CHECK_EQUAL(item, 0);
+    BOOST_CHECK(queue.try_push_back(4));
+
+    BOOST_CHECK_THROW(cxx_lab::SpscCircularQueue<int>(0), std::invalid_argument);
+}
+
+// Test Case 3: Timed pop fails on an empty queue
+BOOST_AUTO_TEST_CASE(PopTimeout) {
+    cxx_lab::SpscCircularQueue<int> queue(8);
+    int item = -1;
+    auto start = std::chrono::steady_clock::now();
+    BOOST_CHECK(!queue.pop_front(item, std::chrono::milliseconds(50)));
+    BOOST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(50));
+    BOOST_CHECK_EQUAL(item, -1);
+}
+
+// Test Case 4: Move-only elements and destruction of leftovers
+BOOST_AUTO_TEST_CASE(MoveOnlyElements) {
+    auto tracker = std::make_shared<int>(7);
+    {
+        cxx_lab::SpscCircularQueue<std::unique_ptr<std::shared_ptr<int>>> queue(4);
+        BOOST_CHECK(queue.try_push_back(std::make_unique<std::shared_ptr<int>>(tracker)));
+        BOOST_CHECK(queue.try_emplace_back(new std::shared_ptr<int>(tracker)));
+        BOOST_CHECK_EQUAL(tracker.use_count(), 3);
+
+        std::unique_ptr<std::shared_ptr<int>> item;
+        BOOST_CHECK(queue.try_pop_front(item));
+        BOOST_CHECK_EQUAL(**item, 7);
+    }
+    // The element left in the queue and the popped one are both released
+    BOOST_CHECK_EQUAL(tracker.use_count(), 1);
+}
+
+// Test Case 5: One producer and one consumer preserve FIFO order
+BOOST_AUTO_TEST_CASE(ProducerConsumerOrder) {
+    cxx_lab::SpscCircularQueue<int> queue(64);
+    const int count = 100000;
+
+    std::thread producer([&]() {
+        for (int i = 0; i < count; ++i) {
+            queue.push_back(i);
+        }
+    });
+
+    bool in_order = true;
+    int item;
+    for (int i = 0; i < count; ++i) {
+        queue.pop_front(item);
+        in_order = in_order && (item == i);
+    }
+    producer.join();
+
+    BOOST_CHECK(in_order);
+    BOOST_CHECK(queue.empty());
+}
+
+// Test Case 6: The same generic consumer works with both queue implementations
+BOOST_AUTO_TEST_CASE(InterchangeableWithSafeCircularQueue) {
+    cxx_lab::SpscCircularQueue<int> spsc(16);
+    cxx_lab::SafeCircularQueue<int> mutex_queue(16);
+    for (int i = 0; i < 10; ++i) {
+        spsc.push_back(i);
+        mutex_queue.push_back(i);
+    }
+    BOOST_CHECK(cxx_lab::drain(spsc, 10) == cxx_lab::drain(mutex_queue, 10));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
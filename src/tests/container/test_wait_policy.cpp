@@ -0,0 +1,208 @@
+// test_wait_policy.cpp
+
+#define BOOST_TEST_MODULE WaitPolicyTest
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <container/safe_bounded_priority_queue.hpp>
+#include <container/safe_bounded_queue.hpp>
+#include <container/safe_circular_queue.hpp>
+#include <container/safe_deque.hpp>
+#include <container/safe_map.hpp>
+#include <container/safe_multimap.hpp>
+#include <container/safe_set.hpp>
+#include <container/sharded_safe_map.hpp>
+#include <container/snapshot_map.hpp>
+#include <container/wait_policy.hpp>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * @brief Runs producers pushing 1..per_producer each and consumers popping until all items are
+ *        seen; returns the sum of the popped items.
+ */
+template <typename Push, typename Pop>
+long long run_producers_consumers(int producers, int consumers, int per_producer, Push push, Pop pop) {
+    std::atomic<long long> sum{0};
+    std::atomic<int> remaining{producers * per_producer};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&]() {
+            for (int i = 1; i <= per_producer; ++i) {
+                push(i);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            while (remaining.load() > 0) {
+                if (pop(value)) {
+                    sum += value;
+                    remaining--;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return sum.load();
+}
+
+constexpr int PRODUCERS = 2;
+constexpr int CONSUMERS = 2;
+constexpr int PER_PRODUCER = 5000;
+constexpr long long EXPECTED_SUM = PRODUCERS * (PER_PRODUCER * (PER_PRODUCER + 1LL) / 2);
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(WaitPolicySuite)
+
+// Test Case 1: AtomicCondition times out without a notification and wakes on one
+BOOST_AUTO_TEST_CASE(AtomicConditionTimeoutAndNotify) {
+    cxx_lab::AtomicCondition condition;
+    std::mutex mutex;
+    bool ready = false;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto start = std::chrono::steady_clock::now();
+    BOOST_CHECK(condition.wait_for(lock, 20ms) == std::cv_status::timeout);
+    BOOST_CHECK(std::chrono::steady_clock::now() - start >= 20ms);
+    BOOST_CHECK(!condition.wait_for(lock, 10ms, [&]() { return ready; }));
+    BOOST_CHECK(lock.owns_lock());
+    lock.unlock();
+
+    std::thread notifier([&]() {
+        std::this_thread::sleep_for(10ms);
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            ready = true;
+        }
+        condition.notify_one();
+    });
+    lock.lock();
+    BOOST_CHECK(condition.wait_for(lock, 5s, [&]() { return ready; }));
+    BOOST_CHECK(lock.owns_lock());
+    lock.unlock();
+    notifier.join();
+}
+
+// Test Case 2: AtomicCondition works with shared locks and notify_all wakes every waiter
+BOOST_AUTO_TEST_CASE(AtomicConditionSharedLockNotifyAll) {
+    cxx_lab::AtomicCondition condition;
+    std::shared_timed_mutex mutex;
+    bool ready = false;
+    std::atomic<int> woken{0};
+
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < 4; ++i) {
+        waiters.emplace_back([&]() {
+            std::shared_lock<std::shared_timed_mutex> lock(mutex);
+            condition.wait(lock, [&]() { return ready; });
+            woken++;
+        });
+    }
+    std::this_thread::sleep_for(20ms);
+    {
+        std::unique_lock<std::shared_timed_mutex> lock(mutex);
+        ready = true;
+    }
+    condition.notify_all();
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    BOOST_CHECK_EQUAL(woken.load(), 4);
+}
+
+// Test Case 3: The queues hand every item over exactly once under AtomicWait
+BOOST_AUTO_TEST_CASE(QueuesWithAtomicWait) {
+    cxx_lab::SafeDeque<int, std::deque<int>, cxx_lab::NullContainerStats, cxx_lab::AtomicWait> deque;
+    BOOST_CHECK_EQUAL(run_producers_consumers(PRODUCERS, CONSUMERS, PER_PRODUCER,
+                                              [&](int v) { deque.push_back(v); },
+                                              [&](int& v) { return deque.pop_front(v, 10ms); }),
+                      EXPECTED_SUM);
+
+    // A small capacity makes the producers block too
+    cxx_lab::SafeBoundedQueue<int, std::deque<int>, cxx_lab::NullContainerStats, cxx_lab::AtomicWait> bounded(4);
+    BOOST_CHECK_EQUAL(run_producers_consumers(PRODUCERS, CONSUMERS, PER_PRODUCER,
+                                              [&](int v) { bounded.push_back(v); },
+                                              [&](int& v) { return bounded.pop_front(v, 10ms); }),
+                      EXPECTED_SUM);
+
+    // The circular queue overwrites its oldest element when full, so give it room for every item
+    cxx_lab::SafeCircularQueue<int, cxx_lab::NullContainerStats, cxx_lab::AtomicWait> circular(PRODUCERS * PER_PRODUCER);
+    BOOST_CHECK_EQUAL(run_producers_consumers(PRODUCERS, CONSUMERS, PER_PRODUCER,
+                                              [&](int v) { circular.push_back(v); },
+                                              [&](int& v) { return circular.pop_front(v, 10ms); }),
+                      EXPECTED_SUM);
+
+    cxx_lab::SafeBoundedPriorityQueue<int, std::less<int>, 4, cxx_lab::AtomicWait> priority(4);
+    BOOST_CHECK_EQUAL(run_producers_consumers(PRODUCERS, CONSUMERS, PER_PRODUCER,
+                                              [&](int v) { priority.push(v); },
+                                              [&](int& v) { return priority.pop(v, 10ms); }),
+                      EXPECTED_SUM);
+}
+
+// Test Case 4: Keyed waits of the associative containers wake under AtomicWait
+BOOST_AUTO_TEST_CASE(AssociativeWithAtomicWait) {
+    cxx_lab::SafeMap<int, int, std::map<int, int>, cxx_lab::NullContainerStats, cxx_lab::AtomicWait> map;
+    cxx_lab::SafeSet<int, std::set<int>, cxx_lab::NullContainerStats, cxx_lab::AtomicWait> set;
+    cxx_lab::SafeMultiMap<int, int, std::multimap<int, int>, cxx_lab::NullContainerStats, cxx_lab::AtomicWait> multimap;
+
+    int value = 0;
+    BOOST_CHECK(!map.at(1, value, 10ms));
+    BOOST_CHECK(!set.extract(1, 10ms));
+
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(10ms);
+        map.insert({1, 42});
+        set.insert(1);
+        multimap.insert({1, 7});
+        multimap.insert({1, 8});
+    });
+    BOOST_CHECK(map.at(1, value, 5s));
+    BOOST_CHECK_EQUAL(value, 42);
+    BOOST_CHECK(set.extract(1, 5s));
+    producer.join();
+
+    std::vector<int> values;
+    BOOST_CHECK_EQUAL(multimap.extract(1, values, 5s), 2);
+    BOOST_CHECK_EQUAL(values.size(), 2);
+}
+
+// Test Case 5: Blocked lookups of the sharded and snapshot maps wake under AtomicWait
+BOOST_AUTO_TEST_CASE(HashAndSnapshotMapsWithAtomicWait) {
+    cxx_lab::ShardedSafeMap<int, std::string, std::hash<int>, 16, cxx_lab::AtomicWait> sharded;
+    cxx_lab::SnapshotMap<int, std::string, std::map<int, std::string>, cxx_lab::AtomicWait> snapshot;
+    static_assert(std::is_same_v<decltype(sharded)::condition_type, cxx_lab::AtomicCondition>);
+    static_assert(std::is_same_v<decltype(snapshot)::condition_type, cxx_lab::AtomicCondition>);
+
+    std::string value;
+    BOOST_CHECK(!sharded.at(1, value, 10ms));
+    BOOST_CHECK(!snapshot.at(1, value, 10ms));
+
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(10ms);
+        sharded.insert({1, "sharded"});
+        snapshot.insert({1, "snapshot"});
+    });
+    BOOST_CHECK(sharded.at(1, value, 5s));
+    BOOST_CHECK_EQUAL(value, "sharded");
+    BOOST_CHECK_EQUAL(snapshot.at(1), "snapshot");
+    producer.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+// test_work_stealing_pool.cpp
+
+#define BOOST_TEST_MODULE WorkStealingPoolTest
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+
+#include <container/work_stealing_pool.hpp>
+
+namespace asio = boost::asio;
+
+namespace {
+
+// Naive recursive Fibonacci that forks one branch into the pool
+void fork_fib(cxx_lab::WorkStealingPool& pool, int n, std::atomic<long>& sum) {
+    if (n < 2) {
+        sum.fetch_add(n, std::memory_order_relaxed);
+        return;
+    }
+    pool.submit([&pool, n, &sum]() { fork_fib(pool, n - 1, sum); });
+    fork_fib(pool, n - 2, sum);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(WorkStealingPoolSuite)
+
+// Test Case 1: Work submitted from outside runs exactly once before join() returns
+BOOST_AUTO_TEST_CASE(SubmitAndJoin) {
+    BOOST_CHECK_THROW(cxx_lab::WorkStealingPool(0), std::invalid_argument);
+
+    cxx_lab::WorkStealingPool pool(4);
+    BOOST_CHECK_EQUAL(pool.size(), 4);
+    BOOST_CHECK(!pool.running_in_this_thread());
+    std::atomic<int> count{0};
+    std::atomic<int> inside{0};
+    for (int i = 0; i < 10000; ++i) {
+        pool.submit([&]() {
+            count.fetch_add(1, std::memory_order_relaxed);
+            inside.fetch_add(pool.running_in_this_thread() ? 1 : 0, std::memory_order_relaxed);
+        });
+    }
+    pool.join();
+    BOOST_CHECK_EQUAL(count.load(), 10000);
+    BOOST_CHECK_EQUAL(inside.load(), 10000);
+}
+
+// Test Case 2: Tasks that spawn tasks (fork/join) all run before join() returns
+BOOST_AUTO_TEST_CASE(ForkJoin) {
+    cxx_lab::WorkStealingPool pool(3);
+    std::atomic<long> sum{0};
+    pool.submit([&]() { fork_fib(pool, 20, sum); });
+    pool.join();
+    BOOST_CHECK_EQUAL(sum.load(), 6765);
+}
+
+// Test Case 3: asio::post and asio::co_spawn target the pool through its executor
+BOOST_AUTO_TEST_CASE(AsioExecutor) {
+    cxx_lab::WorkStealingPool pool(2);
+    auto executor = pool.get_executor();
+    BOOST_CHECK(executor == pool.get_executor());
+    asio::any_io_executor any = executor;
+    BOOST_CHECK(&asio::query(any, asio::execution::context) == &pool);
+
+    std::atomic<int> posted{0};
+    asio::post(pool, [&]() { posted += pool.running_in_this_thread() ? 1 : 0; });
+    asio::post(executor, [&]() { posted += 1; });
+
+    std::atomic<bool> coroutine_done{false};
+    asio::co_spawn(
+        executor,
+        [&]() -> asio::awaitable<void> {
+            auto ex = co_await asio::this_coro::executor;
+            asio::steady_timer timer(ex, std::chrono::milliseconds(5));
+            co_await timer.async_wait(asio::use_awaitable);
+            coroutine_done = pool.running_in_this_thread();
+        },
+        asio::detached);
+
+    // The pending timer wait holds a tracked executor, so join() waits for the coroutine
+    pool.join();
+    BOOST_CHECK_EQUAL(posted.load(), 2);
+    BOOST_CHECK(coroutine_done.load());
+}
+
+// Test Case 4: stop() discards work that has not started
+BOOST_AUTO_TEST_CASE(StopDiscardsPendingWork) {
+    auto pool = std::make_unique<cxx_lab::WorkStealingPool>(1);
+    std::atomic<bool> release{false};
+    std::atomic<int> ran{0};
+    auto owned = std::make_shared<int>(0);
+    pool->submit([&]() {
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+    for (int i = 0; i < 100; ++i) {
+        pool->submit([&ran, owned]() { ++ran; });
+    }
+    pool->stop();
+    release = true;
+    pool.reset();
+    BOOST_CHECK_LT(ran.load(), 100);
+    BOOST_CHECK_EQUAL(owned.use_count(), 1); // The discarded tasks were destroyed
+}
+
+// Test Case 5: An executor tracking outstanding work keeps join() waiting until it is released
+BOOST_AUTO_TEST_CASE(TrackedExecutorDelaysJoin) {
+    cxx_lab::WorkStealingPool pool(2);
+    auto untracked = pool.get_executor();
+    BOOST_CHECK(asio::query(untracked, asio::execution::outstanding_work) == asio::execution::outstanding_work.untracked);
+
+    auto tracked = asio::require(untracked, asio::execution::outstanding_work.tracked);
+    BOOST_CHECK(asio::query(tracked, asio::execution::outstanding_work) == asio::execution::outstanding_work.tracked);
+    BOOST_CHECK(tracked != untracked);
+    auto copy = tracked; // Copies track work too
+
+    std::atomic<bool> joined{false};
+    std::thread joiner([&]() {
+        pool.join();
+        joined = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    BOOST_CHECK(!joined.load());
+
+    std::atomic<bool> ran{false};
+    asio::post(copy, [&]() { ran = true; }); // Work can still be added before the last release
+    tracked = untracked;
+    copy = asio::require(copy, asio::execution::outstanding_work.untracked);
+    joiner.join();
+    BOOST_CHECK(ran.load());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,275 @@
+// test_sample_recorder.cpp
+
+#define BOOST_TEST_MODULE SampleRecorderTest
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "recording_reader.hpp"
+#include "sample_recorder.hpp"
+
+namespace {
+
+// A fresh directory per test case, removed afterwards
+struct RecordingDirectory {
+    RecordingDirectory()
+        : path(std::filesystem::temp_directory_path() /
+               ("test_sample_recorder_" + std::to_string(::getpid()) + "_" +
+                boost::unit_test::framework::current_test_case().p_name.get())) {
+        std::filesystem::remove_all(path);
+    }
+
+    ~RecordingDirectory() {
+        std::filesystem::remove_all(path);
+    }
+
+    SampleRecorder::Options options(std::size_t segment_records) const {
+        SampleRecorder::Options options;
+        options.directory = path;
+        options.segment_records = segment_records;
+        options.commit_interval = std::chrono::milliseconds(5);
+        return options;
+    }
+
+    std::filesystem::path path;
+};
+
+SegmentHeader read_header(const std::filesystem::path& file) {
+    SegmentHeader header{};
+    std::ifstream in(file, std::ios::binary);
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    return header;
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(SampleRecorderSuite, RecordingDirectory)
+
+// Test Case 1: On-Disk Layout of a Segment
+BOOST_AUTO_TEST_CASE(SegmentLayout) {
+    {
+        SampleRecorder recorder(options(1000));
+        BOOST_CHECK(recorder.record(SampleRecord{123, 7, 0, 4.5}));
+        BOOST_CHECK(recorder.record(SampleRecord{124, 8, 0, -1.0}));
+    }
+
+    const auto files = SampleRecorder::segment_paths(path, "sensors");
+    BOOST_REQUIRE_EQUAL(files.size(), 1);
+    BOOST_CHECK_EQUAL(files.front().filename().string(), "sensors-00000000.seg");
+    BOOST_CHECK_EQUAL(std::filesystem::file_size(files.front()), sizeof(SegmentHeader) + 2 * sizeof(SampleRecord));
+
+    const SegmentHeader header = read_header(files.front());
+    BOOST_CHECK(std::memcmp(header.magic, SegmentHeader::MAGIC, sizeof(header.magic)) == 0);
+    BOOST_CHECK_EQUAL(header.version, SegmentHeader::VERSION);
+    BOOST_CHECK_EQUAL(header.record_size, 24);
+    BOOST_CHECK_EQUAL(header.segment, 0);
+    BOOST_CHECK_EQUAL(header.capacity, 1000);
+    BOOST_CHECK_EQUAL(header.committed, 2);
+
+    SampleRecord second{};
+    std::ifstream in(files.front(), std::ios::binary);
+    in.seekg(sizeof(SegmentHeader) + sizeof(SampleRecord));
+    in.read(reinterpret_cast<char*>(&second), sizeof(second));
+    BOOST_CHECK_EQUAL(second.timestamp_ns, 124);
+    BOOST_CHECK_EQUAL(second.sensor_id, 8);
+    BOOST_CHECK_EQUAL(second.value, -1.0);
+}
+
+// Test Case 2: Full Segments Rotate, the Last One Is Truncated
+BOOST_AUTO_TEST_CASE(RotationAndTruncation) {
+    {
+        SampleRecorder recorder(options(100));
+        for (int i = 0; i < 350; ++i) {
+            BOOST_CHECK(recorder.record(SampleRecord{i, 1, 0, static_cast<double>(i)}));
+        }
+        recorder.stop();
+        BOOST_CHECK_EQUAL(recorder.committed(), 350);
+        BOOST_CHECK_EQUAL(recorder.dropped(), 0);
+        BOOST_CHECK(recorder.error().empty());
+    }
+
+    RecordingReader reader(path);
+    BOOST_REQUIRE_EQUAL(reader.segment_count(), 4);
+    for (std::size_t i = 0; i < 3; ++i) {
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(reader.segment_path(i)), sizeof(SegmentHeader) + 100 * sizeof(SampleRecord));
+        BOOST_CHECK_EQUAL(reader.map(i).records().size(), 100);
+    }
+    BOOST_CHECK_EQUAL(std::filesystem::file_size(reader.segment_path(3)), sizeof(SegmentHeader) + 50 * sizeof(SampleRecord));
+
+    std::int64_t expected = 0;
+    std::size_t segments = 0;
+    const std::uint64_t total = reader.replay([&](std::span<const SampleRecord> records) {
+        BOOST_CHECK_EQUAL(reader.map(segments).index(), segments);
+        ++segments;
+        for (const SampleRecord& record : records) {
+            BOOST_CHECK_EQUAL(record.timestamp_ns, expected);
+            BOOST_CHECK_EQUAL(record.value, static_cast<double>(expected));
+            ++expected;
+        }
+    });
+    BOOST_CHECK_EQUAL(total, 350);
+    BOOST_CHECK_EQUAL(segments, 4);
+}
+
+// Test Case 3: Round Trip From Several Producer Threads
+BOOST_AUTO_TEST_CASE(MultiThreadedRoundTrip) {
+    const int num_threads = 4;
+    const int per_thread = 20000;
+    {
+        SampleRecorder recorder(options(1 << 14));
+        std::vector<std::thread> producers;
+        for (int t = 0; t < num_threads; ++t) {
+            producers.emplace_back([&, t]() {
+                for (int i = 0; i < per_thread; ++i) {
+                    while (!recorder.record(SampleRecord{i, static_cast<std::uint32_t>(t), 0, i * 0.5})) {
+                        std::this_thread::yield(); // Channel full: let the writer catch up
+                    }
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+    }
+
+    // Each thread's samples come back complete and in order, whatever the interleaving
+    std::vector<std::int64_t> next(num_threads, 0);
+    const std::uint64_t total = RecordingReader(path).replay([&](std::span<const SampleRecord> records) {
+        for (const SampleRecord& record : records) {
+            BOOST_REQUIRE_LT(record.sensor_id, static_cast<std::uint32_t>(num_threads));
+            BOOST_CHECK_EQUAL(record.timestamp_ns, next[record.sensor_id]);
+            BOOST_CHECK_EQUAL(record.value, record.timestamp_ns * 0.5);
+            ++next[record.sensor_id];
+        }
+    });
+    BOOST_CHECK_EQUAL(total, num_threads * per_thread);
+    for (int t = 0; t < num_threads; ++t) {
+        BOOST_CHECK_EQUAL(next[t], per_thread);
+    }
+}
+
+// Test Case 4: Every Sample Accepted Before stop() Is Written, Every Other One Is Counted
+BOOST_AUTO_TEST_CASE(StopAccountsForEverySample) {
+    const int num_threads = 3;
+    std::atomic<std::uint64_t> accepted{0};
+    std::atomic<std::uint64_t> rejected{0};
+    std::atomic<bool> go{true};
+    SampleRecorder recorder(options(1 << 16));
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < num_threads; ++t) {
+        producers.emplace_back([&, t]() {
+            while (go.load()) {
+                if (recorder.record(static_cast<std::uint32_t>(t), 1.0)) {
+                    accepted++;
+                } else {
+                    rejected++;
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    recorder.stop(); // While the producers are still recording
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    go = false;
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    BOOST_CHECK_GT(rejected.load(), 0);
+    BOOST_CHECK_EQUAL(recorder.committed(), accepted.load());
+    BOOST_CHECK_EQUAL(recorder.dropped(), rejected.load());
+    BOOST_CHECK_EQUAL(RecordingReader(path).replay([](std::span<const SampleRecord>) {}), accepted.load());
+    BOOST_CHECK(!recorder.record(0, 0.0));
+}
+
+// Test Case 5: A New Recorder Continues After the Existing Segments
+BOOST_AUTO_TEST_CASE(ExistingSegmentsAreKept) {
+    {
+        SampleRecorder first(options(10));
+        for (int i = 0; i < 15; ++i) {
+            first.record(SampleRecord{i, 1, 0, 0.0});
+        }
+    }
+    {
+        SampleRecorder second(options(10));
+        second.record(SampleRecord{100, 2, 0, 0.0});
+    }
+
+    RecordingReader reader(path);
+    BOOST_REQUIRE_EQUAL(reader.segment_count(), 3);
+    BOOST_CHECK_EQUAL(reader.map(2).index(), 2);
+    BOOST_REQUIRE_EQUAL(reader.map(2).records().size(), 1);
+    BOOST_CHECK_EQUAL(reader.map(2).records().front().timestamp_ns, 100);
+    BOOST_CHECK_EQUAL(reader.replay([](std::span<const SampleRecord>) {}), 16);
+}
+
+// Test Case 6: A Segment Being Written Shows Its Committed Records
+BOOST_AUTO_TEST_CASE(ReadWhileWriting) {
+    SampleRecorder recorder(options(1000));
+    for (int i = 0; i < 10; ++i) {
+        recorder.record(SampleRecord{i, 1, 0, 0.0});
+    }
+    while (recorder.committed() < 10) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    RecordingReader reader(path);
+    BOOST_REQUIRE_EQUAL(reader.segment_count(), 1);
+    const RecordingReader::Segment segment = reader.map(0);
+    BOOST_CHECK_EQUAL(segment.records().size(), 10);
+
+    for (int i = 10; i < 25; ++i) {
+        recorder.record(SampleRecord{i, 1, 0, 0.0});
+    }
+    while (recorder.committed() < 25) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    BOOST_CHECK_EQUAL(segment.records().size(), 25); // Same mapping, new commit
+    BOOST_CHECK_EQUAL(segment.records().back().timestamp_ns, 24);
+}
+
+// Test Case 7: The Reader Rejects Files That Are Not Segments
+BOOST_AUTO_TEST_CASE(RejectsForeignFiles) {
+    std::filesystem::create_directories(path);
+    {
+        std::ofstream out(path / "sensors-00000000.seg", std::ios::binary);
+        const std::string junk(200, 'x');
+        out.write(junk.data(), static_cast<std::streamsize>(junk.size()));
+    }
+    {
+        std::ofstream out(path / "sensors-00000001.seg", std::ios::binary);
+        out.write("short", 5);
+    }
+
+    RecordingReader reader(path);
+    BOOST_REQUIRE_EQUAL(reader.segment_count(), 2);
+    BOOST_CHECK_THROW(reader.map(0), std::runtime_error);
+    BOOST_CHECK_THROW(reader.map(1), std::runtime_error);
+}
+
+// Test Case 8: Files Whose Index Is Not a Number Are Not Segments
+BOOST_AUTO_TEST_CASE(IgnoresNonNumericIndices) {
+    std::filesystem::create_directories(path);
+    std::ofstream(path / "sensors-backup01.seg") << "not a segment";
+    std::ofstream(path / "sensors-0000001x.seg") << "not a segment";
+    {
+        SampleRecorder recorder(options(10));
+        recorder.record(SampleRecord{1, 1, 0, 0.0});
+    }
+
+    RecordingReader reader(path);
+    BOOST_REQUIRE_EQUAL(reader.segment_count(), 1);
+    BOOST_CHECK_EQUAL(reader.segment_path(0).filename(), "sensors-00000000.seg");
+    BOOST_CHECK_EQUAL(reader.replay([](std::span<const SampleRecord>) {}), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+// test_sensor.cpp
+
+#define BOOST_TEST_MODULE SensorTest
+#include <boost/test/included/unit_test.hpp>
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "sensor.hpp"
+#include "timer_wheel.hpp"
+
+// A sensor whose readings count up from 0
+class CountingSensor : public Sensor<int> {
+public:
+    using Sensor<int>::Sensor;
+
+protected:
+    int generate_data() override {
+        return next_++;
+    }
+
+private:
+    int next_ = 0;
+};
+
+BOOST_AUTO_TEST_SUITE(SensorSuite)
+
+// Test Case 1: The Period Is Rounded Up to the Wheel's Tick
+BOOST_AUTO_TEST_CASE(PeriodRoundedToWheelTick) {
+    boost::asio::io_context io;
+    TimerWheel wheel(io, std::chrono::milliseconds(1));
+
+    CountingSensor own_timer(io, std::chrono::microseconds(100));
+    CountingSensor short_period(wheel, std::chrono::microseconds(100));
+    CountingSensor long_period(wheel, std::chrono::microseconds(2500));
+    CountingSensor whole_ticks(wheel, std::chrono::milliseconds(3));
+
+    BOOST_CHECK(own_timer.period() == std::chrono::microseconds(100));
+    BOOST_CHECK(short_period.period() == std::chrono::milliseconds(1));
+    BOOST_CHECK(long_period.period() == std::chrono::milliseconds(3));
+    BOOST_CHECK(whole_ticks.period() == std::chrono::milliseconds(3));
+}
+
+// Test Case 2: Batches on a Coarse Wheel Respect the Latency Bound
+BOOST_AUTO_TEST_CASE(BatchLatencyOnCoarseWheel) {
+    boost::asio::io_context io;
+    TimerWheel wheel(io, std::chrono::milliseconds(1));
+    CountingSensor sensor(wheel, std::chrono::microseconds(100)); // Reads every 1 ms, not 100 us
+
+    std::vector<std::size_t> sizes;
+    std::vector<int> samples;
+    sensor.subscribe_batch([&](std::span<const int> batch) {
+        sizes.push_back(batch.size());
+        samples.insert(samples.end(), batch.begin(), batch.end());
+    });
+    sensor.set_batching(1000, std::chrono::milliseconds(10));
+
+    sensor.start();
+    io.run_for(std::chrono::milliseconds(60));
+
+    // 10 ms at one sample per ms holds 11 samples; the raw period would allow 101
+    BOOST_REQUIRE(!sizes.empty());
+    for (std::size_t size : sizes) {
+        BOOST_CHECK_EQUAL(size, 11);
+    }
+
+    // stop() delivers the rest, in order
+    const std::size_t full_batches = sizes.size();
+    sensor.stop();
+    BOOST_CHECK_LE(sizes.size(), full_batches + 1);
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        BOOST_CHECK_EQUAL(samples[i], static_cast<int>(i));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,155 @@
+// test_stats_aggregator.cpp
+
+#define BOOST_TEST_MODULE StatsAggregatorTest
+#include <boost/test/included/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "stats_aggregator.hpp"
+
+namespace {
+
+// Straightforward summary of values[end - window, end), to check the aggregator against
+WindowSummary naive_summary(const std::vector<double>& values, std::size_t end, std::size_t window) {
+    std::vector<double> sorted(values.begin() + static_cast<std::ptrdiff_t>(end - window),
+                               values.begin() + static_cast<std::ptrdiff_t>(end));
+    std::sort(sorted.begin(), sorted.end());
+
+    WindowSummary summary{};
+    summary.first_sample = end - window;
+    summary.count = window;
+    summary.min = sorted.front();
+    summary.max = sorted.back();
+    double sum = 0.0;
+    for (double x : sorted) {
+        sum += x;
+    }
+    summary.mean = sum / static_cast<double>(window);
+    double squares = 0.0;
+    for (double x : sorted) {
+        squares += (x - summary.mean) * (x - summary.mean);
+    }
+    summary.variance = squares / static_cast<double>(window);
+    auto nearest_rank = [&](double p) {
+        const auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(window)));
+        return sorted[rank == 0 ? 0 : rank - 1];
+    };
+    summary.p50 = nearest_rank(0.50);
+    summary.p90 = nearest_rank(0.90);
+    summary.p99 = nearest_rank(0.99);
+    return summary;
+}
+
+void check_summary(const WindowSummary& actual, const WindowSummary& expected) {
+    BOOST_CHECK_EQUAL(actual.first_sample, expected.first_sample);
+    BOOST_CHECK_EQUAL(actual.count, expected.count);
+    BOOST_CHECK_EQUAL(actual.min, expected.min);
+    BOOST_CHECK_EQUAL(actual.max, expected.max);
+    BOOST_CHECK_CLOSE(actual.mean, expected.mean, 1e-9);
+    BOOST_CHECK_SMALL(actual.variance - expected.variance, 1e-9 * std::max(1.0, expected.variance));
+    BOOST_CHECK_EQUAL(actual.p50, expected.p50);
+    BOOST_CHECK_EQUAL(actual.p90, expected.p90);
+    BOOST_CHECK_EQUAL(actual.p99, expected.p99);
+}
+
+std::vector<double> random_samples(std::size_t count, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::normal_distribution<double> distribution(20.0, 5.0);
+    std::vector<double> samples(count);
+    for (double& sample : samples) {
+        sample = distribution(generator);
+    }
+    return samples;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(StatsAggregatorSuite)
+
+// Test Case 1: Summaries Match a Naive Reference for Tumbling and Sliding Windows
+BOOST_AUTO_TEST_CASE(MatchesNaiveReference) {
+    struct Shape {
+        std::size_t window;
+        std::size_t hop;
+    };
+    // Windows below, at and above the 8 reduction lanes; hop == window tumbles
+    const Shape shapes[] = {{1, 1}, {7, 7}, {8, 8}, {100, 100}, {100, 1}, {100, 30}, {300, 100}, {13, 5}, {64, 64}};
+
+    for (const Shape& shape : shapes) {
+        BOOST_TEST_CONTEXT("window " << shape.window << ", hop " << shape.hop) {
+            // Not a whole number of hops: the final partial window must not be published
+            const std::size_t count = 3 * shape.window + shape.hop / 2 + 3;
+            const std::vector<double> samples = random_samples(count, static_cast<unsigned>(shape.window * 31 + shape.hop));
+
+            StatsAggregator<double> aggregator(shape.window, shape.hop);
+            std::vector<WindowSummary> summaries;
+            aggregator.subscribe([&](const WindowSummary& summary) { summaries.push_back(summary); });
+            for (double sample : samples) {
+                aggregator.add(sample);
+            }
+
+            const std::size_t expected = (count - shape.window) / shape.hop + 1;
+            BOOST_REQUIRE_EQUAL(summaries.size(), expected);
+            for (std::size_t k = 0; k < expected; ++k) {
+                check_summary(summaries[k], naive_summary(samples, shape.window + k * shape.hop, shape.window));
+            }
+            BOOST_CHECK_EQUAL(aggregator.total(), count);
+        }
+    }
+}
+
+// Test Case 2: Batches of Any Size Give the Same Summaries as Single Samples
+BOOST_AUTO_TEST_CASE(BatchesMatchSingleSamples) {
+    const std::vector<double> samples = random_samples(1000, 7);
+    for (std::size_t batch : {1, 3, 50, 99, 1000}) {
+        BOOST_TEST_CONTEXT("batch " << batch) {
+            StatsAggregator<double> aggregator(100, 40);
+            std::vector<WindowSummary> summaries;
+            aggregator.subscribe([&](const WindowSummary& summary) { summaries.push_back(summary); });
+            for (std::size_t i = 0; i < samples.size(); i += batch) {
+                aggregator.add(std::span<const double>(samples).subspan(i, std::min(batch, samples.size() - i)));
+            }
+
+            BOOST_REQUIRE_EQUAL(summaries.size(), (1000 - 100) / 40 + 1);
+            for (std::size_t k = 0; k < summaries.size(); ++k) {
+                check_summary(summaries[k], naive_summary(samples, 100 + k * 40, 100));
+            }
+        }
+    }
+}
+
+// Test Case 3: Integer Samples and Fewer Samples Than a Window
+BOOST_AUTO_TEST_CASE(IntegerSamplesAndShortStreams) {
+    StatsAggregator<int> aggregator(4);
+    std::vector<WindowSummary> summaries;
+    aggregator.subscribe([&](const WindowSummary& summary) { summaries.push_back(summary); });
+
+    const int first[] = {40, 10, 30};
+    aggregator.add(std::span<const int>(first));
+    BOOST_CHECK(summaries.empty()); // Not a full window yet
+
+    aggregator.add(20);
+    BOOST_REQUIRE_EQUAL(summaries.size(), 1);
+    BOOST_CHECK_EQUAL(summaries[0].min, 10.0);
+    BOOST_CHECK_EQUAL(summaries[0].max, 40.0);
+    BOOST_CHECK_EQUAL(summaries[0].mean, 25.0);
+    BOOST_CHECK_EQUAL(summaries[0].variance, 125.0);
+    BOOST_CHECK_EQUAL(summaries[0].p50, 20.0);
+    BOOST_CHECK_EQUAL(summaries[0].p90, 40.0);
+    BOOST_CHECK_EQUAL(summaries[0].p99, 40.0);
+}
+
+// Test Case 4: Invalid Window Shapes Are Rejected
+BOOST_AUTO_TEST_CASE(InvalidShapes) {
+    BOOST_CHECK_THROW(StatsAggregator<double>(0), std::invalid_argument);
+    BOOST_CHECK_THROW(StatsAggregator<double>(10, 11), std::invalid_argument);
+    StatsAggregator<double> tumbling(10, 0);
+    BOOST_CHECK_EQUAL(tumbling.hop(), 10);
+    BOOST_CHECK_EQUAL(tumbling.window(), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+// test_timer_wheel.cpp
+
+#define BOOST_TEST_MODULE TimerWheelTest
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <boost/asio.hpp>
+
+#include "timer_wheel.hpp"
+
+BOOST_AUTO_TEST_SUITE(TimerWheelSuite)
+
+// Test Case 1: Periods Longer Than One Lap Wait for Their Due Tick
+BOOST_AUTO_TEST_CASE(PeriodsLongerThanOneLap) {
+    boost::asio::io_context io;
+    TimerWheel wheel(io, std::chrono::milliseconds(1), 8); // One lap is 8 ms
+    int long_runs = 0;
+    int short_runs = 0;
+    wheel.schedule_every(std::chrono::milliseconds(20), [&]() { ++long_runs; });
+    wheel.schedule_every(std::chrono::milliseconds(2), [&]() { ++short_runs; });
+    BOOST_CHECK_EQUAL(wheel.size(), 2);
+
+    io.run_for(std::chrono::milliseconds(205));
+
+    // Every lap would give 25 runs; every 20 ticks gives 10
+    BOOST_CHECK_GE(long_runs, 8);
+    BOOST_CHECK_LE(long_runs, 10);
+    BOOST_CHECK_GE(short_runs, 10 * long_runs - 10);
+    BOOST_CHECK_LE(short_runs, 10 * long_runs + 10);
+}
+
+// Test Case 2: A Task Can Cancel Itself
+BOOST_AUTO_TEST_CASE(TaskCancelsItself) {
+    boost::asio::io_context io;
+    TimerWheel wheel(io);
+    int runs = 0;
+    TimerWheel::TaskId id = 0;
+    id = wheel.schedule_every(std::chrono::milliseconds(1), [&]() {
+        if (++runs == 3) {
+            BOOST_CHECK(wheel.cancel(id));
+        }
+    });
+    int other_runs = 0;
+    wheel.schedule_every(std::chrono::milliseconds(1), [&]() { ++other_runs; });
+
+    io.run_for(std::chrono::milliseconds(30));
+    BOOST_CHECK_EQUAL(runs, 3);
+    BOOST_CHECK_GT(other_runs, 3); // The rest of the wheel keeps going
+    BOOST_CHECK_EQUAL(wheel.size(), 1);
+    BOOST_CHECK(!wheel.cancel(id));
+}
+
+// Test Case 3: cancel() From Another Thread Waits for a Running Tick
+BOOST_AUTO_TEST_CASE(CancelFromAnotherThreadWaitsForTick) {
+    boost::asio::io_context io;
+    TimerWheel wheel(io);
+    std::atomic<bool> in_callback{false};
+    std::atomic<int> runs{0};
+    const TimerWheel::TaskId id = wheel.schedule_every(std::chrono::milliseconds(1), [&]() {
+        in_callback = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        runs++;
+        in_callback = false;
+    });
+
+    std::thread runner([&]() { io.run_for(std::chrono::milliseconds(200)); });
+    while (!in_callback.load()) {
+        std::this_thread::yield();
+    }
+    BOOST_CHECK(wheel.cancel(id));
+    BOOST_CHECK(!in_callback.load()); // The running callback finished before cancel() returned
+    const int runs_at_cancel = runs.load();
+    BOOST_CHECK_GE(runs_at_cancel, 1);
+
+    runner.join();
+    BOOST_CHECK_EQUAL(runs.load(), runs_at_cancel);
+    BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+// Test Case 4: A Late Wakeup Runs the Ticks It Missed
+BOOST_AUTO_TEST_CASE(CatchUpAfterLateWakeup) {
+    boost::asio::io_context io;
+    TimerWheel wheel(io);
+    int runs = 0;
+    wheel.schedule_every(std::chrono::milliseconds(1), [&]() { ++runs; });
+
+    // Nothing runs the io_context for 60 ticks
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    BOOST_CHECK_EQUAL(runs, 0);
+
+    io.run_one(); // The single late timer completion runs every missed tick
+    BOOST_CHECK_GE(runs, 55);
+}
+
+// Test Case 5: Invalid Parameters Are Rejected
+BOOST_AUTO_TEST_CASE(InvalidParameters) {
+    boost::asio::io_context io;
+    BOOST_CHECK_THROW(TimerWheel(io, std::chrono::nanoseconds(0)), std::invalid_argument);
+    BOOST_CHECK_THROW(TimerWheel(io, std::chrono::milliseconds(1), 0), std::invalid_argument);
+    TimerWheel wheel(io, std::chrono::milliseconds(2));
+    BOOST_CHECK(wheel.tick() == std::chrono::milliseconds(2));
+    BOOST_CHECK(&wheel.get_io_context() == &io);
+    BOOST_CHECK(!wheel.cancel(42));
+}
+
+BOOST_AUTO_TEST_SUITE_END()